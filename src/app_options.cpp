@@ -10,12 +10,12 @@ using namespace std::literals;
 
 namespace {
 
-std::stringstream create_arg_stream(int argc, char* argv[])
+std::stringstream create_arg_stream(const std::vector<std::string>& arguments)
 {
    std::stringstream arg_stream;
 
-   for (auto i = 1; i < argc; ++i) {
-      arg_stream << std::quoted(argv[i]);
+   for (const auto& argument : arguments) {
+      arg_stream << std::quoted(argument);
    }
 
    return arg_stream;
@@ -29,6 +29,14 @@ std::string read_file_path(std::istream& istream)
    return str;
 }
 
+std::size_t read_size(std::istream& istream)
+{
+   std::string str;
+   istream >> std::quoted(str);
+
+   return std::stoull(str);
+}
+
 auto append_file_list(std::istream& istream, std::vector<std::string>& out)
 {
    std::string list;
@@ -48,6 +56,14 @@ auto append_file_list(std::istream& istream, std::vector<std::string>& out)
    if (!view.empty()) out.emplace_back(view);
 }
 
+std::string read_chunk_filter_rules(std::istream& istream)
+{
+   std::string str;
+   istream >> std::quoted(str);
+
+   return str;
+}
+
 std::istream& operator>>(std::istream& istream, Tool_mode& mode)
 {
    std::string str;
@@ -62,6 +78,9 @@ std::istream& operator>>(std::istream& istream, Tool_mode& mode)
    else if (str == "assemble"sv) {
       mode = Tool_mode::assemble;
    }
+   else if (str == "bench"sv) {
+      mode = Tool_mode::bench;
+   }
    else {
       throw std::invalid_argument{"Invalid tool mode specified."};
    }
@@ -150,6 +169,30 @@ std::istream& operator>>(std::istream& istream, Model_discard_flags& model_disca
    return istream;
 }
 
+std::istream& operator>>(std::istream& istream, logger::Level& level)
+{
+   std::string str;
+   istream >> std::quoted(str);
+
+   if (str == "debug"sv) {
+      level = logger::Level::debug;
+   }
+   else if (str == "info"sv) {
+      level = logger::Level::info;
+   }
+   else if (str == "warning"sv) {
+      level = logger::Level::warning;
+   }
+   else if (str == "error"sv) {
+      level = logger::Level::error;
+   }
+   else {
+      throw std::invalid_argument{"Invalid log level specified."};
+   }
+
+   return istream;
+}
+
 std::istream& operator>>(std::istream& istream, Input_platform& platform)
 {
    std::string str;
@@ -203,15 +246,101 @@ constexpr auto input_plat_opt_description{
 
 constexpr auto verbose_opt_description{R"(Enable verbose output.)"sv};
 
+constexpr auto log_level_opt_description{
+   R"(<level> Set the least severe messages to output. Can be 'debug', 'info', 'warning' or 'error'.
+   Default is 'info'. Unknown hashes are listed in one warning at exit, with how often each was
+   looked up.)"sv};
+
+constexpr auto prefault_opt_description{
+   R"(Load input files into memory in full when processing of them starts instead of paging
+   them in as they are read. Can reduce stalls on cold files at the cost of memory usage.)"sv};
+
+constexpr auto stream_opt_description{
+   R"(Read input files in bounded windows instead of mapping them into memory. Useful for
+   network mounts or when reading from standard input (-file -). Only supported in extract mode.)"sv};
+
+constexpr auto stream_memory_opt_description{
+   R"(<megabytes> Set the amount of memory used to hold chunks in flight while streaming an
+   input file. Chunks larger than this are still read whole, one at a time. Default is '64'.)"sv};
+
+constexpr auto write_threads_opt_description{
+   R"(<count> Set how many threads write output files. Files are queued for these threads so
+   the threads extracting chunks don't wait on the disk. '0' writes files on the threads that
+   produce them. Default is '2'.)"sv};
+
+constexpr auto write_memory_opt_description{
+   R"(<megabytes> Set the amount of memory used to hold output files waiting to be written.
+   Saving a file waits for earlier ones to be written once this is reached. Default is '64'.)"sv};
+
+constexpr auto archive_opt_description{
+   R"(Write the output of each input file into a single .tar archive next to it, instead of a
+   directory tree. Unpacking the archive gives the same tree. Used in extract and explode mode.)"sv};
+
+constexpr auto dedup_opt_description{
+   R"(Decode textures and object classes that appear more than once across the input files only
+   once. Later copies are hard linked to the first one's output, or copied where linking isn't
+   possible. Has no effect with -archive.)"sv};
+
+constexpr auto cache_opt_description{
+   R"(<cache_file> Keep a record of the chunks extracted and the files they produced between runs.
+   Chunks recorded by an earlier run with the same options whose files are unchanged are skipped
+   instead of being decoded and saved again. Implies -dedup and so has no effect with -archive.)"sv};
+
+constexpr auto exact_floats_opt_description{
+   R"(Write floats in text outputs, like configs and world files, with as many digits as are
+   needed to read back the exact value instead of always six decimal places.)"sv};
+
+constexpr auto index_opt_description{
+   R"(Use a chunk index (saved next to each input file as <file>.index) to find chunks
+   instead of walking the file. The index is built and saved if it is missing or out of date.
+   -only rules that give a chunk type or a name without wildcards find their chunks in the
+   index directly.)"sv};
+
+constexpr auto only_opt_description{
+   R"(<rules> Only process chunks matching one of a list of rules, delimited by ';'. A rule is a
+   magic number, a magic number and a name pattern ("modl:rep_*") or just a name pattern
+   (":*_dtl"). Name patterns are case insensitive and support '*' and '?'.
+   Example: "-only tex_;modl;skel;coll;prim;CLTH")"sv};
+
+constexpr auto skip_opt_description{
+   R"(<rules> Skip chunks matching any of a list of rules, delimited by ';'. Uses the same
+   rules as -only and takes priority over it. Example: "-skip tex_;:*_lowres")"sv};
+
+constexpr auto cost_model_opt_description{
+   R"(<cost_file> Specify a file of weights used to estimate how long each chunk will take to
+   process, so the slowest can be started first. Each line is "<magic> <per_byte> <fixed>", with
+   '*' as the magic setting the weight for chunks not otherwise listed.)"sv};
+
+constexpr auto report_opt_description{
+   R"(<report_file> Time the processing of each chunk and write a report of where the time went,
+   aggregated per magic number and per input file. The report is JSON if the file name ends in
+   .json and CSV otherwise. The per magic number entries include a fit of nanoseconds per byte
+   and fixed nanoseconds per chunk that can be used as the weights of a -costmodel file.)"sv};
+
+constexpr auto trace_opt_description{
+   R"(<trace_file> Record a timeline of the work done on each thread (files, chunk handlers,
+   image conversion, model saving and file writes) and save it in Chrome's trace event format.
+   Open it with chrome://tracing or https://ui.perfetto.dev.)"sv};
+
+constexpr auto bench_scale_opt_description{
+   R"(<scale> Set how many chunks of each kind the synthetic files generated in bench mode hold.
+   The size of each chunk stays the same, so timings scale linearly. Default is '1'.)"sv};
+
+constexpr auto bench_runs_opt_description{
+   R"(<runs> Set how many times each benchmark is run in bench mode, after a warm up run.
+   Default is '5'.)"sv};
+
 constexpr auto string_dict_opt_description{
    R"(<dictionary_file> Specify a file of strings to be used in hash lookup; used in addition to the 
    program's built in string dictionary. File format is plain text, 1 line = 1 string.)"sv};
 
 constexpr auto mode_opt_description{
-   R"(<mode> Set the mode of operation for the tool. Can be 'extract', 'explode' or 'assemble'.
+   R"(<mode> Set the mode of operation for the tool. Can be 'extract', 'explode', 'assemble' or 'bench'.
    'extract' (default) - Extract and "unmunge" the contents of the file.
    'explode' - Recursively explode the file's chunks into their hierarchies.
-   'assemble' - Recursively assemble a previously exploded file. Input files will be treated as directories.)"sv};
+   'assemble' - Recursively assemble a previously exploded file. Input files will be treated as directories.
+   'bench' - Generate synthetic files and time reading, extracting and saving them. Input files will be
+   treated as directories to work in, results are saved to benchmark.csv in each.)"sv};
 
 App_options::App_options()
 {
@@ -235,15 +364,53 @@ App_options::App_options()
       {"-platform"s, [this](Istr& istr) { istr >> _input_platform; },
        input_plat_opt_description},
       {"-verbose"s, [this](Istr&) { _verbose = true; }, verbose_opt_description},
+      {"-loglevel"s, [this](Istr& istr) { istr >> _log_level; }, log_level_opt_description},
+      {"-prefault"s, [this](Istr&) { _prefault_files = true; }, prefault_opt_description},
+      {"-stream"s, [this](Istr&) { _stream_input = true; }, stream_opt_description},
+      {"-streammemory"s,
+       [this](Istr& istr) { _stream_memory_ceiling_mb = read_size(istr); },
+       stream_memory_opt_description},
+      {"-writethreads"s, [this](Istr& istr) { _write_threads = read_size(istr); },
+       write_threads_opt_description},
+      {"-writememory"s,
+       [this](Istr& istr) { _write_memory_ceiling_mb = read_size(istr); },
+       write_memory_opt_description},
+      {"-archive"s, [this](Istr&) { _archive_output = true; }, archive_opt_description},
+      {"-dedup"s, [this](Istr&) { _dedup_outputs = true; }, dedup_opt_description},
+      {"-cache"s, [this](Istr& istr) { _extract_cache_file = read_file_path(istr); },
+       cache_opt_description},
+      {"-exactfloats"s, [this](Istr&) { _exact_floats = true; },
+       exact_floats_opt_description},
+      {"-index"s, [this](Istr&) { _use_chunk_index = true; }, index_opt_description},
+      {"-only"s,
+       [this](Istr& istr) { _chunk_filter.add_only_rules(read_chunk_filter_rules(istr)); },
+       only_opt_description},
+      {"-skip"s,
+       [this](Istr& istr) { _chunk_filter.add_skip_rules(read_chunk_filter_rules(istr)); },
+       skip_opt_description},
+      {"-costmodel"s, [this](Istr& istr) { _cost_model_file = read_file_path(istr); },
+       cost_model_opt_description},
+      {"-report"s, [this](Istr& istr) { _report_file = read_file_path(istr); },
+       report_opt_description},
+      {"-trace"s, [this](Istr& istr) { _trace_file = read_file_path(istr); },
+       trace_opt_description},
+      {"-benchscale"s, [this](Istr& istr) { _bench_scale = read_size(istr); },
+       bench_scale_opt_description},
+      {"-benchruns"s, [this](Istr& istr) { _bench_runs = read_size(istr); },
+       bench_runs_opt_description},
       {"-string_dict"s, [this](Istr& istr) { _user_string_dict = read_file_path(istr); },
        string_dict_opt_description},
       {"-mode"s, [this](Istr& istr) { istr >> _tool_mode; }, mode_opt_description}};
 }
 
-App_options::App_options(int argc, char* argv[]) : App_options()
+App_options::App_options(int argc, char* argv[])
+   : App_options{std::vector<std::string>{argv + std::min(argc, 1), argv + argc}}
 {
+}
 
-   auto arg_stream = create_arg_stream(argc, argv);
+App_options::App_options(const std::vector<std::string>& arguments) : App_options()
+{
+   auto arg_stream = create_arg_stream(arguments);
 
    while (arg_stream) {
       std::string arg;
@@ -305,6 +472,91 @@ bool App_options::verbose() const noexcept
    return _verbose;
 }
 
+logger::Level App_options::log_level() const noexcept
+{
+   return _log_level;
+}
+
+bool App_options::prefault_files() const noexcept
+{
+   return _prefault_files;
+}
+
+bool App_options::stream_input() const noexcept
+{
+   return _stream_input;
+}
+
+bool App_options::use_chunk_index() const noexcept
+{
+   return _use_chunk_index;
+}
+
+std::size_t App_options::stream_memory_ceiling() const noexcept
+{
+   return _stream_memory_ceiling_mb * 1024 * 1024;
+}
+
+std::size_t App_options::write_threads() const noexcept
+{
+   return _write_threads;
+}
+
+std::size_t App_options::write_memory_ceiling() const noexcept
+{
+   return _write_memory_ceiling_mb * 1024 * 1024;
+}
+
+bool App_options::archive_output() const noexcept
+{
+   return _archive_output;
+}
+
+bool App_options::dedup_outputs() const noexcept
+{
+   return _dedup_outputs || !_extract_cache_file.empty();
+}
+
+std::string App_options::extract_cache_file() const noexcept
+{
+   return _extract_cache_file;
+}
+
+bool App_options::exact_floats() const noexcept
+{
+   return _exact_floats;
+}
+
+auto App_options::chunk_filter() const noexcept -> const Chunk_filter&
+{
+   return _chunk_filter;
+}
+
+std::string App_options::cost_model_file() const noexcept
+{
+   return _cost_model_file;
+}
+
+std::string App_options::report_file() const noexcept
+{
+   return _report_file;
+}
+
+std::string App_options::trace_file() const noexcept
+{
+   return _trace_file;
+}
+
+std::size_t App_options::bench_scale() const noexcept
+{
+   return _bench_scale;
+}
+
+std::size_t App_options::bench_runs() const noexcept
+{
+   return _bench_runs;
+}
+
 void App_options::print_arguments(std::ostream& ostream) noexcept
 {
    ostream << '\n';
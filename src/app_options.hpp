@@ -1,13 +1,16 @@
 #pragma once
 
 #include "bit_flags.hpp"
+#include "chunk_filter.hpp"
+#include "logger.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <string>
 #include <vector>
 
-enum class Tool_mode { extract, explode, assemble };
+enum class Tool_mode { extract, explode, assemble, bench };
 
 enum class Image_format { tga, png, dds };
 
@@ -33,6 +36,10 @@ public:
 
    App_options(const int argc, char* argv[]);
 
+   //! \brief Reads options from a list of arguments, as they would be given on the
+   //! command line without the program name.
+   explicit App_options(const std::vector<std::string>& arguments);
+
    auto input_files() const noexcept -> const std::vector<std::string>&;
 
    Tool_mode tool_mode() const noexcept;
@@ -53,6 +60,40 @@ public:
 
    bool verbose() const noexcept;
 
+   logger::Level log_level() const noexcept;
+
+   bool prefault_files() const noexcept;
+
+   bool stream_input() const noexcept;
+
+   bool use_chunk_index() const noexcept;
+
+   std::size_t stream_memory_ceiling() const noexcept;
+
+   std::size_t write_threads() const noexcept;
+
+   std::size_t write_memory_ceiling() const noexcept;
+
+   bool archive_output() const noexcept;
+
+   bool dedup_outputs() const noexcept;
+
+   std::string extract_cache_file() const noexcept;
+
+   bool exact_floats() const noexcept;
+
+   auto chunk_filter() const noexcept -> const Chunk_filter&;
+
+   std::string cost_model_file() const noexcept;
+
+   std::string report_file() const noexcept;
+
+   std::string trace_file() const noexcept;
+
+   std::size_t bench_scale() const noexcept;
+
+   std::size_t bench_runs() const noexcept;
+
    void print_arguments(std::ostream& ostream) noexcept;
 
 private:
@@ -80,4 +121,21 @@ private:
    Model_discard_flags _model_discard_flags = Model_discard_flags::none;
    Input_platform _input_platform = Input_platform::pc;
    bool _verbose = false;
+   logger::Level _log_level = logger::Level::info;
+   bool _prefault_files = false;
+   bool _stream_input = false;
+   bool _use_chunk_index = false;
+   std::size_t _stream_memory_ceiling_mb = 64;
+   std::size_t _write_threads = 2;
+   std::size_t _write_memory_ceiling_mb = 64;
+   bool _archive_output = false;
+   bool _dedup_outputs = false;
+   std::string _extract_cache_file;
+   bool _exact_floats = false;
+   Chunk_filter _chunk_filter;
+   std::string _cost_model_file;
+   std::string _report_file;
+   std::string _trace_file;
+   std::size_t _bench_scale = 1;
+   std::size_t _bench_runs = 5;
 };
@@ -0,0 +1,528 @@
+#include "bench_corpus.hpp"
+#include "magic_number.hpp"
+#include "swbf_fnv_hashes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace bench {
+
+namespace {
+
+constexpr std::array property_names{"GeometryName"sv, "ClassLabel"sv,  "MaxHealth"sv,
+                                    "MaxSpeed"sv,     "Acceleration"sv, "TurnRate"sv,
+                                    "SoundProperty"sv, "EffectName"sv,  "Position"sv,
+                                    "Color"sv,        "Texture"sv,      "Flags"sv};
+
+constexpr std::uint32_t d3dfmt_a8r8g8b8 = 21;
+constexpr std::uint32_t xbox_format_a8r8g8b8 = 6;
+constexpr std::uint16_t ps2_format_8bit = 8;
+constexpr std::int32_t d3dpt_triangle_list = 4;
+constexpr std::uint32_t vbuf_position_normal_texcoords = 0b1000100010u;
+constexpr std::uint32_t terrain_vbuf_geometry = 290;
+constexpr std::uint32_t terrain_vbuf_texture = 20770;
+
+using Vec3 = std::array<float, 3>;
+
+constexpr std::array<float, 12> identity_transform{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+                                                   0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f};
+
+auto indexed_name(std::string_view prefix, std::size_t index) -> std::string
+{
+   return std::string{prefix} += std::to_string(index);
+}
+
+auto create_random(std::size_t seed) -> std::minstd_rand
+{
+   return std::minstd_rand{static_cast<std::minstd_rand::result_type>(seed + 1)};
+}
+
+// Runs of repeated values with short noisy stretches between them, so the result has
+// something for both kinds of PS2 RLE sequence to do.
+template<typename Type>
+auto create_rle_source(std::size_t count, std::minstd_rand& random) -> std::vector<Type>
+{
+   std::vector<Type> values;
+   values.reserve(count);
+
+   while (values.size() < count) {
+      const auto run = std::min<std::size_t>(random() % 48 + 1, count - values.size());
+      const auto value = static_cast<Type>(random());
+
+      if (random() % 2) {
+         values.insert(values.end(), run, value);
+      }
+      else {
+         for (std::size_t i = 0; i < run; ++i) {
+            values.push_back(static_cast<Type>(random()));
+         }
+      }
+   }
+
+   return values;
+}
+
+template<typename Type>
+void write_rle(Ucfb_builder& body, const std::vector<Type>& values)
+{
+   constexpr std::size_t max_sequence = 128;
+
+   for (std::size_t i = 0; i < values.size();) {
+      std::size_t repeats = 1;
+
+      while (i + repeats < values.size() && repeats < max_sequence &&
+             values[i + repeats] == values[i]) {
+         ++repeats;
+      }
+
+      if (repeats > 1) {
+         body.write(static_cast<std::uint8_t>(0x80u | (repeats - 1)));
+         body.write(values[i]);
+
+         i += repeats;
+
+         continue;
+      }
+
+      std::size_t literals = 1;
+
+      while (i + literals < values.size() && literals < max_sequence &&
+             (i + literals + 1 >= values.size() ||
+              values[i + literals] != values[i + literals + 1])) {
+         ++literals;
+      }
+
+      body.write(static_cast<std::uint8_t>(literals - 1));
+
+      for (std::size_t j = 0; j < literals; ++j) body.write(values[i + j]);
+
+      i += literals;
+   }
+}
+
+void write_float_data(Ucfb_builder& parent, std::uint32_t hash,
+                      const std::vector<float>& values)
+{
+   auto& data = parent.emplace_child("DATA"_mn);
+
+   data.write(hash);
+   data.write(static_cast<std::uint8_t>(values.size()));
+
+   for (const auto value : values) data.write(value);
+
+   data.write(std::uint32_t{0});
+}
+
+void write_string_data(Ucfb_builder& parent, std::uint32_t hash, std::string_view value)
+{
+   auto& data = parent.emplace_child("DATA"_mn);
+
+   data.write(hash);
+   data.write(std::uint8_t{1});
+   data.write(std::uint32_t{4});
+   data.write(static_cast<std::uint32_t>(value.size() + 1));
+   data.write(value, true, false);
+}
+
+void write_properties(Ucfb_builder& parent, std::size_t count, std::minstd_rand& random)
+{
+   for (std::size_t i = 0; i < count; ++i) {
+      const auto hash = fnv_1a_hash(property_names[i % property_names.size()]);
+
+      if (i % 3 == 0) {
+         write_string_data(parent, hash, indexed_name("bench_value_"sv, random() % 64));
+      }
+      else {
+         std::vector<float> values(random() % 4 + 1);
+
+         for (auto& value : values) value = static_cast<float>(random() % 4096) / 16.0f;
+
+         write_float_data(parent, hash, values);
+      }
+   }
+}
+
+void write_world_property(Ucfb_builder& parent, std::string_view name,
+                          std::string_view value)
+{
+   auto& prop = parent.emplace_child("PROP"_mn);
+
+   prop.write(fnv_1a_hash(name));
+   prop.write(value);
+}
+
+auto random_position(std::minstd_rand& random) -> std::array<float, 12>
+{
+   auto transform = identity_transform;
+
+   transform[9] = static_cast<float>(random() % 2048) - 1024.0f;
+   transform[10] = static_cast<float>(random() % 64);
+   transform[11] = static_cast<float>(random() % 2048) - 1024.0f;
+
+   return transform;
+}
+
+void write_segment(Ucfb_builder& model, std::size_t model_index,
+                   const std::uint16_t grid_length)
+{
+   auto& segment = model.emplace_child("segm"_mn);
+
+   const std::uint32_t vertex_count = grid_length * grid_length;
+   const std::uint32_t quad_count = (grid_length - 1) * (grid_length - 1);
+
+   segment.emplace_child("INFO"_mn).write_multiple(d3dpt_triangle_list, vertex_count,
+                                                   quad_count * 2);
+
+   auto& material = segment.emplace_child("MTRL"_mn);
+   material.write_multiple(std::uint32_t{1}, 0xffffffffu, 0xffffffffu, std::uint32_t{50},
+                           std::uint32_t{0}, std::uint32_t{0});
+   material.write(""sv);
+
+   segment.emplace_child("MNAM"_mn).write("bench_material"sv);
+
+   auto& texture_name = segment.emplace_child("TNAM"_mn);
+   texture_name.write(std::uint32_t{0});
+   texture_name.write(indexed_name("bench_texture_"sv, model_index));
+
+   auto& ibuf = segment.emplace_child("IBUF"_mn);
+   ibuf.write(quad_count * 6);
+
+   for (std::uint16_t y = 0; y < grid_length - 1; ++y) {
+      for (std::uint16_t x = 0; x < grid_length - 1; ++x) {
+         const auto i = static_cast<std::uint16_t>(y * grid_length + x);
+
+         ibuf.write_multiple(i, static_cast<std::uint16_t>(i + grid_length),
+                             static_cast<std::uint16_t>(i + 1),
+                             static_cast<std::uint16_t>(i + 1),
+                             static_cast<std::uint16_t>(i + grid_length),
+                             static_cast<std::uint16_t>(i + grid_length + 1));
+      }
+   }
+
+   auto& vbuf = segment.emplace_child("VBUF"_mn);
+   vbuf.write_multiple(vertex_count, std::uint32_t{32}, vbuf_position_normal_texcoords);
+
+   for (std::uint16_t y = 0; y < grid_length; ++y) {
+      for (std::uint16_t x = 0; x < grid_length; ++x) {
+         const auto u = static_cast<float>(x) / static_cast<float>(grid_length - 1);
+         const auto v = static_cast<float>(y) / static_cast<float>(grid_length - 1);
+
+         vbuf.write_multiple(Vec3{u * 2.0f - 1.0f, 0.0f, v * 2.0f - 1.0f},
+                             Vec3{0.0f, 1.0f, 0.0f}, std::array{u, v});
+      }
+   }
+}
+
+void write_patch(Ucfb_builder& patches, std::minstd_rand& random)
+{
+   auto& patch = patches.emplace_child("PTCH"_mn);
+
+   patch.emplace_child("INFO"_mn).write_multiple(std::uint32_t{0}, std::uint32_t{0});
+
+   auto& geometry = patch.emplace_child("VBUF"_mn);
+   geometry.write_multiple(std::uint32_t{81}, std::uint32_t{28}, terrain_vbuf_geometry);
+
+   for (std::size_t i = 0; i < 81; ++i) {
+      geometry.write_multiple(Vec3{0.0f, static_cast<float>(random() % 256), 0.0f},
+                              Vec3{0.0f, 1.0f, 0.0f},
+                              static_cast<std::uint32_t>(random()));
+   }
+
+   auto& texture = patch.emplace_child("VBUF"_mn);
+   texture.write_multiple(std::uint32_t{81}, std::uint32_t{16}, terrain_vbuf_texture);
+
+   for (std::size_t i = 0; i < 81; ++i) {
+      const std::array<std::uint8_t, 4> values{0, static_cast<std::uint8_t>(random()), 0,
+                                               static_cast<std::uint8_t>(random())};
+
+      texture.write_multiple(std::array<std::uint16_t, 4>{}, values,
+                             static_cast<std::uint32_t>(random()));
+   }
+}
+
+}
+
+auto corpus_sizes(std::size_t scale) noexcept -> Corpus_sizes
+{
+   scale = std::max<std::size_t>(scale, 1);
+
+   return {.configs = 16 * scale,
+           .config_properties = 48,
+           .config_scopes = 8,
+           .textures = 8 * scale,
+           .texture_length = 256,
+           .models = 16 * scale,
+           .model_segments = 4,
+           .segment_grid_length = 32,
+           .terrains = scale,
+           .terrain_grid_size = 128,
+           .worlds = 2 * scale,
+           .world_instances = 1024,
+           .world_regions = 64};
+}
+
+auto create_config(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder config{"fx__"_mn};
+
+   config.emplace_child("NAME"_mn).write(
+      fnv_1a_hash(indexed_name("bench_config_"sv, index)));
+
+   write_properties(config, sizes.config_properties, random);
+
+   for (std::size_t i = 0; i < sizes.config_scopes; ++i) {
+      write_string_data(config, "Effect"_fnv, indexed_name("bench_value_"sv, i));
+
+      auto& scope = config.emplace_child("SCOP"_mn);
+
+      write_properties(scope, sizes.config_properties / sizes.config_scopes, random);
+   }
+
+   return config;
+}
+
+auto create_texture_pc(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder texture{"tex_"_mn};
+
+   texture.emplace_child("NAME"_mn).write(indexed_name("bench_texture_"sv, index));
+   texture.emplace_child("INFO"_mn).write_multiple(std::uint32_t{1}, d3dfmt_a8r8g8b8);
+
+   auto& format = texture.emplace_child("FMT_"_mn);
+
+   std::uint16_t mip_count = 1;
+
+   while ((sizes.texture_length >> mip_count) != 0) ++mip_count;
+
+   format.emplace_child("INFO"_mn).write_multiple(d3dfmt_a8r8g8b8, sizes.texture_length,
+                                                  sizes.texture_length, std::uint16_t{1},
+                                                  mip_count, std::uint32_t{1});
+
+   auto& face = format.emplace_child("FACE"_mn);
+
+   for (std::uint32_t mip = 0; mip < mip_count; ++mip) {
+      const auto length = std::max(sizes.texture_length >> mip, 1);
+      const auto body_size = static_cast<std::uint32_t>(length * length * 4);
+
+      auto& level = face.emplace_child("LVL_"_mn);
+
+      level.emplace_child("INFO"_mn).write_multiple(mip, body_size);
+
+      auto& body = level.emplace_child("BODY"_mn);
+
+      for (std::uint32_t i = 0; i < body_size / 4; ++i) {
+         body.write(static_cast<std::uint32_t>(random()));
+      }
+   }
+
+   return texture;
+}
+
+auto create_texture_xbox(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder texture{"tex_"_mn};
+
+   const auto body_size =
+      static_cast<std::uint32_t>(sizes.texture_length * sizes.texture_length * 4);
+
+   texture.emplace_child("NAME"_mn).write(indexed_name("bench_texture_"sv, index));
+   texture.emplace_child("INFO"_mn).write_multiple(
+      sizes.texture_length, sizes.texture_length, std::uint16_t{1}, std::uint16_t{1},
+      std::uint32_t{1}, xbox_format_a8r8g8b8, body_size);
+
+   auto& body = texture.emplace_child("BODY"_mn);
+
+   for (std::uint32_t i = 0; i < body_size / 4; ++i) {
+      body.write(static_cast<std::uint32_t>(random()));
+   }
+
+   return texture;
+}
+
+auto create_texture_ps2(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder texture{"tex_"_mn};
+
+   texture.emplace_child("NAME"_mn).write(indexed_name("bench_texture_"sv, index));
+   texture.emplace_child("INFO"_mn).write_multiple(sizes.texture_length,
+                                                   sizes.texture_length, ps2_format_8bit,
+                                                   std::uint16_t{0}, 0.0f,
+                                                   std::uint16_t{1});
+
+   auto& palette = texture.emplace_child("pal_"_mn);
+
+   palette.emplace_child("INFO"_mn).write_multiple(std::uint16_t{256}, std::uint16_t{32});
+
+   write_rle(palette.emplace_child("BODY"_mn),
+             create_rle_source<std::uint32_t>(256, random));
+
+   write_rle(texture.emplace_child("BODY"_mn),
+             create_rle_source<std::uint8_t>(
+                std::size_t{sizes.texture_length} * sizes.texture_length, random));
+
+   return texture;
+}
+
+auto create_model(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   Ucfb_builder model{"modl"_mn};
+
+   model.emplace_child("NAME"_mn).write(indexed_name("bench_model_"sv, index));
+   model.emplace_child("NODE"_mn).write(""sv);
+
+   const std::uint32_t face_count =
+      static_cast<std::uint32_t>(sizes.model_segments * 2 *
+                                 (sizes.segment_grid_length - 1) *
+                                 (sizes.segment_grid_length - 1));
+
+   model.emplace_child("INFO"_mn).write_multiple(
+      std::array<std::int32_t, 4>{}, Vec3{-1.0f, 0.0f, -1.0f}, Vec3{1.0f, 0.0f, 1.0f},
+      Vec3{-1.0f, 0.0f, -1.0f}, Vec3{1.0f, 0.0f, 1.0f}, std::int32_t{0}, face_count);
+
+   for (std::size_t i = 0; i < sizes.model_segments; ++i) {
+      write_segment(model, index, sizes.segment_grid_length);
+   }
+
+   return model;
+}
+
+auto create_terrain(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder terrain{"tern"_mn};
+
+   constexpr std::uint16_t texture_count = 2;
+
+   terrain.emplace_child("NAME"_mn).write(indexed_name("bench_terrain_"sv, index));
+   terrain.emplace_child("INFO"_mn).write_multiple(
+      8.0f, 0.01f, -10.0f, 10.0f, sizes.terrain_grid_size,
+      static_cast<std::uint16_t>(sizes.terrain_grid_size / 8),
+      static_cast<std::uint16_t>(sizes.terrain_grid_size / 8), texture_count,
+      texture_count, std::uint16_t{0});
+
+   auto& textures = terrain.emplace_child("LTEX"_mn);
+
+   for (std::uint16_t i = 0; i < texture_count; ++i) {
+      textures.write(indexed_name("bench_texture_"sv, i), true, false);
+   }
+
+   terrain.emplace_child("DTEX"_mn).write(""sv);
+   terrain.emplace_child("DTLX"_mn).write("bench_detail"sv);
+   terrain.emplace_child("SCAL"_mn).write(std::array<float, 16>{});
+   terrain.emplace_child("AXIS"_mn).write(std::array<std::uint8_t, 16>{});
+   terrain.emplace_child("ROTN"_mn).write(std::array<float, 16>{});
+
+   auto& patches = terrain.emplace_child("PCHS"_mn);
+
+   patches.emplace_child("COMN"_mn);
+
+   const std::size_t patch_count =
+      std::size_t{sizes.terrain_grid_size} * sizes.terrain_grid_size / 64;
+
+   for (std::size_t i = 0; i < patch_count; ++i) write_patch(patches, random);
+
+   return terrain;
+}
+
+auto create_world(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   auto random = create_random(index);
+
+   Ucfb_builder world{"wrld"_mn};
+
+   world.emplace_child("NAME"_mn).write(indexed_name("bench_world_"sv, index));
+   world.emplace_child("TNAM"_mn).write("bench_terrain_0"sv);
+   world.emplace_child("SNAM"_mn).write("bench_sky"sv);
+
+   for (std::size_t i = 0; i < sizes.world_regions; ++i) {
+      auto& region = world.emplace_child("regn"_mn);
+      auto& info = region.emplace_child("INFO"_mn);
+
+      info.emplace_child("TYPE"_mn).write("box"sv);
+      info.emplace_child("NAME"_mn).write(indexed_name("bench_region_"sv, i));
+      info.emplace_child("XFRM"_mn).write(random_position(random));
+      info.emplace_child("SIZE"_mn).write(Vec3{16.0f, 16.0f, 16.0f});
+
+      write_world_property(region, "SoundProperty"sv, "bench_sound"sv);
+   }
+
+   for (std::size_t i = 0; i < sizes.world_instances; ++i) {
+      auto& instance = world.emplace_child("inst"_mn);
+      auto& info = instance.emplace_child("INFO"_mn);
+
+      info.emplace_child("TYPE"_mn).write(indexed_name("bench_class_"sv, i % 16));
+      info.emplace_child("NAME"_mn).write(indexed_name("bench_object_"sv, i));
+      info.emplace_child("XFRM"_mn).write(random_position(random));
+
+      write_world_property(instance, "Team"sv, std::to_string(random() % 3));
+      write_world_property(instance, "Layer"sv, "0"sv);
+      write_world_property(instance, "GeometryName"sv,
+                           indexed_name("bench_model_"sv, i % 16));
+   }
+
+   return world;
+}
+
+auto create_lvl(Input_platform platform, const Corpus_sizes& sizes) -> Ucfb_builder
+{
+   Ucfb_builder root{"ucfb"_mn};
+
+   const auto create_texture = [platform] {
+      if (platform == Input_platform::xbox) return create_texture_xbox;
+      if (platform == Input_platform::ps2) return create_texture_ps2;
+
+      return create_texture_pc;
+   }();
+
+   for (std::size_t i = 0; i < sizes.textures; ++i) {
+      root.add_child(create_texture(i, sizes));
+   }
+
+   if (platform != Input_platform::pc) return root;
+
+   for (std::size_t i = 0; i < sizes.configs; ++i) {
+      root.add_child(create_config(i, sizes));
+   }
+
+   for (std::size_t i = 0; i < sizes.models; ++i) {
+      root.add_child(create_model(i, sizes));
+   }
+
+   for (std::size_t i = 0; i < sizes.terrains; ++i) {
+      root.add_child(create_terrain(i, sizes));
+   }
+
+   for (std::size_t i = 0; i < sizes.worlds; ++i) {
+      root.add_child(create_world(i, sizes));
+   }
+
+   return root;
+}
+
+void add_corpus_names(Swbf_fnv_hashes& swbf_hashes, const Corpus_sizes& sizes)
+{
+   for (const auto name : property_names) swbf_hashes.add(std::string{name});
+
+   swbf_hashes.add("Team"s);
+   swbf_hashes.add("Layer"s);
+   swbf_hashes.add("Effect"s);
+
+   for (std::size_t i = 0; i < sizes.configs; ++i) {
+      swbf_hashes.add(indexed_name("bench_config_"sv, i));
+   }
+}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "app_options.hpp"
+#include "ucfb_builder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Swbf_fnv_hashes;
+
+namespace bench {
+
+//! \brief The amount of each kind of chunk in a synthetic corpus.
+struct Corpus_sizes {
+   std::size_t configs;
+   std::size_t config_properties;
+   std::size_t config_scopes;
+
+   std::size_t textures;
+   std::uint16_t texture_length;
+
+   std::size_t models;
+   std::size_t model_segments;
+   std::uint16_t segment_grid_length;
+
+   std::size_t terrains;
+   std::uint16_t terrain_grid_size;
+
+   std::size_t worlds;
+   std::size_t world_instances;
+   std::size_t world_regions;
+};
+
+//! \brief Gets the corpus sizes for a scale. The number of chunks grows linearly with
+//! the scale, the size of each chunk stays the same so per chunk timings can be compared
+//! across scales.
+auto corpus_sizes(std::size_t scale) noexcept -> Corpus_sizes;
+
+auto create_config(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_texture_pc(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_texture_xbox(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_texture_ps2(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_model(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_terrain(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+auto create_world(std::size_t index, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+//! \brief Creates a ucfb file holding every kind of chunk the platform has a generator
+//! for. PC files hold configs, textures, models, terrain and worlds. Xbox and PS2 files
+//! only hold textures.
+auto create_lvl(Input_platform platform, const Corpus_sizes& sizes) -> Ucfb_builder;
+
+//! \brief Adds the names used by the generated chunks to a hash dictionary so lookups
+//! of them succeed, as they would for a real file with a complete dictionary.
+void add_corpus_names(Swbf_fnv_hashes& swbf_hashes, const Corpus_sizes& sizes);
+
+}
@@ -0,0 +1,398 @@
+#include "benchmark.hpp"
+#include "app_options.hpp"
+#include "bench_corpus.hpp"
+#include "chunk_handlers.hpp"
+#include "file_saver.hpp"
+#include "layer_index.hpp"
+#include "logger.hpp"
+#include "magic_number.hpp"
+#include "mapped_file.hpp"
+#include "model_builder.hpp"
+#include "save_image.hpp"
+#include "swbf_fnv_hashes.hpp"
+#include "ucfb_reader.hpp"
+#include "write_behind.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+constexpr std::array container_chunks{
+   "ucfb"_mn, "lvl_"_mn, "tex_"_mn, "FMT_"_mn, "FACE"_mn, "LVL_"_mn,
+   "pal_"_mn, "modl"_mn, "segm"_mn, "tern"_mn, "PCHS"_mn, "PTCH"_mn,
+   "wrld"_mn, "inst"_mn, "regn"_mn, "fx__"_mn, "SCOP"_mn};
+
+struct Chunk {
+   Ucfb_reader chunk;
+   Ucfb_reader parent_reader;
+};
+
+struct Result {
+   std::string_view name;
+   std::size_t runs = 0;
+   std::uint64_t bytes = 0;
+   std::chrono::nanoseconds min{};
+   std::chrono::nanoseconds median{};
+};
+
+struct Corpus_file {
+   Mapped_file file;
+   std::vector<Chunk> chunks;
+
+   auto find(Magic_number magic_number) const -> std::vector<Chunk>
+   {
+      std::vector<Chunk> result;
+
+      std::copy_if(chunks.cbegin(), chunks.cend(), std::back_inserter(result),
+                   [magic_number](const Chunk& chunk) {
+                      return chunk.chunk.magic_number() == magic_number;
+                   });
+
+      return result;
+   }
+};
+
+auto write_corpus_file(const fs::path& path, Input_platform platform,
+                       const bench::Corpus_sizes& sizes) -> Corpus_file
+{
+   {
+      const auto buffer = bench::create_lvl(platform, sizes).create_buffer();
+
+      std::ofstream file{path, std::ios::binary};
+
+      if (!file.write(buffer.data(), buffer.size())) {
+         throw std::runtime_error{"Failed to write synthetic corpus."};
+      }
+   }
+
+   Corpus_file corpus{
+      .file = Mapped_file{path, Mapped_file::Access_pattern::random, true}};
+
+   Ucfb_reader root{corpus.file.bytes()};
+
+   while (root) {
+      const auto child = root.read_child();
+
+      corpus.chunks.push_back({child, root});
+   }
+
+   return corpus;
+}
+
+auto traverse(Ucfb_reader chunk) -> std::size_t
+{
+   std::size_t count = 1;
+
+   if (std::find(container_chunks.cbegin(), container_chunks.cend(),
+                 chunk.magic_number()) == container_chunks.cend()) {
+      return count;
+   }
+
+   // lvl name hash and lvl size left come before the children
+   if (chunk.magic_number() == "lvl_"_mn) chunk.consume(8);
+
+   while (chunk) count += traverse(chunk.read_child());
+
+   return count;
+}
+
+auto chunks_size(const std::vector<Chunk>& chunks) noexcept -> std::uint64_t
+{
+   std::uint64_t size = 0;
+
+   for (const auto& chunk : chunks) size += chunk.chunk.size() + 8;
+
+   return size;
+}
+
+auto directory_size(const fs::path& directory) -> std::uint64_t
+{
+   std::uint64_t size = 0;
+
+   for (const auto& entry : fs::recursive_directory_iterator{directory}) {
+      if (entry.is_regular_file()) size += entry.file_size();
+   }
+
+   return size;
+}
+
+auto create_images(const bench::Corpus_sizes& sizes) -> std::vector<DirectX::ScratchImage>
+{
+   std::minstd_rand random;
+   std::vector<DirectX::ScratchImage> images(sizes.textures);
+
+   for (auto& image : images) {
+      if (FAILED(image.Initialize2D(DXGI_FORMAT_B8G8R8A8_UNORM, sizes.texture_length,
+                                    sizes.texture_length, 1, 1))) {
+         throw std::runtime_error{"Failed to create benchmark image."};
+      }
+
+      const auto pixels = gsl::make_span(image.GetPixels(), image.GetPixelsSize());
+
+      for (auto& pixel : pixels) pixel = static_cast<std::uint8_t>(random());
+   }
+
+   return images;
+}
+
+//! Times a benchmark. Setup is called before each run to produce the state the run
+//! works on, run returns the number of bytes it processed or 0 to have the size of
+//! the files it wrote used instead. One extra run is done first to warm up caches.
+template<typename Setup, typename Run>
+auto measure(std::string_view name, std::size_t runs, const fs::path& output_directory,
+             Setup&& setup, Run&& run) -> Result
+{
+   const auto directory = output_directory / name;
+
+   Result result{.name = name, .runs = runs};
+   std::vector<std::chrono::nanoseconds> times;
+   times.reserve(runs);
+
+   for (std::size_t i = 0; i <= runs; ++i) {
+      fs::remove_all(directory);
+      fs::create_directories(directory);
+
+      File_saver file_saver{directory};
+      auto state = setup();
+
+      const auto start = std::chrono::steady_clock::now();
+
+      const std::uint64_t bytes = run(state, file_saver);
+
+      // Queued files are part of the work being timed.
+      write_behind::flush();
+
+      const auto end = std::chrono::steady_clock::now();
+
+      if (i == 0) continue;
+
+      times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+      result.bytes = bytes != 0 ? bytes : directory_size(directory);
+   }
+
+   std::sort(times.begin(), times.end());
+
+   result.min = times.front();
+   result.median = times[times.size() / 2];
+
+   return result;
+}
+
+auto no_setup() noexcept -> int
+{
+   return 0;
+}
+
+auto mib_per_second(const Result& result) noexcept -> double
+{
+   const auto seconds = std::chrono::duration<double>{result.min}.count();
+
+   if (seconds == 0.0) return 0.0;
+
+   return static_cast<double>(result.bytes) / (1024.0 * 1024.0) / seconds;
+}
+
+void write_results(const fs::path& path, const std::vector<Result>& results)
+{
+   std::ofstream file{path};
+
+   file << "benchmark,runs,bytes,min_ns,median_ns,mib_per_s\n"sv;
+   file << std::fixed << std::setprecision(2);
+
+   for (const auto& result : results) {
+      file << result.name << ',' << result.runs << ',' << result.bytes << ','
+           << result.min.count() << ',' << result.median.count() << ','
+           << mib_per_second(result) << '\n';
+   }
+
+   if (!file) throw std::runtime_error{"Failed to write benchmark results."};
+}
+}
+
+void run_benchmarks(const App_options& app_options, fs::path directory) noexcept
+{
+   try {
+      fs::create_directories(directory);
+
+      const auto sizes = bench::corpus_sizes(app_options.bench_scale());
+      const auto runs = std::max<std::size_t>(app_options.bench_runs(), 1);
+      const auto output_directory = directory / "output"sv;
+
+      logger::info("Generating synthetic corpus in "s, directory.string(), '\n');
+
+      const auto pc = write_corpus_file(directory / "bench_pc.lvl"sv, Input_platform::pc,
+                                        sizes);
+      const auto xbox = write_corpus_file(directory / "bench_xbox.lvl"sv,
+                                          Input_platform::xbox, sizes);
+      const auto ps2 = write_corpus_file(directory / "bench_ps2.lvl"sv,
+                                         Input_platform::ps2, sizes);
+
+      Swbf_fnv_hashes swbf_hashes;
+      bench::add_corpus_names(swbf_hashes, sizes);
+
+      const auto configs = pc.find("fx__"_mn);
+      const auto textures = pc.find("tex_"_mn);
+      const auto textures_xbox = xbox.find("tex_"_mn);
+      const auto textures_ps2 = ps2.find("tex_"_mn);
+      const auto models = pc.find("modl"_mn);
+      const auto terrains = pc.find("tern"_mn);
+      const auto worlds = pc.find("wrld"_mn);
+
+      const auto image_format = app_options.image_save_format();
+      const auto model_format = app_options.model_format();
+      const auto game_version = app_options.output_game_version();
+
+      const auto create_models = [&] {
+         auto builder = std::make_unique<model::Models_builder>();
+
+         for (const auto& model : models) handle_model(model.chunk, *builder);
+
+         return builder;
+      };
+
+      std::vector<Result> results;
+
+      const auto add = [&](std::string_view name, auto&& setup, auto&& run) {
+         logger::info("Running benchmark "s, name, '\n');
+
+         results.push_back(measure(name, runs, output_directory, setup, run));
+      };
+
+      add("ucfb_reader"sv, no_setup, [&](int, File_saver&) {
+         std::size_t count = 0;
+
+         for (const auto* corpus : {&pc, &xbox, &ps2}) {
+            count += traverse(Ucfb_reader{corpus->file.bytes()});
+         }
+
+         if (count == 0) throw std::logic_error{"No chunks traversed."};
+
+         return pc.file.bytes().size() + xbox.file.bytes().size() +
+                ps2.file.bytes().size();
+      });
+
+      add("handle_config"sv, no_setup, [&](int, File_saver& file_saver) {
+         for (const auto& config : configs) {
+            handle_config(config.chunk, file_saver, swbf_hashes, ".fx"sv, "effects"sv);
+         }
+
+         return chunks_size(configs);
+      });
+
+      add("handle_texture"sv, no_setup, [&](int, File_saver& file_saver) {
+         for (const auto& texture : textures) {
+            handle_texture(texture.chunk, file_saver, image_format, model_format);
+         }
+
+         return chunks_size(textures);
+      });
+
+      add("handle_texture_xbox"sv, no_setup, [&](int, File_saver& file_saver) {
+         for (const auto& texture : textures_xbox) {
+            handle_texture_xbox(texture.chunk, file_saver, image_format, model_format);
+         }
+
+         return chunks_size(textures_xbox);
+      });
+
+      add("handle_texture_ps2"sv, no_setup, [&](int, File_saver& file_saver) {
+         for (const auto& texture : textures_ps2) {
+            handle_texture_ps2(texture.chunk, texture.parent_reader, file_saver,
+                               image_format, model_format);
+         }
+
+         return chunks_size(textures_ps2);
+      });
+
+      add("handle_model"sv, [] { return std::make_unique<model::Models_builder>(); },
+          [&](std::unique_ptr<model::Models_builder>& builder, File_saver&) {
+             for (const auto& model : models) handle_model(model.chunk, *builder);
+
+             return chunks_size(models);
+          });
+
+      add("handle_terrain"sv, no_setup, [&](int, File_saver& file_saver) {
+         for (const auto& terrain : terrains) {
+            handle_terrain(terrain.chunk, game_version, file_saver);
+         }
+
+         return chunks_size(terrains);
+      });
+
+      add("handle_world"sv, [] { return std::make_unique<Layer_index>(); },
+          [&](std::unique_ptr<Layer_index>& layer_index, File_saver& file_saver) {
+             for (const auto& world : worlds) {
+                handle_world(world.chunk, file_saver, swbf_hashes, *layer_index);
+             }
+
+             return chunks_size(worlds);
+          });
+
+      for (const auto& [name, format] :
+           {std::pair{"save_image_tga"sv, Image_format::tga},
+            std::pair{"save_image_png"sv, Image_format::png},
+            std::pair{"save_image_dds"sv, Image_format::dds}}) {
+         add(name, [&] { return create_images(sizes); },
+             [&, format = format](std::vector<DirectX::ScratchImage>& images,
+                                  File_saver& file_saver) {
+                for (std::size_t i = 0; i < images.size(); ++i) {
+                   save_image("bench_image_"s += std::to_string(i), std::move(images[i]),
+                              file_saver, format, Model_format::msh);
+                }
+
+                return std::uint64_t{0};
+             });
+      }
+
+      for (const auto& [name, format] :
+           {std::pair{"save_models_msh"sv, Model_format::msh},
+            std::pair{"save_models_gltf2"sv, Model_format::gltf2}}) {
+         add(name, create_models,
+             [&, format = format](std::unique_ptr<model::Models_builder>& builder,
+                                  File_saver& file_saver) {
+                builder->save_models(file_saver, game_version, format,
+                                     Model_discard_flags::none);
+
+                return std::uint64_t{0};
+             });
+      }
+
+      add("save_file"sv, no_setup, [&](int, File_saver& file_saver) {
+         const std::string contents(64 * 1024, 'x');
+
+         for (std::size_t i = 0; i < 64 * sizes.configs; ++i) {
+            file_saver.save_file(contents, "files"sv, "bench_file_"s += std::to_string(i),
+                                 ".txt"sv);
+         }
+
+         return std::uint64_t{0};
+      });
+
+      write_results(directory / "benchmark.csv"sv, results);
+
+      for (const auto& result : results) {
+         const auto fastest =
+            std::chrono::duration_cast<std::chrono::microseconds>(result.min);
+
+         logger::info(result.name, ": "s,
+                      static_cast<std::uint64_t>(mib_per_second(result)),
+                      " MiB/s, fastest run "s, fastest.count(), "us\n"s);
+      }
+   }
+   catch (std::exception& e) {
+      logger::error("Exception occured while running benchmarks.\n   Directory: "s,
+                    directory.string(), '\n', "   Message: "s, e.what(), '\n');
+   }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <filesystem>
+
+class App_options;
+
+//! \brief Generates synthetic .lvl files in a directory and times reading them with
+//! Ucfb_reader, each chunk handler and each output writer.
+//!
+//! Results are written to benchmark.csv in the directory, one line per benchmark, with
+//! the columns "benchmark,runs,bytes,min_ns,median_ns,mib_per_s". For readers and
+//! handlers bytes is the size of the chunks read, for writers it is the size of the
+//! files written. The throughput is taken from the fastest run.
+void run_benchmarks(const App_options& app_options,
+                    std::filesystem::path directory) noexcept;
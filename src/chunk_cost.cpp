@@ -0,0 +1,89 @@
+#include "chunk_cost.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace std::literals;
+
+namespace {
+
+// Roughly the cost of creating and writing an output file, in bytes of processing.
+constexpr double file_output_cost = 16384.0;
+}
+
+Chunk_cost_model::Chunk_cost_model()
+   : _weights{// Decompressed, converted and encoded again on save.
+              {"tex_"_mn, {4.0, file_output_cost}},
+              {"tern"_mn, {3.0, file_output_cost}},
+              {"modl"_mn, {2.0, 0.0}},
+              {"wrld"_mn, {1.5, file_output_cost}},
+              // Mostly small properties.
+              {"entc"_mn, {0.5, file_output_cost}},
+              {"ordc"_mn, {0.5, file_output_cost}},
+              {"wpnc"_mn, {0.5, file_output_cost}},
+              {"expc"_mn, {0.5, file_output_cost}},
+              // Only add to a Models_builder, nothing is saved until later.
+              {"skel"_mn, {0.5, 0.0}},
+              {"coll"_mn, {1.0, 0.0}},
+              {"prim"_mn, {0.5, 0.0}},
+              {"CLTH"_mn, {1.0, 0.0}}},
+     _default_weight{1.0, file_output_cost}
+{
+}
+
+void Chunk_cost_model::load(const std::filesystem::path& path)
+{
+   std::ifstream input{path};
+
+   if (!input.is_open()) throw std::runtime_error{"Failed to open file"s};
+
+   for (std::string line; std::getline(input, line);) {
+      if (const auto comment = line.find('#'); comment != line.npos) {
+         line.resize(comment);
+      }
+
+      std::istringstream stream{line};
+      std::string magic_number;
+      Weight weight;
+
+      if (!(stream >> magic_number)) continue;
+
+      if (!(stream >> weight.per_byte >> weight.fixed) ||
+          (magic_number.size() != 4 && magic_number != "*"sv)) {
+         throw std::runtime_error{"Malformed cost model line: "s += line};
+      }
+
+      if (magic_number == "*"sv) {
+         _default_weight = weight;
+      }
+      else {
+         set_weight(create_magic_number(magic_number[0], magic_number[1],
+                                        magic_number[2], magic_number[3]),
+                    weight);
+      }
+   }
+}
+
+void Chunk_cost_model::set_weight(Magic_number magic_number, Weight weight) noexcept
+{
+   _weights[magic_number] = weight;
+}
+
+auto Chunk_cost_model::weight(Magic_number magic_number) const noexcept -> Weight
+{
+   if (const auto it = _weights.find(magic_number); it != _weights.cend()) {
+      return it->second;
+   }
+
+   return _default_weight;
+}
+
+auto Chunk_cost_model::estimate(Magic_number magic_number, std::size_t size) const noexcept
+   -> double
+{
+   const auto [per_byte, fixed] = weight(magic_number);
+
+   return fixed + per_byte * static_cast<double>(size);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "magic_number.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <unordered_map>
+
+//! \brief Estimates how long a chunk will take to process from its magic number
+//! and size. Used to start the most expensive chunks first.
+//!
+//! The cost of a chunk is "fixed + per_byte * size". The weights are relative, they
+//! only need to agree with each other, not with any real unit of time.
+class Chunk_cost_model {
+public:
+   struct Weight {
+      double per_byte = 1.0;
+      double fixed = 0.0;
+   };
+
+   //! \brief Creates a model with the built in weights.
+   Chunk_cost_model();
+
+   //! \brief Loads weights from a file, replacing the weights of any magic numbers it
+   //! names.
+   //!
+   //! Each line of the file is "<magic> <per_byte> <fixed>". A magic of '*' sets the
+   //! weight used for chunks not otherwise named. Text after a '#' is ignored.
+   //!
+   //! \exception std::runtime_error Thrown when the file can not be read or is malformed.
+   void load(const std::filesystem::path& path);
+
+   void set_weight(Magic_number magic_number, Weight weight) noexcept;
+
+   auto weight(Magic_number magic_number) const noexcept -> Weight;
+
+   auto estimate(Magic_number magic_number, std::size_t size) const noexcept -> double;
+
+private:
+   std::unordered_map<Magic_number, Weight> _weights;
+   Weight _default_weight;
+};
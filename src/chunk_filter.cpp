@@ -0,0 +1,217 @@
+#include "chunk_filter.hpp"
+#include "chunk_name.hpp"
+#include "string_helpers.hpp"
+#include "swbf_fnv_hashes.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+using namespace std::literals;
+
+namespace {
+
+bool is_container(const Magic_number magic_number) noexcept
+{
+   return magic_number == "ucfb"_mn || magic_number == "lvl_"_mn;
+}
+
+bool chars_equal(const char l, const char r) noexcept
+{
+   return std::tolower(static_cast<unsigned char>(l)) ==
+          std::tolower(static_cast<unsigned char>(r));
+}
+
+bool glob_match(std::string_view pattern, std::string_view string) noexcept
+{
+   std::size_t pattern_pos = 0;
+   std::size_t string_pos = 0;
+   std::size_t star_pos = pattern.npos;
+   std::size_t star_match = 0;
+
+   while (string_pos < string.size()) {
+      if (pattern_pos < pattern.size() &&
+          (pattern[pattern_pos] == '?' ||
+           (pattern[pattern_pos] != '*' &&
+            chars_equal(pattern[pattern_pos], string[string_pos])))) {
+         ++pattern_pos;
+         ++string_pos;
+      }
+      else if (pattern_pos < pattern.size() && pattern[pattern_pos] == '*') {
+         star_pos = pattern_pos++;
+         star_match = string_pos;
+      }
+      else if (star_pos != pattern.npos) {
+         pattern_pos = star_pos + 1;
+         string_pos = ++star_match;
+      }
+      else {
+         return false;
+      }
+   }
+
+   while (pattern_pos < pattern.size() && pattern[pattern_pos] == '*') ++pattern_pos;
+
+   return pattern_pos == pattern.size();
+}
+
+//! \brief Tests if a name pattern has no wildcards, so only one name matches it.
+bool is_literal(std::string_view pattern) noexcept
+{
+   return !pattern.empty() && pattern.find_first_of("*?"sv) == pattern.npos;
+}
+
+//! \brief Parses a name written as the hexadecimal string of its hash, the way names
+//! with unknown hashes are matched.
+auto parse_hash_name(std::string_view name) noexcept -> std::optional<std::uint32_t>
+{
+   if (name.size() < 3 || name[0] != '0' || !chars_equal(name[1], 'x')) {
+      return std::nullopt;
+   }
+
+   std::uint32_t hash = 0;
+
+   const auto [last, error] =
+      std::from_chars(name.data() + 2, name.data() + name.size(), hash, 16);
+
+   if (error != std::errc{} || last != name.data() + name.size()) return std::nullopt;
+
+   return hash;
+}
+
+auto read_name(Ucfb_reader chunk, const Swbf_fnv_hashes& swbf_hashes)
+   -> std::optional<std::string>
+{
+   const auto name = peek_chunk_name(chunk);
+
+   if (!name) return std::nullopt;
+   if (name->string) return std::string{*name->string};
+
+   // Names are only being tested, so hashes with no string mustn't be reported as
+   // unknown. They're matched by the same hexadecimal string lookup would give them.
+   if (const auto string = swbf_hashes.find(name->hash); string) {
+      return std::string{*string};
+   }
+
+   return to_hexstring(name->hash);
+}
+}
+
+void Chunk_filter::add_only_rules(std::string_view rules)
+{
+   parse_rules(rules, _only);
+}
+
+void Chunk_filter::add_skip_rules(std::string_view rules)
+{
+   parse_rules(rules, _skip);
+}
+
+bool Chunk_filter::empty() const noexcept
+{
+   return _only.empty() && _skip.empty();
+}
+
+bool Chunk_filter::may_accept(Magic_number magic_number) const noexcept
+{
+   if (empty() || is_container(magic_number)) return true;
+
+   const auto rejected_by_skip =
+      std::any_of(_skip.cbegin(), _skip.cend(), [magic_number](const Rule& rule) {
+         return rule.magic_number == magic_number && rule.name_pattern.empty();
+      });
+
+   if (rejected_by_skip) return false;
+   if (_only.empty()) return true;
+
+   return std::any_of(_only.cbegin(), _only.cend(), [magic_number](const Rule& rule) {
+      return !rule.magic_number || rule.magic_number == magic_number;
+   });
+}
+
+bool Chunk_filter::accepts(Ucfb_reader chunk,
+                           const Swbf_fnv_hashes& swbf_hashes) const noexcept
+{
+   const auto magic_number = chunk.magic_number();
+
+   if (!may_accept(magic_number)) return false;
+   if (empty() || is_container(magic_number)) return true;
+
+   // Only read the name if a rule needs it.
+   std::optional<std::string> name;
+
+   const auto test_rule = [&](const Rule& rule) {
+      if (!rule.name_pattern.empty() && !name) {
+         name = read_name(chunk, swbf_hashes);
+
+         if (!name) name.emplace();
+      }
+
+      return matches(rule, magic_number, name);
+   };
+
+   if (std::any_of(_skip.cbegin(), _skip.cend(), test_rule)) return false;
+   if (_only.empty()) return true;
+
+   return std::any_of(_only.cbegin(), _only.cend(), test_rule);
+}
+
+auto Chunk_filter::index_lookups() const -> std::optional<std::vector<Index_lookup>>
+{
+   if (_only.empty()) return std::nullopt;
+
+   std::vector<Index_lookup> lookups;
+   lookups.reserve(_only.size());
+
+   for (const auto& rule : _only) {
+      if (is_literal(rule.name_pattern)) {
+         lookups.push_back({rule.magic_number, fnv_1a_hash(rule.name_pattern)});
+
+         if (const auto hash = parse_hash_name(rule.name_pattern); hash) {
+            lookups.push_back({rule.magic_number, *hash});
+         }
+      }
+      else if (rule.magic_number) {
+         lookups.push_back({rule.magic_number, std::nullopt});
+      }
+      else {
+         return std::nullopt;
+      }
+   }
+
+   return lookups;
+}
+
+void Chunk_filter::parse_rules(std::string_view rules, std::vector<Rule>& out)
+{
+   for_each_substr(rules, ';', [&out](std::string_view rule) {
+      if (rule.empty()) return;
+
+      const auto [magic_number, name_pattern] = split_string(rule, ':');
+
+      Rule parsed{.magic_number = std::nullopt,
+                  .name_pattern = std::string{name_pattern}};
+
+      if (!magic_number.empty() && magic_number != "*"sv) {
+         if (magic_number.size() != 4) {
+            throw std::invalid_argument{
+               "Chunk filter rules must start with a four character magic number."};
+         }
+
+         parsed.magic_number = create_magic_number(magic_number[0], magic_number[1],
+                                                   magic_number[2], magic_number[3]);
+      }
+
+      out.emplace_back(std::move(parsed));
+   });
+}
+
+bool Chunk_filter::matches(const Rule& rule, Magic_number magic_number,
+                           const std::optional<std::string>& name) noexcept
+{
+   if (rule.magic_number && rule.magic_number != magic_number) return false;
+   if (rule.name_pattern.empty()) return true;
+
+   return name && glob_match(rule.name_pattern, *name);
+}
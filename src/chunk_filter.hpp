@@ -0,0 +1,70 @@
+#pragma once
+
+#include "magic_number.hpp"
+#include "ucfb_reader.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Swbf_fnv_hashes;
+
+//! \brief Selects which chunks are processed based on their magic number and name.
+//!
+//! Rules are written as "<magic>", "<magic>:<pattern>" or ":<pattern>", where the
+//! pattern is matched case insensitively against the name of the chunk with '*' and
+//! '?' wildcards. For example "tex_", "modl:rep_*" or ":*_dtl".
+//!
+//! A chunk is rejected if it matches any skip rule. If there are any only rules it
+//! must also match one of them. Container chunks (ucfb and lvl_) are always accepted.
+class Chunk_filter {
+public:
+   //! \brief Adds a list of rules, delimited by ';', that chunks must match.
+   //!
+   //! \exception std::invalid_argument Thrown when a rule is malformed.
+   void add_only_rules(std::string_view rules);
+
+   //! \brief Adds a list of rules, delimited by ';', that chunks must not match.
+   //!
+   //! \exception std::invalid_argument Thrown when a rule is malformed.
+   void add_skip_rules(std::string_view rules);
+
+   bool empty() const noexcept;
+
+   //! \brief Tests if a chunk could be accepted going by its magic number alone.
+   bool may_accept(Magic_number magic_number) const noexcept;
+
+   //! \brief Tests if a chunk is accepted.
+   bool accepts(Ucfb_reader chunk, const Swbf_fnv_hashes& swbf_hashes) const noexcept;
+
+   //! \brief A search of a Chunk_index, for chunks with a name hash or else a magic
+   //! number. Chunks found by name must also have the magic number if there is one.
+   struct Index_lookup {
+      std::optional<Magic_number> magic_number;
+      std::optional<std::uint32_t> name_hash;
+   };
+
+   //! \brief Gets the index searches that between them find every chunk the only rules
+   //! could accept, so the chunks can be looked up instead of walking the file. The
+   //! chunks found must still be tested with accepts.
+   //!
+   //! \return The lookups or nullopt if there are no only rules or one of them has
+   //!         neither a magic number nor a name without wildcards.
+   auto index_lookups() const -> std::optional<std::vector<Index_lookup>>;
+
+private:
+   struct Rule {
+      std::optional<Magic_number> magic_number;
+      std::string name_pattern;
+   };
+
+   static void parse_rules(std::string_view rules, std::vector<Rule>& out);
+
+   static bool matches(const Rule& rule, Magic_number magic_number,
+                       const std::optional<std::string>& name) noexcept;
+
+   std::vector<Rule> _only;
+   std::vector<Rule> _skip;
+};
@@ -8,6 +8,7 @@
 #include <string>
 
 class App_options;
+class Chunk_stream;
 class File_saver;
 class Layer_index;
 
@@ -23,6 +24,10 @@ void handle_ucfb(Ucfb_reader chunk, const App_options& app_options,
                  File_saver& file_saver, const Swbf_fnv_hashes& swbf_hashes,
                  Layer_index& layer_index);
 
+void handle_ucfb_streamed(Chunk_stream& stream, std::size_t memory_ceiling,
+                          const App_options& app_options, File_saver& file_saver,
+                          const Swbf_fnv_hashes& swbf_hashes, Layer_index& layer_index);
+
 void handle_lvl_child(Ucfb_reader lvl_child, const App_options& app_options,
                       File_saver& file_saver, const Swbf_fnv_hashes& swbf_hashes,
                       Layer_index& layer_index);
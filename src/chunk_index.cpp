@@ -0,0 +1,268 @@
+#include "chunk_index.hpp"
+#include "chunk_name.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+constexpr std::uint32_t index_version = 2;
+
+struct Index_header {
+   Magic_number magic_number = "cidx"_mn;
+   std::uint32_t version = index_version;
+   std::uint64_t file_size = 0;
+   //! Nanoseconds since the Unix epoch.
+   std::int64_t file_write_time = 0;
+   std::uint32_t entry_count = 0;
+   std::uint32_t padding = 0;
+};
+
+static_assert(sizeof(Index_header) == 32);
+
+auto align_offset(const std::uint64_t offset) noexcept -> std::uint64_t
+{
+   return (offset + 3) & ~std::uint64_t{3};
+}
+
+//! \brief Gets the time a file was last written in nanoseconds since the Unix epoch.
+//! file_clock's epoch and tick length are up to the standard library, so they aren't
+//! saved directly.
+auto get_file_write_time(const fs::path& file_path) -> std::int64_t
+{
+   const auto write_time = std::chrono::file_clock::to_sys(fs::last_write_time(file_path));
+
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             write_time.time_since_epoch())
+      .count();
+}
+
+void index_children(std::vector<Chunk_index::Entry>& entries,
+                    gsl::span<const std::byte> file, std::uint64_t offset,
+                    const std::uint64_t end, const std::uint32_t parent,
+                    const std::uint16_t depth)
+{
+   while (offset + 8 <= end) {
+      const Ucfb_reader chunk{
+         file.subspan(static_cast<std::ptrdiff_t>(offset),
+                      static_cast<std::ptrdiff_t>(end - offset))};
+      const auto name = peek_chunk_name(chunk);
+      const auto index = static_cast<std::uint32_t>(entries.size());
+
+      entries.push_back({.offset = offset,
+                         .size = static_cast<std::uint32_t>(chunk.size()),
+                         .magic_number = chunk.magic_number(),
+                         .parent = parent,
+                         .end = index + 1,
+                         .name_hash = name ? name->hash : 0,
+                         .depth = depth,
+                         .has_name = name.has_value(),
+                         .has_children = false});
+
+      const auto chunk_end = offset + 8 + chunk.size();
+
+      // lvl name hash and lvl size left come before the children
+      if (chunk.magic_number() == "lvl_"_mn && chunk.size() >= 8) {
+         index_children(entries, file, offset + 16, chunk_end, index, depth + 1);
+
+         entries[index].has_children = true;
+      }
+
+      entries[index].end = static_cast<std::uint32_t>(entries.size());
+
+      offset = align_offset(chunk_end);
+   }
+}
+}
+
+auto Chunk_index::build(gsl::span<const std::byte> file) -> Chunk_index
+{
+   const Ucfb_reader root{file};
+
+   if (root.magic_number() != "ucfb"_mn) {
+      throw std::runtime_error{"Root chunk is not ucfb as expected."};
+   }
+
+   Chunk_index index;
+
+   index._entries.reserve(256);
+   index._entries.push_back({.offset = 0,
+                             .size = static_cast<std::uint32_t>(root.size()),
+                             .magic_number = root.magic_number(),
+                             .parent = no_parent,
+                             .end = 1,
+                             .name_hash = 0,
+                             .depth = 0,
+                             .has_name = false,
+                             .has_children = true});
+
+   index_children(index._entries, file, 8, 8 + root.size(), 0, 1);
+
+   index._entries[0].end = static_cast<std::uint32_t>(index._entries.size());
+
+   index.build_lookup_tables();
+
+   return index;
+}
+
+auto Chunk_index::load(const fs::path& index_path, const fs::path& file_path)
+   -> std::optional<Chunk_index>
+{
+   std::ifstream input{index_path, std::ios::binary};
+
+   if (!input) return std::nullopt;
+
+   Index_header header;
+
+   if (!input.read(reinterpret_cast<char*>(&header), sizeof(header))) return std::nullopt;
+
+   if (header.magic_number != Index_header{}.magic_number ||
+       header.version != index_version || header.entry_count == 0 ||
+       header.file_size != fs::file_size(file_path) ||
+       header.file_write_time != get_file_write_time(file_path)) {
+      return std::nullopt;
+   }
+
+   Chunk_index index;
+
+   index._entries.resize(header.entry_count);
+
+   if (!input.read(reinterpret_cast<char*>(index._entries.data()),
+                   index._entries.size() * sizeof(Entry))) {
+      return std::nullopt;
+   }
+
+   for (std::uint32_t i = 0; i < header.entry_count; ++i) {
+      const auto& entry = index._entries[i];
+
+      if ((i != 0 && entry.parent >= i) || entry.end <= i ||
+          entry.end > header.entry_count ||
+          (entry.offset + 8 + entry.size) > header.file_size) {
+         return std::nullopt;
+      }
+   }
+
+   index.build_lookup_tables();
+
+   return index;
+}
+
+void Chunk_index::save(const fs::path& index_path, const fs::path& file_path) const
+{
+   std::ofstream output{index_path, std::ios::binary};
+
+   if (!output) throw std::runtime_error{"Failed to open index file for writing."};
+
+   const Index_header header{.file_size = fs::file_size(file_path),
+                             .file_write_time = get_file_write_time(file_path),
+                             .entry_count = static_cast<std::uint32_t>(_entries.size())};
+
+   output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   output.write(reinterpret_cast<const char*>(_entries.data()),
+                _entries.size() * sizeof(Entry));
+
+   if (!output) throw std::runtime_error{"Failed to write index file."};
+}
+
+auto Chunk_index::entries() const noexcept -> gsl::span<const Entry>
+{
+   return _entries;
+}
+
+auto Chunk_index::children(std::uint32_t index) const -> std::vector<std::uint32_t>
+{
+   std::vector<std::uint32_t> children;
+
+   for (auto i = index + 1; i < _entries[index].end; i = _entries[i].end) {
+      children.push_back(i);
+   }
+
+   return children;
+}
+
+auto Chunk_index::find(Magic_number magic_number) const -> std::vector<std::uint32_t>
+{
+   const auto first =
+      std::lower_bound(_by_magic_number.cbegin(), _by_magic_number.cend(), magic_number,
+                       [this](const std::uint32_t i, const Magic_number mn) {
+                          return _entries[i].magic_number < mn;
+                       });
+   const auto last =
+      std::upper_bound(first, _by_magic_number.cend(), magic_number,
+                       [this](const Magic_number mn, const std::uint32_t i) {
+                          return mn < _entries[i].magic_number;
+                       });
+
+   return {first, last};
+}
+
+auto Chunk_index::find_name(std::uint32_t name_hash) const -> std::vector<std::uint32_t>
+{
+   const auto first =
+      std::lower_bound(_by_name.cbegin(), _by_name.cend(), name_hash,
+                       [this](const std::uint32_t i, const std::uint32_t hash) {
+                          return _entries[i].name_hash < hash;
+                       });
+   const auto last =
+      std::upper_bound(first, _by_name.cend(), name_hash,
+                       [this](const std::uint32_t hash, const std::uint32_t i) {
+                          return hash < _entries[i].name_hash;
+                       });
+
+   return {first, last};
+}
+
+auto Chunk_index::reader(std::uint32_t index, gsl::span<const std::byte> file) const
+   -> Ucfb_reader
+{
+   const auto& entry = _entries.at(index);
+
+   return Ucfb_reader{file.subspan(static_cast<std::ptrdiff_t>(entry.offset),
+                                   static_cast<std::ptrdiff_t>(entry.size) + 8)};
+}
+
+auto Chunk_index::parent_reader(std::uint32_t index, gsl::span<const std::byte> file) const
+   -> Ucfb_reader
+{
+   const auto& entry = _entries.at(index);
+   const auto& parent = _entries.at(entry.parent);
+
+   auto reader = this->reader(entry.parent, file);
+
+   reader.consume(static_cast<std::size_t>((entry.offset + 8 + entry.size) -
+                                           (parent.offset + 8)));
+
+   return reader;
+}
+
+void Chunk_index::build_lookup_tables()
+{
+   _by_magic_number.resize(_entries.size());
+   _by_name.clear();
+
+   for (std::uint32_t i = 0; i < _entries.size(); ++i) {
+      _by_magic_number[i] = i;
+
+      if (_entries[i].has_name) _by_name.push_back(i);
+   }
+
+   std::stable_sort(_by_magic_number.begin(), _by_magic_number.end(),
+                    [this](const std::uint32_t l, const std::uint32_t r) {
+                       return _entries[l].magic_number < _entries[r].magic_number;
+                    });
+
+   std::stable_sort(_by_name.begin(), _by_name.end(),
+                    [this](const std::uint32_t l, const std::uint32_t r) {
+                       return _entries[l].name_hash < _entries[r].name_hash;
+                    });
+}
+
+auto get_chunk_index_path(const fs::path& file_path) -> fs::path
+{
+   return fs::path{file_path} += ".index"sv;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "magic_number.hpp"
+#include "ucfb_reader.hpp"
+
+#include <gsl/gsl>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+//! \brief A table of contents for a ucfb file.
+//!
+//! The index holds the root chunk, its children and the children of any lvl_ chunks
+//! (the same chunks handle_ucfb and handle_lvl_child walk) in the order they appear in
+//! the file. It can be saved next to the file it was built from so later runs can jump
+//! straight to the chunks they want.
+class Chunk_index {
+public:
+   constexpr static std::uint32_t no_parent = 0xffffffffu;
+
+   struct Entry {
+      //! Offset of the chunk's header from the start of the file.
+      std::uint64_t offset;
+      std::uint32_t size;
+      Magic_number magic_number;
+      std::uint32_t parent;
+      //! Index one past the last descendant of this chunk.
+      std::uint32_t end;
+      std::uint32_t name_hash;
+      std::uint16_t depth;
+      bool has_name;
+      bool has_children;
+   };
+
+   static_assert(std::is_trivially_copyable_v<Entry>);
+   static_assert(sizeof(Entry) == 32);
+
+   //! \brief Builds an index by walking a file.
+   //!
+   //! \param file The bytes of the file.
+   //!
+   //! \exception std::runtime_error Thrown when the file is not a valid ucfb file.
+   static auto build(gsl::span<const std::byte> file) -> Chunk_index;
+
+   //! \brief Loads an index previously saved with save.
+   //!
+   //! \param index_path The path to the index.
+   //! \param file_path The path to the file the index is for.
+   //!
+   //! \return The index or nullopt if it doesn't exist or is out of date.
+   static auto load(const std::filesystem::path& index_path,
+                    const std::filesystem::path& file_path) -> std::optional<Chunk_index>;
+
+   //! \brief Saves the index.
+   //!
+   //! \param index_path The path to save the index to.
+   //! \param file_path The path to the file the index is for.
+   //!
+   //! \exception std::runtime_error Thrown when the index could not be written.
+   void save(const std::filesystem::path& index_path,
+             const std::filesystem::path& file_path) const;
+
+   auto entries() const noexcept -> gsl::span<const Entry>;
+
+   //! \brief Gets the indices of the children of an entry.
+   auto children(std::uint32_t index) const -> std::vector<std::uint32_t>;
+
+   //! \brief Gets the indices of all entries with a magic number, in file order.
+   auto find(Magic_number magic_number) const -> std::vector<std::uint32_t>;
+
+   //! \brief Gets the indices of all entries with a name hash, in file order.
+   auto find_name(std::uint32_t name_hash) const -> std::vector<std::uint32_t>;
+
+   //! \brief Creates a reader for an entry.
+   //!
+   //! \param index The index of the entry.
+   //! \param file The bytes of the file the index was built from.
+   auto reader(std::uint32_t index, gsl::span<const std::byte> file) const
+      -> Ucfb_reader;
+
+   //! \brief Creates a reader for the parent of an entry with its read head placed
+   //! after the entry, as it would be after reading the entry with read_child.
+   //!
+   //! \param index The index of the entry. The entry must have a parent.
+   //! \param file The bytes of the file the index was built from.
+   auto parent_reader(std::uint32_t index, gsl::span<const std::byte> file) const
+      -> Ucfb_reader;
+
+private:
+   Chunk_index() = default;
+
+   void build_lookup_tables();
+
+   std::vector<Entry> _entries;
+   std::vector<std::uint32_t> _by_magic_number;
+   std::vector<std::uint32_t> _by_name;
+};
+
+//! \brief Gets the path an index for a file is saved at.
+auto get_chunk_index_path(const std::filesystem::path& file_path)
+   -> std::filesystem::path;
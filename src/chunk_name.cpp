@@ -0,0 +1,59 @@
+#include "chunk_name.hpp"
+#include "magic_number.hpp"
+#include "swbf_fnv_hashes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+
+namespace {
+
+// Config chunks store the hash of their name instead of the name itself.
+constexpr std::array hashed_name_chunks{
+   "fx__"_mn, "sky_"_mn, "prp_"_mn, "bnd_"_mn, "lght"_mn, "port"_mn, "path"_mn, "comb"_mn,
+   "sanm"_mn, "hud_"_mn, "load"_mn, "mcfg"_mn, "snd_"_mn, "mus_"_mn, "ffx_"_mn};
+
+bool has_hashed_name(const Magic_number mn) noexcept
+{
+   return std::find(std::cbegin(hashed_name_chunks), std::cend(hashed_name_chunks), mn) !=
+          std::cend(hashed_name_chunks);
+}
+
+auto make_name(const std::string_view string) noexcept -> Chunk_name
+{
+   return {fnv_1a_hash(string), string};
+}
+}
+
+auto peek_chunk_name(Ucfb_reader chunk) noexcept -> std::optional<Chunk_name>
+{
+   try {
+      if (chunk.magic_number() == "lvl_"_mn) {
+         return Chunk_name{chunk.read_trivial<std::uint32_t>()};
+      }
+
+      if (!chunk) return std::nullopt;
+
+      auto child = chunk.read_child();
+
+      if (child.magic_number() == "NAME"_mn) {
+         if (has_hashed_name(chunk.magic_number())) {
+            return Chunk_name{child.read_trivial<std::uint32_t>()};
+         }
+
+         return make_name(child.read_string());
+      }
+
+      // Object classes (entc, ordc, etc) have their base class first and then their
+      // own name.
+      if (child.magic_number() == "BASE"_mn && chunk) {
+         auto type = chunk.read_child_strict<"TYPE"_mn>();
+
+         return make_name(type.read_string());
+      }
+   }
+   catch (std::exception&) {
+   }
+
+   return std::nullopt;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ucfb_reader.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+//! \brief The name of an asset chunk.
+struct Chunk_name {
+   std::uint32_t hash = 0;
+
+   //! The name itself, not set for chunks that only store the hash of their name.
+   std::optional<std::string_view> string;
+};
+
+//! \brief Reads the name of an asset chunk (texture, model, config, object class etc)
+//! without processing the rest of it.
+//!
+//! \param chunk The chunk to read the name of.
+//!
+//! \return The name of the chunk or nullopt if the chunk has no known name.
+auto peek_chunk_name(Ucfb_reader chunk) noexcept -> std::optional<Chunk_name>;
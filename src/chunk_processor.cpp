@@ -2,9 +2,11 @@
 #include "chunk_processor.hpp"
 #include "chunk_handlers.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
 #include "magic_number.hpp"
+#include "output_dedup.hpp"
 #include "string_helpers.hpp"
-#include "synced_cout.hpp"
 #include "type_pun.hpp"
 
 #include "tbb/task_group.h"
@@ -343,19 +345,40 @@ void process_chunk(Ucfb_reader chunk, Ucfb_reader parent_reader,
                    const Swbf_fnv_hashes& swbf_hashes,
                    model::Models_builder& models_builder, Layer_index& layer_index)
 {
+   if (!app_options.chunk_filter().accepts(chunk, swbf_hashes)) return;
+
+   const instrumentation::Scope scope{"process_chunk"sv, chunk.magic_number(),
+                                      chunk.size()};
+
    const auto processor = chunk_processors.lookup(
       chunk.magic_number(), app_options.input_platform(), app_options.game_version());
 
    if (processor) {
       try {
-         processor({chunk, parent_reader, app_options, file_saver, swbf_hashes,
-                    models_builder, layer_index});
+         if (output_dedup::enabled() &&
+             output_dedup::dedupable(chunk.magic_number(), app_options.input_platform())) {
+            const auto key = output_dedup::chunk_key(chunk);
+
+            if (output_dedup::link_duplicate(key, file_saver)) return;
+
+            output_dedup::Recorder recorder{key, file_saver};
+            auto recording_saver = file_saver.create_recording(recorder);
+
+            processor({chunk, parent_reader, app_options, recording_saver, swbf_hashes,
+                       models_builder, layer_index});
+
+            recorder.publish();
+         }
+         else {
+            processor({chunk, parent_reader, app_options, file_saver, swbf_hashes,
+                       models_builder, layer_index});
+         }
       }
       catch (const std::exception& e) {
-         synced_cout::print("Error: Exception occured while processing chunk.\n"
-                            "   Type: "s,
-                            view_object_as_string(chunk.magic_number()), "\n   Size: "s,
-                            chunk.size(), "\n   Message: "s, e.what(), '\n');
+         logger::error("Exception occured while processing chunk.\n"
+                       "   Type: "s,
+                       view_object_as_string(chunk.magic_number()), "\n   Size: "s,
+                       chunk.size(), "\n   Message: "s, e.what(), '\n');
       }
    }
    else {
@@ -0,0 +1,310 @@
+
+#include "chunk_stream.hpp"
+#include "type_pun.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+Buffer_pool::Buffer::Buffer(Buffer_pool& pool, std::vector<std::byte> storage,
+                            std::size_t size) noexcept
+   : _pool{&pool}, _storage{std::move(storage)}, _size{size}
+{
+}
+
+Buffer_pool::Buffer::Buffer(Buffer&& other) noexcept
+   : _pool{std::exchange(other._pool, nullptr)},
+     _storage{std::move(other._storage)},
+     _size{std::exchange(other._size, 0)}
+{
+}
+
+Buffer_pool::Buffer::~Buffer()
+{
+   if (_pool) _pool->release(std::move(_storage), _size);
+}
+
+auto Buffer_pool::Buffer::span() noexcept -> gsl::span<std::byte>
+{
+   return {_storage.data(), static_cast<std::ptrdiff_t>(_size)};
+}
+
+auto Buffer_pool::Buffer::span() const noexcept -> gsl::span<const std::byte>
+{
+   return {_storage.data(), static_cast<std::ptrdiff_t>(_size)};
+}
+
+Buffer_pool::Buffer_pool(std::size_t memory_ceiling) noexcept
+   : _memory_ceiling{memory_ceiling}
+{
+}
+
+auto Buffer_pool::try_acquire(std::size_t size) -> std::optional<Buffer>
+{
+   std::vector<std::byte> storage;
+
+   {
+      std::lock_guard lock{_mutex};
+
+      if (_in_use != 0 && (_in_use + size) > _memory_ceiling) return std::nullopt;
+
+      _in_use += size;
+
+      auto best = std::end(_free);
+
+      for (auto it = std::begin(_free); it != std::end(_free); ++it) {
+         if (it->capacity() < size) continue;
+
+         if (best == std::end(_free) || it->capacity() < best->capacity()) best = it;
+      }
+
+      if (best != std::end(_free)) {
+         storage = std::move(*best);
+         _free_bytes -= storage.capacity();
+         _free.erase(best);
+      }
+   }
+
+   storage.resize(size);
+
+   return Buffer{*this, std::move(storage), size};
+}
+
+void Buffer_pool::release(std::vector<std::byte> storage, std::size_t size) noexcept
+{
+   std::lock_guard lock{_mutex};
+
+   _in_use -= size;
+
+   if ((_in_use + _free_bytes + storage.capacity()) > _memory_ceiling) return;
+
+   _free_bytes += storage.capacity();
+   _free.emplace_back(std::move(storage));
+}
+
+#ifdef _WIN32
+
+Chunk_stream::Chunk_stream(const fs::path& path)
+{
+   if (path == "-") {
+      _handle = GetStdHandle(STD_INPUT_HANDLE);
+      _pipe = true;
+   }
+   else {
+      _handle = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+   }
+
+   if (_handle == INVALID_HANDLE_VALUE || _handle == nullptr) {
+      throw std::invalid_argument{"File does not exist."};
+   }
+}
+
+Chunk_stream::~Chunk_stream()
+{
+   if (!_pipe) CloseHandle(_handle);
+}
+
+auto Chunk_stream::read_some(std::uint64_t offset, gsl::span<std::byte> output)
+   -> std::size_t
+{
+   const auto size = static_cast<DWORD>(std::min<std::size_t>(
+      output.size(), std::numeric_limits<DWORD>::max()));
+   DWORD read = 0;
+
+   if (_pipe) {
+      if (!ReadFile(_handle, output.data(), size, &read, nullptr)) {
+         if (GetLastError() == ERROR_BROKEN_PIPE) return 0;
+
+         throw std::runtime_error{"Failed to read from input."};
+      }
+
+      return read;
+   }
+
+   OVERLAPPED overlapped{};
+   overlapped.Offset = static_cast<DWORD>(offset & 0xffffffffu);
+   overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32u);
+
+   if (!ReadFile(_handle, output.data(), size, &read, &overlapped)) {
+      if (GetLastError() == ERROR_HANDLE_EOF) return 0;
+
+      throw std::runtime_error{"Failed to read from input."};
+   }
+
+   return read;
+}
+
+#else
+
+Chunk_stream::Chunk_stream(const fs::path& path)
+{
+   if (path == "-") {
+      _fd = STDIN_FILENO;
+      _pipe = true;
+
+      return;
+   }
+
+   _fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+   if (_fd == -1) throw std::invalid_argument{"File does not exist."};
+
+   posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+Chunk_stream::~Chunk_stream()
+{
+   if (!_pipe) close(_fd);
+}
+
+auto Chunk_stream::read_some(std::uint64_t offset, gsl::span<std::byte> output)
+   -> std::size_t
+{
+   for (;;) {
+      const auto result = _pipe ? ::read(_fd, output.data(), output.size())
+                                : pread(_fd, output.data(), output.size(),
+                                        static_cast<off_t>(offset));
+
+      if (result >= 0) return static_cast<std::size_t>(result);
+      if (errno != EINTR) throw std::runtime_error{"Failed to read from input."};
+   }
+}
+
+#endif
+
+auto Chunk_stream::read_header(std::uint64_t offset) -> Header
+{
+   std::array<std::byte, 8> bytes;
+
+   if (_pipe) {
+      if (offset < _pipe_buffer_offset) {
+         throw std::runtime_error{"Attempt to seek backwards in a non-seekable input."};
+      }
+
+      fill_pipe_buffer(offset + bytes.size());
+
+      std::memcpy(bytes.data(), &_pipe_buffer[offset - _pipe_buffer_offset],
+                  bytes.size());
+   }
+   else {
+      read_exact(offset, bytes);
+   }
+
+   return {reinterpret_span_as<Magic_number>(
+              gsl::span<const std::byte, 4>{&bytes[0], 4}),
+           reinterpret_span_as<std::uint32_t>(
+              gsl::span<const std::byte, 4>{&bytes[4], 4})};
+}
+
+void Chunk_stream::read(std::uint64_t offset, gsl::span<std::byte> output)
+{
+   if (!_pipe) return read_exact(offset, output);
+
+   if (offset < _pipe_buffer_offset) {
+      throw std::runtime_error{"Attempt to seek backwards in a non-seekable input."};
+   }
+
+   const auto end = offset + output.size();
+
+   // Take what we can from the bytes buffered by read_header.
+   if (offset < _pipe_position) {
+      const auto buffered =
+         static_cast<std::size_t>(std::min(end, _pipe_position) - offset);
+
+      std::memcpy(output.data(), &_pipe_buffer[offset - _pipe_buffer_offset], buffered);
+
+      output = output.subspan(buffered);
+   }
+
+   // Discard everything up to the end of this read, we can never go back to it.
+   const auto consumed =
+      static_cast<std::size_t>(std::min(end, _pipe_position) - _pipe_buffer_offset);
+
+   _pipe_buffer.erase(_pipe_buffer.begin(), _pipe_buffer.begin() + consumed);
+   _pipe_buffer_offset += consumed;
+
+   if (output.empty()) return;
+
+   if (offset > _pipe_position) discard(offset);
+
+   read_exact(_pipe_position, output);
+
+   _pipe_position += output.size();
+   _pipe_buffer_offset = _pipe_position;
+}
+
+void Chunk_stream::discard(std::uint64_t end)
+{
+   if (!_pipe || end <= _pipe_buffer_offset) return;
+
+   if (end < _pipe_position) {
+      const auto consumed = static_cast<std::size_t>(end - _pipe_buffer_offset);
+
+      _pipe_buffer.erase(_pipe_buffer.begin(), _pipe_buffer.begin() + consumed);
+      _pipe_buffer_offset = end;
+
+      return;
+   }
+
+   _pipe_buffer.clear();
+
+   std::array<std::byte, 65536> scratch;
+
+   while (_pipe_position < end) {
+      const auto size = static_cast<std::size_t>(
+         std::min<std::uint64_t>(end - _pipe_position, scratch.size()));
+
+      read_exact(_pipe_position, {scratch.data(), static_cast<std::ptrdiff_t>(size)});
+
+      _pipe_position += size;
+   }
+
+   _pipe_buffer_offset = _pipe_position;
+}
+
+bool Chunk_stream::is_pipe() const noexcept
+{
+   return _pipe;
+}
+
+void Chunk_stream::read_exact(std::uint64_t offset, gsl::span<std::byte> output)
+{
+   while (!output.empty()) {
+      const auto read = read_some(offset, output);
+
+      if (read == 0) throw std::runtime_error{"Unexpected end of file."};
+
+      offset += read;
+      output = output.subspan(read);
+   }
+}
+
+void Chunk_stream::fill_pipe_buffer(std::uint64_t end)
+{
+   if (end <= _pipe_position) return;
+
+   const auto old_size = _pipe_buffer.size();
+   const auto size = static_cast<std::size_t>(end - _pipe_position);
+
+   _pipe_buffer.resize(old_size + size);
+
+   read_exact(_pipe_position,
+              {_pipe_buffer.data() + old_size, static_cast<std::ptrdiff_t>(size)});
+
+   _pipe_position = end;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "magic_number.hpp"
+
+#include <gsl/gsl>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+//! \brief A pool of reusable byte buffers with an upper limit on how much memory
+//! may be handed out at once.
+class Buffer_pool {
+public:
+   //! \brief A buffer acquired from the pool. Returns its storage to the pool when
+   //! destroyed.
+   class Buffer {
+   public:
+      Buffer(Buffer&& other) noexcept;
+      Buffer& operator=(Buffer&& other) = delete;
+
+      Buffer(const Buffer&) = delete;
+      Buffer& operator=(const Buffer&) = delete;
+
+      ~Buffer();
+
+      auto span() noexcept -> gsl::span<std::byte>;
+
+      auto span() const noexcept -> gsl::span<const std::byte>;
+
+   private:
+      friend class Buffer_pool;
+
+      Buffer(Buffer_pool& pool, std::vector<std::byte> storage, std::size_t size) noexcept;
+
+      Buffer_pool* _pool;
+      std::vector<std::byte> _storage;
+      std::size_t _size;
+   };
+
+   explicit Buffer_pool(std::size_t memory_ceiling) noexcept;
+
+   Buffer_pool(const Buffer_pool&) = delete;
+   Buffer_pool& operator=(const Buffer_pool&) = delete;
+
+   //! \brief Attempts to acquire a buffer.
+   //!
+   //! \param size The size of the buffer.
+   //!
+   //! \return The buffer or nullopt if handing it out would exceed the memory ceiling.
+   //!         A request larger than the ceiling itself is only granted when no other
+   //!         buffers are in use.
+   auto try_acquire(std::size_t size) -> std::optional<Buffer>;
+
+private:
+   void release(std::vector<std::byte> storage, std::size_t size) noexcept;
+
+   const std::size_t _memory_ceiling;
+
+   std::mutex _mutex;
+   std::size_t _in_use = 0;
+   std::size_t _free_bytes = 0;
+   std::vector<std::vector<std::byte>> _free;
+};
+
+//! \brief A source of ucfb chunks that reads them on demand with positional reads
+//! instead of mapping the whole file.
+//!
+//! Reading from standard input (a path of "-") is supported as well. In that case reads
+//! must move forward through the stream, headers read with read_header are retained
+//! until they are consumed by read.
+class Chunk_stream {
+public:
+   struct Header {
+      Magic_number magic_number;
+      std::uint32_t size;
+   };
+
+   explicit Chunk_stream(const std::filesystem::path& path);
+
+   Chunk_stream(const Chunk_stream&) = delete;
+   Chunk_stream& operator=(const Chunk_stream&) = delete;
+
+   ~Chunk_stream();
+
+   //! \brief Reads the header of the chunk at an offset.
+   //!
+   //! \exception std::runtime_error Thrown when the read fails or hits end of file.
+   auto read_header(std::uint64_t offset) -> Header;
+
+   //! \brief Reads a range of bytes.
+   //!
+   //! \exception std::runtime_error Thrown when the read fails or hits end of file.
+   void read(std::uint64_t offset, gsl::span<std::byte> output);
+
+   //! \brief Marks everything before an offset as unneeded. For non-seekable inputs the
+   //! bytes are read and thrown away in small pieces, for others this does nothing.
+   //!
+   //! \exception std::runtime_error Thrown when the read fails or hits end of file.
+   void discard(std::uint64_t end);
+
+   bool is_pipe() const noexcept;
+
+private:
+   auto read_some(std::uint64_t offset, gsl::span<std::byte> output) -> std::size_t;
+
+   void read_exact(std::uint64_t offset, gsl::span<std::byte> output);
+
+   void fill_pipe_buffer(std::uint64_t end);
+
+#ifdef _WIN32
+   void* _handle = nullptr;
+#else
+   int _fd = -1;
+#endif
+   bool _pipe = false;
+
+   std::uint64_t _pipe_position = 0;
+   std::uint64_t _pipe_buffer_offset = 0;
+   std::vector<std::byte> _pipe_buffer;
+};
@@ -0,0 +1,130 @@
+#include "create_swbf_hashes.hpp"
+#include "app_options.hpp"
+#include "logger.hpp"
+
+#include <array>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+constexpr std::array common_layer_suffixes{"_1ctf"sv
+                                           "_1flag"sv
+                                           "_Buildings"sv
+                                           "_Buildings01"sv
+                                           "_Buildings02"sv
+                                           "_CP-Assult"sv
+                                           "_CP-Conquest"sv
+                                           "_CP-VehicleSpawns"sv
+                                           "_CP-VehicleSpawns"sv
+                                           "_CPs"sv
+                                           "_CommonDesign"sv
+                                           "_CW-Ships"sv
+                                           "_GCW-Ships"sv
+                                           "_Damage"sv
+                                           "_Damage01"sv
+                                           "_Damage02"sv
+                                           "_Death"sv
+                                           "_DeathRegions"sv
+                                           "_Design"sv
+                                           "_Design001"sv
+                                           "_Design002"sv
+                                           "_Design01"sv
+                                           "_Design02"sv
+                                           "_Design1"sv
+                                           "_Design2"sv
+                                           "_Doors"sv
+                                           "_Layer000"sv
+                                           "_Layer001"sv
+                                           "_Layer002"sv
+                                           "_Layer003"sv
+                                           "_Layer004"sv
+                                           "_Light_RG"sv
+                                           "_NewObjective"sv
+                                           "_Objective"sv
+                                           "_Platforms"sv
+                                           "_Props"sv
+                                           "_RainShadow"sv
+                                           "_Roids"sv
+                                           "_Roids01"sv
+                                           "_Roids02"sv
+                                           "_Shadow_RGN"sv
+                                           "_Shadows"sv
+                                           "_Shields"sv
+                                           "_SoundEmmiters"sv
+                                           "_SoundRegions"sv
+                                           "_SoundSpaces"sv
+                                           "_SoundTriggers"sv
+                                           "_Temp"sv
+                                           "_Tree"sv
+                                           "_Trees"sv
+                                           "_Vehicles"sv
+                                           "_animations"sv
+                                           "_campaign"sv
+                                           "_collision"sv
+                                           "_con"sv
+                                           "_conquest"sv
+                                           "_ctf"sv
+                                           "_deathreagen"sv
+                                           "_droids"sv
+                                           "_eli"sv
+                                           "_flags"sv
+                                           "_gunship"sv
+                                           "_hunt"sv
+                                           "_invisocube"sv
+                                           "_light_region"sv
+                                           "_objects01"sv
+                                           "_objects02"sv
+                                           "_reflections"sv
+                                           "_rumble"sv
+                                           "_rumbles"sv
+                                           "_sound"sv
+                                           "_tdm"sv
+                                           "_trees"sv
+                                           "_turrets"sv
+                                           "_xl"sv};
+
+}
+
+auto create_swbf_hashes(const App_options& options)
+   -> std::shared_ptr<const Swbf_fnv_hashes>
+{
+   auto swbf_hashes = std::make_shared<Swbf_fnv_hashes>();
+
+   if (!options.user_string_dict().empty()) {
+
+      if (fs::exists(options.user_string_dict())) {
+         try {
+            read_swbf_fnv_hash_dictionary(*swbf_hashes, options.user_string_dict());
+         }
+         catch (std::exception& e) {
+            logger::error(
+               "Exception occured while reading string dictionary.\n   Path: "s,
+               options.user_string_dict(), '\n', "   Message: "s, e.what(), '\n');
+         }
+      }
+      else {
+         logger::error("file '"s, options.user_string_dict(), "' does not exist\n");
+      }
+   }
+
+   for (const auto& input_file : options.input_files()) {
+      const auto name = fs::path{input_file}.stem().string();
+
+      swbf_hashes->add(name);
+      swbf_hashes->add("mapname.description."s += name);
+      swbf_hashes->add("mapname.name."s += name);
+
+      for (const auto& suffix : common_layer_suffixes) {
+         swbf_hashes->add(std::string{name} += suffix);
+      }
+   }
+
+   return swbf_hashes;
+}
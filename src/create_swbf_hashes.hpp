@@ -0,0 +1,17 @@
+#pragma once
+
+#include "swbf_fnv_hashes.hpp"
+
+#include <memory>
+
+class App_options;
+
+//! \brief Creates the dictionary used to look up hashes in the input files.
+//!
+//! Holds the strings from the user's string dictionary (-string_dict) along with strings
+//! derived from the name of each input file, such as its localization keys and common
+//! layer names. None of these depend on the file being processed, so the dictionary is
+//! created once and each file is given an overlay of it, see
+//! Swbf_fnv_hashes(std::shared_ptr<const Swbf_fnv_hashes>).
+auto create_swbf_hashes(const App_options& options)
+   -> std::shared_ptr<const Swbf_fnv_hashes>;
@@ -74,7 +74,7 @@ void write_data_chunk(Ucfb_reader chunk, File_saver& file_saver, const std::size
    buffer.reserve(data.size());
    buffer.append(data.data(), data.size());
 
-   file_saver.save_file(buffer, "", name, ".chunk");
+   file_saver.save_file(std::move(buffer), "", name, ".chunk");
 }
 }
 
@@ -0,0 +1,318 @@
+#include "extract_scheduler.hpp"
+#include "app_options.hpp"
+#include "chunk_filter.hpp"
+#include "chunk_index.hpp"
+#include "chunk_processor.hpp"
+#include "file_saver.hpp"
+#include "instrumentation.hpp"
+#include "layer_index.hpp"
+#include "logger.hpp"
+#include "mapped_file.hpp"
+#include "model_builder.hpp"
+#include "output_sink.hpp"
+
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <list>
+#include <optional>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+struct Extract_scheduler::File_state {
+   File_state(const fs::path& path, const fs::path& output_directory,
+              Swbf_fnv_hashes swbf_hashes, const App_options& app_options)
+      : path{path},
+        file{path},
+        file_saver{output_directory, app_options.verbose(),
+                   create_output_sink(output_directory, app_options.archive_output())},
+        swbf_hashes{std::move(swbf_hashes)},
+        instrumentation_id{instrumentation::register_file(path.string())}
+   {
+   }
+
+   const fs::path path;
+   //! Only the chunk headers are read until the file's first job starts, the file is
+   //! read ahead then.
+   Mapped_file file;
+   std::atomic_bool prefetched = false;
+   File_saver file_saver;
+   const Swbf_fnv_hashes swbf_hashes;
+   Layer_index layer_index;
+   const instrumentation::File_id instrumentation_id;
+
+   model::Models_builder models_builder;
+   std::list<model::Models_builder> lvl_models_builders;
+
+   std::atomic_size_t remaining_jobs = 0;
+};
+
+namespace {
+
+auto load_chunk_index(const fs::path& path, const Mapped_file& file) -> Chunk_index
+{
+   const auto index_path = get_chunk_index_path(path);
+
+   if (auto index = Chunk_index::load(index_path, path); index) return std::move(*index);
+
+   auto index = Chunk_index::build(file.bytes());
+
+   try {
+      index.save(index_path, path);
+   }
+   catch (std::exception& e) {
+      logger::warning("Unable to save chunk index.\n   Path: "s,
+                      index_path.string(), '\n', "   Message: "s, e.what(), '\n');
+   }
+
+   return index;
+}
+
+//! \brief Gets the entries of an index that are processed, the children of the root and
+//! of any lvl_ chunks, in file order.
+auto find_chunks(const Chunk_index& index) -> std::vector<std::uint32_t>
+{
+   std::vector<std::uint32_t> chunks;
+   chunks.reserve(index.entries().size());
+
+   for (const auto child : index.children(0)) {
+      if (!index.entries()[child].has_children) {
+         chunks.push_back(child);
+
+         continue;
+      }
+
+      const auto lvl_children = index.children(child);
+
+      chunks.insert(chunks.end(), lvl_children.cbegin(), lvl_children.cend());
+   }
+
+   return chunks;
+}
+
+//! \brief Gets the entries of an index that are processed and found by a chunk
+//! filter's lookups, in file order.
+auto find_chunks(const Chunk_index& index,
+                 gsl::span<const Chunk_filter::Index_lookup> lookups)
+   -> std::vector<std::uint32_t>
+{
+   const auto entries = index.entries();
+
+   // Chunks nested in the children of lvl_ chunks are indexed but not processed on
+   // their own.
+   const auto is_processed = [](const Chunk_index::Entry& entry) {
+      return (entry.depth == 1 && !entry.has_children) || entry.depth == 2;
+   };
+
+   std::vector<std::uint32_t> chunks;
+
+   for (const auto& lookup : lookups) {
+      const auto found = lookup.name_hash ? index.find_name(*lookup.name_hash)
+                                          : index.find(*lookup.magic_number);
+
+      for (const auto i : found) {
+         if (!is_processed(entries[i])) continue;
+
+         if (lookup.magic_number && entries[i].magic_number != *lookup.magic_number) {
+            continue;
+         }
+
+         chunks.push_back(i);
+      }
+   }
+
+   std::sort(chunks.begin(), chunks.end());
+   chunks.erase(std::unique(chunks.begin(), chunks.end()), chunks.end());
+
+   return chunks;
+}
+
+void save_models(model::Models_builder& models_builder, const App_options& app_options,
+                 File_saver& file_saver)
+{
+   models_builder.save_models(file_saver, app_options.output_game_version(),
+                              app_options.model_format(),
+                              app_options.model_discard_flags());
+}
+}
+
+Extract_scheduler::Extract_scheduler(const App_options& app_options)
+   : _app_options{app_options}
+{
+   if (app_options.cost_model_file().empty()) return;
+
+   try {
+      _cost_model.load(app_options.cost_model_file());
+   }
+   catch (std::exception& e) {
+      logger::warning("Unable to load cost model, using built in weights.\n"
+                      "   Path: "s,
+                      app_options.cost_model_file(), '\n', "   Message: "s, e.what(),
+                      '\n');
+   }
+}
+
+Extract_scheduler::~Extract_scheduler() = default;
+
+void Extract_scheduler::add_file(const fs::path& path, const fs::path& output_directory,
+                                 Swbf_fnv_hashes swbf_hashes)
+{
+   const instrumentation::File_scope file_scope{
+      instrumentation::register_file(path.string())};
+   const instrumentation::Scope scope{"open_file"sv};
+
+   auto file = std::make_unique<File_state>(path, output_directory,
+                                            std::move(swbf_hashes), _app_options);
+   const auto bytes = file->file.bytes();
+   const auto& chunk_filter = _app_options.chunk_filter();
+
+   std::vector<Job> jobs;
+   jobs.reserve(64);
+
+   const auto add_job = [&](Ucfb_reader chunk, Ucfb_reader parent_reader,
+                            model::Models_builder& models_builder) {
+      if (!chunk_filter.may_accept(chunk.magic_number())) return;
+
+      jobs.push_back({chunk, parent_reader, file.get(), &models_builder,
+                      _cost_model.estimate(chunk.magic_number(), chunk.size())});
+   };
+
+   if (_app_options.use_chunk_index()) {
+      const auto index = load_chunk_index(path, file->file);
+
+      // With only rules the chunks they could accept are looked up, instead of
+      // visiting every chunk in the file.
+      const auto lookups = chunk_filter.index_lookups();
+      const auto chunks = lookups ? find_chunks(index, *lookups) : find_chunks(index);
+
+      std::uint32_t lvl = Chunk_index::no_parent;
+      model::Models_builder* lvl_models_builder = nullptr;
+
+      for (const auto chunk : chunks) {
+         const auto parent = index.entries()[chunk].parent;
+
+         if (parent == 0) {
+            add_job(index.reader(chunk, bytes), index.parent_reader(chunk, bytes),
+                    file->models_builder);
+
+            continue;
+         }
+
+         if (parent != lvl) {
+            lvl = parent;
+            lvl_models_builder = &file->lvl_models_builders.emplace_back();
+         }
+
+         add_job(index.reader(chunk, bytes), index.parent_reader(chunk, bytes),
+                 *lvl_models_builder);
+      }
+   }
+   else {
+      Ucfb_reader root{bytes};
+
+      if (root.magic_number() != "ucfb"_mn) {
+         throw std::runtime_error{"Root chunk is not ucfb as expected."};
+      }
+
+      while (root) {
+         auto child = root.read_child();
+
+         if (child.magic_number() != "lvl_"_mn) {
+            add_job(child, root, file->models_builder);
+
+            continue;
+         }
+
+         child.consume(4); // lvl name hash
+         child.consume(4); // lvl size left
+
+         auto& lvl_models_builder = file->lvl_models_builders.emplace_back();
+
+         while (child) add_job(child.read_child(), child, lvl_models_builder);
+      }
+   }
+
+   file->remaining_jobs = jobs.size();
+
+   logger::info("Processing File: "s, path.string(), '\n');
+
+   std::lock_guard lock{_mutex};
+
+   _jobs.insert(_jobs.end(), jobs.cbegin(), jobs.cend());
+   _files.emplace_back(std::move(file));
+}
+
+void Extract_scheduler::run()
+{
+   for (auto& file : _files) {
+      if (file->remaining_jobs == 0) finish_file(*file);
+   }
+
+   std::stable_sort(_jobs.begin(), _jobs.end(), [](const Job& l, const Job& r) {
+      return l.cost > r.cost;
+   });
+
+   // Each worker pulls the next job from the front of the queue, this keeps the jobs
+   // starting in order of cost (a parallel_for over the jobs would split them into
+   // ranges and lose that).
+   std::atomic_size_t next_job = 0;
+   tbb::task_group workers;
+
+   const auto worker = [this, &next_job] {
+      for (auto i = next_job++; i < _jobs.size(); i = next_job++) run_job(_jobs[i]);
+   };
+
+   for (auto i = 0; i < tbb::this_task_arena::max_concurrency(); ++i) {
+      workers.run(worker);
+   }
+
+   workers.wait();
+
+   _jobs.clear();
+   _files.clear();
+}
+
+void Extract_scheduler::run_job(const Job& job)
+{
+   auto& file = *job.file;
+
+   const instrumentation::File_scope file_scope{file.instrumentation_id};
+
+   if (!file.prefetched.exchange(true)) {
+      file.file.prefetch(Mapped_file::Access_pattern::random,
+                         _app_options.prefault_files());
+   }
+
+   process_chunk(job.chunk, job.parent_reader, _app_options, file.file_saver,
+                 file.swbf_hashes, *job.models_builder, file.layer_index);
+
+   if (--file.remaining_jobs == 0) finish_file(file);
+}
+
+void Extract_scheduler::finish_file(File_state& file) noexcept
+{
+   const instrumentation::File_scope file_scope{file.instrumentation_id};
+   const instrumentation::Scope scope{"finish_file"sv};
+
+   try {
+      for (auto& lvl_models_builder : file.lvl_models_builders) {
+         save_models(lvl_models_builder, _app_options, file.file_saver);
+      }
+
+      save_models(file.models_builder, _app_options, file.file_saver);
+
+      file.layer_index.save(file.file_saver);
+   }
+   catch (std::exception& e) {
+      logger::error("Exception occured while processing file.\n   File: "s,
+                    file.path.string(), '\n', "   Message: "s, e.what(), '\n');
+   }
+
+   // Nothing refers to the file's bytes anymore, so there is no need to keep it mapped.
+   file.file = Mapped_file{};
+}
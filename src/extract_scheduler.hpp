@@ -0,0 +1,71 @@
+#pragma once
+
+#include "chunk_cost.hpp"
+#include "swbf_fnv_hashes.hpp"
+#include "ucfb_reader.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class App_options;
+
+namespace model {
+class Models_builder;
+}
+
+//! \brief Extracts many files from one shared queue of chunks.
+//!
+//! The children of every file's root chunk (and the children of any lvl_ chunks) are
+//! gathered into a single queue and processed most expensive first (as estimated by
+//! Chunk_cost_model), so a huge chunk in one file starts early instead of leaving a
+//! long tail after everything else is done.
+//! Files are mapped when added but only read ahead once their first chunk starts, so
+//! queueing a large install doesn't ask for all of it to be read at once.
+//! A file's models and layer index are saved as soon as its last chunk finishes.
+class Extract_scheduler {
+public:
+   explicit Extract_scheduler(const App_options& app_options);
+
+   Extract_scheduler(const Extract_scheduler&) = delete;
+   Extract_scheduler& operator=(const Extract_scheduler&) = delete;
+
+   ~Extract_scheduler();
+
+   //! \brief Maps a file and queues its chunks. Safe to call from multiple threads.
+   //!
+   //! \param path The path of the file.
+   //! \param output_directory The directory to save the file's contents to.
+   //! \param swbf_hashes The hashes to use while processing the file.
+   //!
+   //! \exception std::runtime_error Thrown when the file is not a valid ucfb file.
+   void add_file(const std::filesystem::path& path,
+                 const std::filesystem::path& output_directory,
+                 Swbf_fnv_hashes swbf_hashes);
+
+   //! \brief Processes every queued chunk.
+   void run();
+
+private:
+   struct File_state;
+
+   struct Job {
+      Ucfb_reader chunk;
+      Ucfb_reader parent_reader;
+      File_state* file;
+      model::Models_builder* models_builder;
+      double cost;
+   };
+
+   void run_job(const Job& job);
+
+   void finish_file(File_state& file) noexcept;
+
+   const App_options& _app_options;
+   Chunk_cost_model _cost_model;
+
+   std::mutex _mutex;
+   std::vector<std::unique_ptr<File_state>> _files;
+   std::vector<Job> _jobs;
+};
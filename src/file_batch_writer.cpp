@@ -0,0 +1,311 @@
+#include "file_batch_writer.hpp"
+#include "logger.hpp"
+
+#if defined(__linux__) && __has_include(<liburing.h>)
+#define UNMUNGE_IO_URING 1
+#include <liburing.h>
+#else
+#define UNMUNGE_IO_URING 0
+#endif
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+#if UNMUNGE_IO_URING
+
+namespace {
+
+//! \brief Files up to this size are copied into a registered buffer before being written.
+constexpr std::size_t registered_buffer_size = 64 * 1024;
+
+//! \brief Files larger than this are left to write_file, the kernel caps single writes
+//! at a little under 2GiB.
+constexpr std::size_t max_submitted_write = 1024 * 1024 * 1024;
+
+//! \brief Every file takes an open, a write and a close.
+constexpr unsigned ring_entries = File_batch_writer::max_batch_size * 3;
+
+enum class Operation : std::uint64_t { open, write, close };
+
+auto pack_user_data(std::size_t file, Operation operation) noexcept -> std::uint64_t
+{
+   return (file << 2) | static_cast<std::uint64_t>(operation);
+}
+
+auto unpack_user_data(std::uint64_t user_data) noexcept
+   -> std::pair<std::size_t, Operation>
+{
+   return {static_cast<std::size_t>(user_data >> 2), Operation{user_data & 0b11}};
+}
+
+}
+
+struct File_batch_writer::Ring {
+   io_uring ring{};
+   bool initialized = false;
+   //! Set once an open into a file slot has completed with a result other than the
+   //! kernel rejecting it, until then the kernel may turn out not to support them.
+   bool opens_supported = false;
+   std::unique_ptr<std::byte[]> buffers;
+
+   Ring() = default;
+
+   Ring(const Ring&) = delete;
+   Ring& operator=(const Ring&) = delete;
+
+   ~Ring()
+   {
+      if (initialized) io_uring_queue_exit(&ring);
+   }
+
+   //! \brief Sets up a ring, returns nullptr if io_uring can't be used.
+   static auto create() noexcept -> std::unique_ptr<Ring>;
+
+   auto buffer(std::size_t index) noexcept -> std::byte*
+   {
+      return buffers.get() + (index * registered_buffer_size);
+   }
+};
+
+auto File_batch_writer::Ring::create() noexcept -> std::unique_ptr<Ring>
+{
+   std::unique_ptr<Ring> ring{new (std::nothrow) Ring{}};
+
+   if (!ring) return nullptr;
+
+   if (const int result = io_uring_queue_init(ring_entries, &ring->ring, 0); result < 0) {
+      logger::debug("io_uring is unavailable, writing files one at a time. Error: "s,
+                    std::strerror(-result), '\n');
+
+      return nullptr;
+   }
+
+   ring->initialized = true;
+
+   if (const int result = io_uring_register_files_sparse(&ring->ring, max_batch_size);
+       result < 0) {
+      logger::debug("io_uring file slots are unavailable, writing files one at a time. "
+                    "Error: "s,
+                    std::strerror(-result), '\n');
+
+      return nullptr;
+   }
+
+   ring->buffers.reset(
+      new (std::nothrow) std::byte[max_batch_size * registered_buffer_size]);
+
+   if (!ring->buffers) return nullptr;
+
+   std::array<iovec, max_batch_size> iovecs;
+
+   for (std::size_t i = 0; i < iovecs.size(); ++i) {
+      iovecs[i] = {ring->buffer(i), registered_buffer_size};
+   }
+
+   if (const int result =
+          io_uring_register_buffers(&ring->ring, iovecs.data(), iovecs.size());
+       result < 0) {
+      logger::debug("io_uring buffers are unavailable, writing files one at a time. "
+                    "Error: "s,
+                    std::strerror(-result), '\n');
+
+      return nullptr;
+   }
+
+   return ring;
+}
+
+#else
+
+struct File_batch_writer::Ring {
+};
+
+#endif
+
+File_batch_writer::File_batch_writer() noexcept
+{
+#if UNMUNGE_IO_URING
+   _ring = Ring::create();
+#endif
+}
+
+File_batch_writer::~File_batch_writer() = default;
+
+void File_batch_writer::write(gsl::span<const Pending_file> files) noexcept
+{
+   const auto file_count = static_cast<std::size_t>(files.size());
+
+   Expects(file_count <= max_batch_size);
+
+   std::array<bool, max_batch_size> written{};
+
+#if UNMUNGE_IO_URING
+   if (_ring) {
+      std::array<bool, max_batch_size> opened{};
+      std::array<bool, max_batch_size> closed{};
+      unsigned submissions = 0;
+      std::size_t submitted_opens = 0;
+      std::size_t unsupported_opens = 0;
+
+      for (std::size_t i = 0; i < file_count; ++i) {
+         const auto& file = files[i];
+
+         if (file.contents.size() > max_submitted_write) continue;
+
+         const auto slot = static_cast<unsigned>(i);
+         const auto size = static_cast<unsigned>(file.contents.size());
+
+         // Files opened into slots never enter the descriptor table, the kernel rejects
+         // O_CLOEXEC for them.
+         auto* open_sqe = io_uring_get_sqe(&_ring->ring);
+         io_uring_prep_openat_direct(open_sqe, AT_FDCWD, file.path.c_str(),
+                                     O_WRONLY | O_CREAT | O_TRUNC, 0666, slot);
+         io_uring_sqe_set_flags(open_sqe, IOSQE_IO_LINK);
+         io_uring_sqe_set_data64(open_sqe, pack_user_data(i, Operation::open));
+
+         auto* write_sqe = io_uring_get_sqe(&_ring->ring);
+
+         if (size <= registered_buffer_size) {
+            std::memcpy(_ring->buffer(i), file.contents.data(), size);
+
+            io_uring_prep_write_fixed(write_sqe, slot, _ring->buffer(i), size, 0,
+                                      static_cast<int>(i));
+         }
+         else {
+            io_uring_prep_write(write_sqe, slot, file.contents.data(), size, 0);
+         }
+
+         // The close is hard linked so the slot is released even if the write fails.
+         io_uring_sqe_set_flags(write_sqe, IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK);
+         io_uring_sqe_set_data64(write_sqe, pack_user_data(i, Operation::write));
+
+         auto* close_sqe = io_uring_get_sqe(&_ring->ring);
+         io_uring_prep_close_direct(close_sqe, slot);
+         io_uring_sqe_set_data64(close_sqe, pack_user_data(i, Operation::close));
+
+         submissions += 3;
+         submitted_opens += 1;
+      }
+
+      const int submitted = io_uring_submit(&_ring->ring);
+      bool ring_failed = submitted != static_cast<int>(submissions);
+
+      for (int completed = 0; completed < submitted; ++completed) {
+         io_uring_cqe* cqe = nullptr;
+
+         if (const int result = io_uring_wait_cqe(&_ring->ring, &cqe); result < 0) {
+            if (result == -EINTR) {
+               --completed;
+
+               continue;
+            }
+
+            ring_failed = true;
+
+            break;
+         }
+
+         const auto [i, operation] = unpack_user_data(io_uring_cqe_get_data64(cqe));
+
+         switch (operation) {
+         case Operation::open:
+            opened[i] = cqe->res >= 0;
+
+            if (cqe->res == -EINVAL || cqe->res == -EOPNOTSUPP) unsupported_opens += 1;
+
+            break;
+         case Operation::write:
+            written[i] = cqe->res >= 0 &&
+                         static_cast<std::size_t>(cqe->res) == files[i].contents.size();
+            break;
+         case Operation::close:
+            closed[i] = cqe->res >= 0;
+            break;
+         }
+
+         io_uring_cqe_seen(&_ring->ring, cqe);
+      }
+
+      for (std::size_t i = 0; i < file_count; ++i) {
+         written[i] = opened[i] && written[i] && closed[i];
+      }
+
+      // Requests may still be in flight or file slots left open, start over with
+      // write_file rather than trying to recover.
+      if (ring_failed) {
+         logger::warning("io_uring submission failed, writing files one at a time.\n"sv);
+
+         _ring = nullptr;
+      }
+      // Kernels without opens into file slots reject every one of them, there's no point
+      // submitting batches that will all be rewritten by write_file.
+      else if (!_ring->opens_supported && submitted_opens != 0 &&
+               unsupported_opens == submitted_opens) {
+         logger::debug("io_uring can't open files into slots, writing files one at a "
+                       "time.\n"sv);
+
+         _ring = nullptr;
+      }
+      else if (unsupported_opens != submitted_opens) {
+         _ring->opens_supported = true;
+      }
+   }
+#endif
+
+   for (std::size_t i = 0; i < file_count; ++i) {
+      if (written[i]) continue;
+
+      if (!write_file(files[i].path, files[i].contents)) {
+         logger::error("Failed to write file "s, files[i].path.string(), '\n');
+      }
+   }
+}
+
+bool File_batch_writer::batched() const noexcept
+{
+   return _ring != nullptr;
+}
+
+bool write_file(const fs::path& path, std::string_view contents) noexcept
+{
+#ifdef _WIN32
+   std::ofstream file{path, std::ios::binary};
+   file.write(contents.data(), contents.size());
+
+   return file.good();
+#else
+   const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+   if (fd == -1) return false;
+
+   std::size_t written = 0;
+
+   while (written < contents.size()) {
+      const auto result = pwrite(fd, contents.data() + written, contents.size() - written,
+                                 static_cast<off_t>(written));
+
+      if (result < 0) {
+         if (errno == EINTR) continue;
+
+         break;
+      }
+
+      written += static_cast<std::size_t>(result);
+   }
+
+   return (close(fd) == 0) && written == contents.size();
+#endif
+}
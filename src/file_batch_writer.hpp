@@ -0,0 +1,56 @@
+#pragma once
+
+#include <gsl/gsl>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+struct Pending_file {
+   std::filesystem::path path;
+   std::string contents;
+   //! Whether an existing file at path is removed rather than written into, for files
+   //! that may be hard links shared with other files.
+   bool unlink_existing = false;
+};
+
+//! \brief Writes out files in batches, using as few system calls as it can.
+//!
+//! On Linux, when built with liburing, the open, write and close of every file in a batch
+//! are submitted to an io_uring together and the thread waits once for the whole batch.
+//! Files are opened into registered file slots and small files are copied into
+//! registered buffers, so the kernel doesn't have to look up descriptors or pin pages for
+//! each one. If io_uring is unavailable files are written one at a time with
+//! write_file. A writer may only be used by one thread at a time.
+class File_batch_writer {
+public:
+   //! \brief The most files write accepts in a single call.
+   constexpr static std::size_t max_batch_size = 16;
+
+   File_batch_writer() noexcept;
+
+   File_batch_writer(const File_batch_writer&) = delete;
+   File_batch_writer& operator=(const File_batch_writer&) = delete;
+
+   ~File_batch_writer();
+
+   //! \brief Writes a batch of files, errors are logged.
+   //!
+   //! \param files The files to write, at most max_batch_size of them.
+   void write(gsl::span<const Pending_file> files) noexcept;
+
+   //! \brief Whether batches are submitted to an io_uring.
+   bool batched() const noexcept;
+
+private:
+   struct Ring;
+
+   std::unique_ptr<Ring> _ring;
+};
+
+//! \brief Writes a single file, with pwrite on Linux.
+//!
+//! \return If the whole file was written.
+bool write_file(const std::filesystem::path& path, std::string_view contents) noexcept;
@@ -1,55 +1,123 @@
 #include "file_saver.hpp"
-#include "synced_cout.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
+#include "output_dedup.hpp"
 
 #include <gsl/gsl>
 
+#include "tbb/concurrent_hash_map.h"
+
 #include <algorithm>
 #include <cstdio>
-#include <fstream>
+#include <exception>
 #include <limits>
 #include <memory>
-#include <mutex>
+#include <utility>
 
 namespace fs = std::filesystem;
 using namespace std::literals;
 
-File_saver::File_saver(const fs::path& path, bool verbose) noexcept
-   : _path{path.lexically_normal()}, _verbose{verbose}
+namespace {
+
+//! \brief Gives every spelling of a directory the same key, "a/./b/" and "a/b" included.
+auto normalise_dir_path(const fs::path& path) -> std::string
 {
-   fs::create_directory(_path);
+   auto normal = path.lexically_normal();
+
+   if (!normal.has_filename() && normal.has_relative_path()) {
+      normal = normal.parent_path();
+   }
+
+   return normal.generic_string();
 }
 
-void File_saver::save_file(std::string_view contents, std::string_view directory,
-                           std::string_view name, std::string_view extension)
+}
+
+//! \brief The directories created by a saver and every saver nested in it. The value is
+//! unused, the entry's lock is what makes other threads wait while a directory is being
+//! created.
+struct File_saver::Directory_cache : tbb::concurrent_hash_map<std::string, bool> {
+};
+
+Save_file_stream::Save_file_stream(std::shared_ptr<Output_sink> sink, fs::path path)
+   : std::ostringstream{std::ios::binary}, _sink{std::move(sink)}, _path{std::move(path)}
 {
-   const auto path = directory.empty() ? build_file_path(name, extension)
-                                       : build_file_path(directory, name, extension);
+}
 
-   create_dir(directory);
+Save_file_stream::Save_file_stream(Save_file_stream&& other) noexcept
+   : std::ostringstream{std::move(other)},
+     _sink{std::move(other._sink)},
+     _path{std::move(other._path)}
+{
+}
 
-   if (_verbose) {
-      synced_cout::print("Info: Saving file "s, path, '\n');
+Save_file_stream::~Save_file_stream()
+{
+   if (!_sink) return;
+
+   try {
+      auto contents = std::move(*this).str();
+
+      instrumentation::add_bytes_out(contents.size());
+
+      _sink->write_file(_path, std::move(contents));
+   }
+   catch (std::exception& e) {
+      logger::error("Unable to save file "s, _path.string(), "\n   Message: "s, e.what(),
+                    '\n');
    }
+}
 
-   std::ofstream file{path, std::ios::binary};
-   file.write(contents.data(), contents.size());
+File_saver::File_saver(const fs::path& path, bool verbose,
+                       std::shared_ptr<Output_sink> sink) noexcept
+   : File_saver{path, verbose, sink ? std::move(sink) : create_directory_sink(),
+                std::make_shared<Directory_cache>(), nullptr}
+{
 }
 
-auto File_saver::open_save_file(std::string_view directory, std::string_view name,
-                                std::string_view extension,
-                                std::ios_base::openmode openmode) -> std::ofstream
+File_saver::File_saver(const fs::path& path, bool verbose,
+                       std::shared_ptr<Output_sink> sink,
+                       std::shared_ptr<Directory_cache> created_dirs,
+                       output_dedup::Recorder* recorder) noexcept
+   : _path{path.lexically_normal()},
+     _verbose{verbose},
+     _sink{std::move(sink)},
+     _created_dirs{std::move(created_dirs)},
+     _recorder{recorder}
 {
+   create_dir(""sv);
+}
 
-   const auto path = directory.empty() ? build_file_path(name, extension)
-                                       : build_file_path(directory, name, extension);
+void File_saver::save_file(std::string_view contents, std::string_view directory,
+                           std::string_view name, std::string_view extension)
+{
+   const auto path = prepare_save_path(directory, name, extension);
 
-   create_dir(directory);
+   instrumentation::add_bytes_out(contents.size());
 
-   if (_verbose) {
-      synced_cout::print("Info: Saving file "s, path, '\n');
-   }
+   _sink->write_file(path, contents);
+}
 
-   return std::ofstream{path, openmode};
+void File_saver::save_file(std::string&& contents, std::string_view directory,
+                           std::string_view name, std::string_view extension)
+{
+   auto path = prepare_save_path(directory, name, extension);
+
+   instrumentation::add_bytes_out(contents.size());
+
+   _sink->write_file(std::move(path), std::move(contents));
+}
+
+bool File_saver::link_file(const fs::path& existing, std::string_view directory,
+                           std::string_view name, std::string_view extension)
+{
+   return _sink->link_file(existing, prepare_save_path(directory, name, extension));
+}
+
+auto File_saver::open_save_file(std::string_view directory, std::string_view name,
+                                std::string_view extension) -> Save_file_stream
+{
+   return {_sink, prepare_save_path(directory, name, extension)};
 }
 
 auto File_saver::build_file_path(std::string_view directory, std::string_view name,
@@ -66,29 +134,65 @@ auto File_saver::build_file_path(std::string_view name, std::string_view extensi
 
 void File_saver::create_dir(std::string_view directory) noexcept
 {
-   const auto dir_result = [&] {
-      std::shared_lock lock{_dirs_mutex};
+   const auto path = _path / directory;
+   const auto key = normalise_dir_path(path);
 
-      return std::find(std::cbegin(_created_dirs), std::cend(_created_dirs), directory);
-   }();
+   if (Directory_cache::const_accessor created; _created_dirs->find(created, key)) {
+      return;
+   }
+
+   // Includes any time spent waiting on another thread creating the same directory.
+   const instrumentation::Scope scope{"create_dir"sv};
 
-   if (dir_result == std::cend(_created_dirs)) {
-      std::lock_guard lock{_dirs_mutex};
+   Directory_cache::accessor created;
 
-      fs::path path{_path};
-      path /= directory;
+   // Whoever inserts the entry creates the directory while holding its lock, anyone
+   // else looking it up waits until that's done.
+   if (!_created_dirs->insert(created, key)) return;
 
-      fs::create_directories(path);
+   created->second = true;
 
-      _created_dirs.emplace_back(directory);
+   try {
+      _sink->create_directory(path);
+   }
+   catch (std::exception& e) {
+      logger::error("Unable to create directory "s, path.string(), "\n   Message: "s,
+                    e.what(), '\n');
    }
 }
 
+auto File_saver::prepare_save_path(std::string_view directory, std::string_view name,
+                                   std::string_view extension) -> fs::path
+{
+   auto path = directory.empty() ? build_file_path(name, extension)
+                                 : build_file_path(directory, name, extension);
+
+   create_dir(directory);
+
+   if (_verbose) {
+      logger::info("Saving file "s, path, '\n');
+   }
+
+   if (_recorder) _recorder->record(path);
+
+   return path;
+}
+
+auto File_saver::path() const noexcept -> const fs::path&
+{
+   return _path;
+}
+
 auto File_saver::create_nested(std::string_view directory) const -> File_saver
 {
    fs::path new_path = _path;
    new_path.append(std::cbegin(directory), std::cend(directory));
    new_path += fs::path::preferred_separator;
 
-   return {new_path, _verbose};
+   return {new_path, _verbose, _sink, _created_dirs, _recorder};
+}
+
+auto File_saver::create_recording(output_dedup::Recorder& recorder) const -> File_saver
+{
+   return {_path, _verbose, _sink, _created_dirs, &recorder};
 }
@@ -1,23 +1,59 @@
 #pragma once
 
+#include "output_sink.hpp"
+
 #include <filesystem>
-#include <fstream>
 #include <functional>
-#include <shared_mutex>
+#include <memory>
+#include <sstream>
 #include <string>
-#include <vector>
+
+namespace output_dedup {
+class Recorder;
+}
+
+//! \brief A file being written through a stream. The contents are kept in memory and
+//! handed to the File_saver's sink when the stream is destroyed.
+class Save_file_stream : public std::ostringstream {
+public:
+   Save_file_stream(std::shared_ptr<Output_sink> sink, std::filesystem::path path);
+
+   Save_file_stream(Save_file_stream&& other) noexcept;
+
+   ~Save_file_stream();
+
+private:
+   std::shared_ptr<Output_sink> _sink;
+   std::filesystem::path _path;
+};
 
 class File_saver {
 public:
-   File_saver(const std::filesystem::path& path, bool verbose = false) noexcept;
+   //! \param path The directory to save files under.
+   //! \param verbose Whether to log every file saved.
+   //! \param sink Where to put saved files, nullptr for the directory at path.
+   File_saver(const std::filesystem::path& path, bool verbose = false,
+              std::shared_ptr<Output_sink> sink = nullptr) noexcept;
 
    void save_file(std::string_view contents, std::string_view directory,
                   std::string_view name, std::string_view extension);
 
+   //! \brief Saves a file, taking ownership of its contents so they can be handed to
+   //! the write-behind queue without being copied.
+   void save_file(std::string&& contents, std::string_view directory,
+                  std::string_view name, std::string_view extension);
+
+   //! \brief Saves a file by linking it to an existing file with the same contents,
+   //! copying it where the sink can't link files.
+   //!
+   //! \return False if the file couldn't be linked or copied and must be saved normally.
+   bool link_file(const std::filesystem::path& existing, std::string_view directory,
+                  std::string_view name, std::string_view extension);
+
+   //! \brief Opens a stream to write a file with, it is saved when the stream is
+   //! destroyed.
    auto open_save_file(std::string_view directory, std::string_view name,
-                       std::string_view extension,
-                       std::ios_base::openmode openmode = std::ios::binary)
-      -> std::ofstream;
+                       std::string_view extension) -> Save_file_stream;
 
    auto build_file_path(std::string_view directory, std::string_view name,
                         std::string_view extension) -> std::filesystem::path;
@@ -25,14 +61,37 @@ public:
    auto build_file_path(std::string_view name, std::string_view extension)
       -> std::filesystem::path;
 
+   //! \brief Creates a directory under the saver's path. Each directory is only created
+   //! once per run, however many threads or nested savers ask for it.
    void create_dir(std::string_view directory) noexcept;
 
+   //! \brief Gets the directory the saver saves files under.
+   auto path() const noexcept -> const std::filesystem::path&;
+
+   //! \brief Creates a saver for a subdirectory, which shares this saver's record of the
+   //! directories that have been created.
    auto create_nested(std::string_view directory) const -> File_saver;
 
+   //! \brief Creates a saver for the same directory that records every file saved
+   //! through it, or through savers nested in it, with recorder. The recorder must
+   //! outlive the saver.
+   auto create_recording(output_dedup::Recorder& recorder) const -> File_saver;
+
 private:
+   struct Directory_cache;
+
+   File_saver(const std::filesystem::path& path, bool verbose,
+              std::shared_ptr<Output_sink> sink,
+              std::shared_ptr<Directory_cache> created_dirs,
+              output_dedup::Recorder* recorder) noexcept;
+
+   auto prepare_save_path(std::string_view directory, std::string_view name,
+                          std::string_view extension) -> std::filesystem::path;
+
    const std::filesystem::path _path;
    const bool _verbose = false;
 
-   std::shared_mutex _dirs_mutex;
-   std::vector<std::string> _created_dirs;
+   const std::shared_ptr<Output_sink> _sink;
+   const std::shared_ptr<Directory_cache> _created_dirs;
+   output_dedup::Recorder* const _recorder = nullptr;
 };
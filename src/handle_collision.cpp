@@ -1,7 +1,7 @@
 
+#include "logger.hpp"
 #include "magic_number.hpp"
 #include "model_builder.hpp"
-#include "synced_cout.hpp"
 #include "type_pun.hpp"
 #include "ucfb_reader.hpp"
 
@@ -22,12 +22,12 @@ static_assert(sizeof(Collision_info) == 40);
 void triangulate_points(const std::vector<std::uint16_t>& points, model::Indices& out)
 {
    if (points.size() == 1) {
-      synced_cout::print("Found collision geometry represented as a point. Skipping.");
+      logger::warning("Found collision geometry represented as a point. Skipping.");
 
       return;
    }
    else if (points.size() == 2) {
-      synced_cout::print("Found collision geometry represented as a line. Skipping.");
+      logger::warning("Found collision geometry represented as a line. Skipping.");
 
       return;
    }
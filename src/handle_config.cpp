@@ -1,15 +1,22 @@
 
 #include "file_saver.hpp"
 #include "magic_number.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
 #include "swbf_fnv_hashes.hpp"
 #include "ucfb_reader.hpp"
 
 #include <gsl/gsl>
 
+#include "tbb/parallel_for.h"
+
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
+#include <string>
 #include <string_view>
+#include <vector>
 
 using namespace std::literals;
 
@@ -17,15 +24,20 @@ namespace {
 
 constexpr auto precision_cutoff = 0.00001f;
 
-inline std::string cast_number_value(const float number)
+void append_number_value(const float number, std::string& buffer)
 {
-   const auto fraction = std::remainder(number, 1.0f);
-   const auto absolute_fraction = std::abs(fraction);
+   if (!number_format::exact_floats()) {
+      const auto fraction = std::remainder(number, 1.0f);
+      const auto absolute_fraction = std::abs(fraction);
+
+      if (absolute_fraction < precision_cutoff) {
+         number_format::append(buffer, static_cast<std::int64_t>(number));
 
-   if (absolute_fraction < precision_cutoff)
-      return std::to_string(static_cast<std::int64_t>(number));
+         return;
+      }
+   }
 
-   return std::to_string(number);
+   number_format::append(buffer, number);
 }
 
 inline void remove_last_semicolen(std::string& buffer)
@@ -38,28 +50,10 @@ inline void remove_last_semicolen(std::string& buffer)
    }
 }
 
-bool is_string_data(Ucfb_reader_strict<"DATA"_mn> data)
-{
-   data.consume(4);
-
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
-
-   if (element_count == 0) return false;
-
-   const auto str_sizes_size = data.read_trivial_unaligned<std::uint32_t>();
-
-   if (str_sizes_size / 4 != element_count) return false;
-
-   const auto str_sizes = data.read_array_unaligned<std::uint32_t>(element_count);
-
-   const std::size_t str_array_size = str_sizes[element_count - 1];
-
-   return (data.size() == 9 + str_sizes_size + str_array_size);
-}
-
-bool is_hash_data(Ucfb_reader_strict<"DATA"_mn> data)
-{
-   constexpr std::array hashes = {
+//! \brief Names of properties whose first value is a hashed string, sorted so they can
+//! be binary searched.
+constexpr auto hash_data_names = [] {
+   std::array hashes = {
       "GrassPatch"_fnv,
       "File"_fnv,
       "Sound"_fnv,
@@ -93,230 +87,300 @@ bool is_hash_data(Ucfb_reader_strict<"DATA"_mn> data)
       "I3DL2ReverbPreset"_fnv,
    };
 
-   const auto data_hash = data.read_trivial<std::uint32_t>();
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
+   std::sort(hashes.begin(), hashes.end());
 
-   if (element_count > 0) {
-      return std::find(std::begin(hashes), std::end(hashes), data_hash) !=
-             std::end(hashes);
-   }
+   return hashes;
+}();
 
-   return false;
-}
+enum class Data_kind { string, hash, hybrid, floats, tag };
 
-bool is_hybrid_data(Ucfb_reader_strict<"DATA"_mn> data)
-{
-   data.consume(4);
+//! \brief The fields at the start of every DATA chunk and what the chunk holds.
+struct Data_header {
+   Data_kind kind;
+   std::uint32_t hash;
+   std::uint8_t element_count;
+};
 
+//! \brief Reads the header of a DATA chunk and classifies it. The reader is left at the
+//! chunk's values.
+auto read_data_header(Ucfb_reader_strict<"DATA"_mn>& data, bool strings_are_hashed)
+   -> Data_header
+{
+   const auto hash = data.read_trivial<std::uint32_t>();
    const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
 
-   if (element_count != 2) return false;
+   const auto kind = [&] {
+      if (element_count == 0) return Data_kind::tag;
 
-   return (data.size() != (element_count * sizeof(float) + 9));
-}
+      const auto float_data_size = element_count * sizeof(float) + 9;
 
-bool is_float_data(Ucfb_reader_strict<"DATA"_mn> data)
-{
-   data.consume(4);
+      // String data has an array of string sizes between the header and the strings. The
+      // last entry of the array gives the size of all the strings. Like the other reads
+      // these throw if the chunk is too short to hold the array.
+      auto string_sizes = data;
 
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
+      const auto string_sizes_size = string_sizes.read_trivial_unaligned<std::uint32_t>();
 
-   return ((element_count > 0) && (data.size() == (element_count * sizeof(float) + 9)));
+      if (string_sizes_size / 4 == element_count) {
+         string_sizes.consume_unaligned((element_count - 1) * sizeof(std::uint32_t));
+
+         const std::size_t string_array_size =
+            string_sizes.read_trivial_unaligned<std::uint32_t>();
+
+         if (data.size() == 9 + string_sizes_size + string_array_size) {
+            return Data_kind::string;
+         }
+      }
+
+      if (strings_are_hashed &&
+          std::binary_search(hash_data_names.cbegin(), hash_data_names.cend(), hash)) {
+         return Data_kind::hash;
+      }
+
+      if (element_count == 2 && data.size() != float_data_size) return Data_kind::hybrid;
+
+      if (data.size() == float_data_size) return Data_kind::floats;
+
+      return Data_kind::tag;
+   }();
+
+   return {kind, hash, element_count};
 }
 
-std::string read_string_data(Ucfb_reader_strict<"DATA"_mn> data,
-                             const Swbf_fnv_hashes& swbf_hashes,
-                             const std::size_t indention_level)
+//! \brief Removes the ", " left after the last element of a list.
+inline void remove_last_separator(std::string& buffer)
 {
-   const auto hash = data.read_trivial<std::uint32_t>();
+   buffer.resize(buffer.size() - 2);
+}
 
-   std::string line;
-   line.append(indention_level, '\t');
-   line += swbf_hashes.lookup(hash);
-   line += '(';
+void read_string_data(const Data_header header, Ucfb_reader_strict<"DATA"_mn> data,
+                      const Swbf_fnv_hashes& swbf_hashes,
+                      const std::size_t indention_level, std::string& buffer)
+{
+   buffer.append(indention_level, '\t');
+   buffer += swbf_hashes.lookup(header.hash);
+   buffer += '(';
 
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
-   const auto str_sizes_size = data.read_trivial_unaligned<std::uint32_t>();
-   const auto str_sizes = data.read_array_unaligned<std::uint32_t>(element_count);
+   data.consume_unaligned(4); // size of the string sizes array
+   data.consume_unaligned(header.element_count * sizeof(std::uint32_t));
 
    while (data) {
-      line += '\"';
-      line += data.read_string_unaligned();
-      line += "\", "sv;
+      buffer += '\"';
+      buffer += data.read_string_unaligned();
+      buffer += "\", "sv;
    }
 
-   line.resize(line.size() - 2);
-   line += ");\n"sv;
-
-   return line;
+   remove_last_separator(buffer);
+   buffer += ");\n"sv;
 }
 
-std::string read_hash_data(Ucfb_reader_strict<"DATA"_mn> data,
-                           const Swbf_fnv_hashes& swbf_hashes,
-                           const std::size_t indention_level)
+void read_hash_data(const Data_header header, Ucfb_reader_strict<"DATA"_mn> data,
+                    const Swbf_fnv_hashes& swbf_hashes,
+                    const std::size_t indention_level, std::string& buffer)
 {
-   const auto hash = data.read_trivial<std::uint32_t>();
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
    const auto value_hash = data.read_trivial_unaligned<std::uint32_t>();
 
-   std::string line;
-   line.append(indention_level, '\t');
-   line += swbf_hashes.lookup(hash);
-   line += "(\""sv;
-   line += swbf_hashes.lookup(value_hash);
-   line += "\", "sv;
+   buffer.append(indention_level, '\t');
+   buffer += swbf_hashes.lookup(header.hash);
+   buffer += "(\""sv;
+   buffer += swbf_hashes.lookup(value_hash);
+   buffer += "\", "sv;
 
-   for (std::size_t i = 1; i < element_count; ++i) {
-      line += cast_number_value(data.read_trivial_unaligned<float>());
-      line += ", "sv;
+   for (std::size_t i = 1; i < header.element_count; ++i) {
+      append_number_value(data.read_trivial_unaligned<float>(), buffer);
+      buffer += ", "sv;
    }
 
-   line.resize(line.size() - 2);
-
-   line += ");\n"sv;
-
-   return line;
+   remove_last_separator(buffer);
+   buffer += ");\n"sv;
 }
 
-std::string read_hybrid_data(Ucfb_reader_strict<"DATA"_mn> data,
-                             const Swbf_fnv_hashes& swbf_hashes,
-                             const std::size_t indention_level)
+void read_hybrid_data(const Data_header header, Ucfb_reader_strict<"DATA"_mn> data,
+                      const Swbf_fnv_hashes& swbf_hashes,
+                      const std::size_t indention_level, std::string& buffer)
 {
-   const auto hash = data.read_trivial<std::uint32_t>();
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
-
-   // data.consume_unaligned(4);
-   const auto string_index = data.read_trivial_unaligned<std::uint32_t>();
+   data.consume_unaligned(4); // string index
 
    const auto value = data.read_trivial_unaligned<float>();
 
-   const auto string_size = data.read_trivial_unaligned<std::uint32_t>();
-
-   std::string line;
-   line.append(indention_level, '\t');
-   line += swbf_hashes.lookup(hash);
-   line += "(\""sv;
-   line += data.read_string_unaligned();
-   line += "\", "sv;
-   line += cast_number_value(value);
-   line += ");\n"sv;
+   data.consume_unaligned(4); // string size
 
-   return line;
+   buffer.append(indention_level, '\t');
+   buffer += swbf_hashes.lookup(header.hash);
+   buffer += "(\""sv;
+   buffer += data.read_string_unaligned();
+   buffer += "\", "sv;
+   append_number_value(value, buffer);
+   buffer += ");\n"sv;
 }
 
-std::string read_float_data(Ucfb_reader_strict<"DATA"_mn> data,
-                            const Swbf_fnv_hashes& swbf_hashes,
-                            const std::size_t indention_level)
+void read_float_data(const Data_header header, Ucfb_reader_strict<"DATA"_mn> data,
+                     const Swbf_fnv_hashes& swbf_hashes,
+                     const std::size_t indention_level, std::string& buffer)
 {
-   const auto hash = data.read_trivial<std::uint32_t>();
-   const auto element_count = data.read_trivial_unaligned<std::uint8_t>();
-
-   std::string line;
-   line.append(indention_level, '\t');
-   line += swbf_hashes.lookup(hash);
-   line += '(';
+   buffer.append(indention_level, '\t');
+   buffer += swbf_hashes.lookup(header.hash);
+   buffer += '(';
 
-   for (std::size_t i = 0; i < element_count; ++i) {
-      line += cast_number_value(data.read_trivial_unaligned<float>());
-      line += ", "sv;
+   for (std::size_t i = 0; i < header.element_count; ++i) {
+      append_number_value(data.read_trivial_unaligned<float>(), buffer);
+      buffer += ", "sv;
    }
 
-   line.resize(line.size() - 2);
-
-   line += ");\n"sv;
-
-   return line;
+   remove_last_separator(buffer);
+   buffer += ");\n"sv;
 }
 
-std::string read_tag_data(Ucfb_reader_strict<"DATA"_mn> data,
-                          const Swbf_fnv_hashes& swbf_hashes,
-                          const std::size_t indention_level)
+void read_tag_data(const Data_header header, const Swbf_fnv_hashes& swbf_hashes,
+                   const std::size_t indention_level, std::string& buffer)
 {
-   const auto hash = data.read_trivial<std::uint32_t>();
-
-   std::string line;
-   line.append(indention_level, '\t');
-   line += swbf_hashes.lookup(hash);
-   line += "();\n"sv;
-
-   return line;
+   buffer.append(indention_level, '\t');
+   buffer += swbf_hashes.lookup(header.hash);
+   buffer += "();\n"sv;
 }
 
-std::string read_data(Ucfb_reader_strict<"DATA"_mn> data,
-                      const Swbf_fnv_hashes& swbf_hashes,
-                      const std::size_t indention_level, bool strings_are_hashed)
+void read_data(Ucfb_reader_strict<"DATA"_mn> data, const Swbf_fnv_hashes& swbf_hashes,
+               const std::size_t indention_level, bool strings_are_hashed,
+               std::string& buffer)
 {
-   if (is_string_data(data)) {
-      return read_string_data(data, swbf_hashes, indention_level);
-   }
-   else if (strings_are_hashed && is_hash_data(data)) {
-      return read_hash_data(data, swbf_hashes, indention_level);
-   }
-   else if (is_hybrid_data(data)) {
-      return read_hybrid_data(data, swbf_hashes, indention_level);
-   }
-   else if (is_float_data(data)) {
-      return read_float_data(data, swbf_hashes, indention_level);
-   }
-   else {
-      return read_tag_data(data, swbf_hashes, indention_level);
+   const auto header = read_data_header(data, strings_are_hashed);
+
+   switch (header.kind) {
+   case Data_kind::string:
+      return read_string_data(header, data, swbf_hashes, indention_level, buffer);
+   case Data_kind::hash:
+      return read_hash_data(header, data, swbf_hashes, indention_level, buffer);
+   case Data_kind::hybrid:
+      return read_hybrid_data(header, data, swbf_hashes, indention_level, buffer);
+   case Data_kind::floats:
+      return read_float_data(header, data, swbf_hashes, indention_level, buffer);
+   case Data_kind::tag:
+      return read_tag_data(header, swbf_hashes, indention_level, buffer);
    }
 }
 
-std::string read_scope(Ucfb_reader_strict<"SCOP"_mn> scope,
-                       const Swbf_fnv_hashes& swbf_hashes,
-                       const std::size_t indention_level, bool strings_are_hashed)
+//! \brief Buffers reused by every config decompiled on a thread. Once they have grown to
+//! fit the largest config seen decompiling doesn't allocate.
+struct Decompile_arena {
+   std::string buffer;
+   //! The scopes being read, the root of the config first.
+   std::vector<Ucfb_reader> scopes;
+};
+
+//! \brief Arenas larger than this are released after use, so one huge config doesn't
+//! hold on to its memory for the rest of the run.
+constexpr std::size_t max_retained_arena_size = 16 * 1024 * 1024;
+
+thread_local Decompile_arena thread_arena;
+
+//! \brief Configs at least this large are split into pieces decompiled in parallel.
+constexpr std::size_t parallel_config_size = 512 * 1024;
+
+//! \brief The size pieces of a config are grown to before a new piece is started.
+constexpr std::size_t min_config_piece_size = 64 * 1024;
+
+//! \brief A run of the root scope's children.
+struct Config_piece {
+   //! A reader of the root scope, positioned at the piece's first child.
+   Ucfb_reader root;
+   std::size_t child_count = 0;
+};
+
+//! \brief Decompiles part of the root scope of a config into buffer. Scopes are walked
+//! with an explicit stack, the depth of the stack is the indention of the scope's
+//! contents.
+void read_root_scope(const Config_piece piece, const Swbf_fnv_hashes& swbf_hashes,
+                     bool strings_are_hashed, std::string& buffer,
+                     std::vector<Ucfb_reader>& scopes)
 {
-   Expects(indention_level >= 1);
+   std::size_t root_children_read = 0;
 
-   std::string buffer;
-   buffer.reserve(4096);
+   scopes.clear();
+   scopes.push_back(piece.root);
+
+   while (!scopes.empty()) {
+      const auto indention_level = scopes.size() - 1;
+      const bool piece_done =
+         indention_level == 0 && root_children_read == piece.child_count;
+
+      if (piece_done || !scopes.back()) {
+         scopes.pop_back();
+
+         if (indention_level != 0) {
+            buffer.append(indention_level - 1, '\t');
+            buffer += "}\n\n"sv;
+         }
 
-   buffer.append(indention_level - 1, '\t');
-   buffer += "{\n"sv;
+         continue;
+      }
+
+      const auto child = scopes.back().read_child();
 
-   while (scope) {
-      const auto child = scope.read_child();
+      if (indention_level == 0) root_children_read += 1;
 
       if (child.magic_number() == "DATA"_mn) {
-         buffer += read_data(Ucfb_reader_strict<"DATA"_mn>{child}, swbf_hashes,
-                             indention_level, strings_are_hashed);
+         read_data(Ucfb_reader_strict<"DATA"_mn>{child}, swbf_hashes, indention_level,
+                   strings_are_hashed, buffer);
       }
       else if (child.magic_number() == "SCOP"_mn) {
          remove_last_semicolen(buffer);
 
-         buffer += read_scope(Ucfb_reader_strict<"SCOP"_mn>{child}, swbf_hashes,
-                              indention_level + 1, strings_are_hashed);
+         buffer.append(indention_level, '\t');
+         buffer += "{\n"sv;
+
+         scopes.push_back(child);
       }
    }
-
-   buffer.append(indention_level - 1, '\t');
-   buffer += "}\n\n"sv;
-
-   return buffer;
 }
 
-std::string read_root_scope(Ucfb_reader config, const Swbf_fnv_hashes& swbf_hashes,
-                            bool strings_are_hashed)
+//! \brief Splits the root scope of a config into pieces that can be decompiled
+//! independently. Pieces only end after a SCOP, as a scope edits the line of the property
+//! before it.
+auto split_root_scope(Ucfb_reader config) -> std::vector<Config_piece>
 {
-   std::string buffer;
-   buffer.reserve(16384);
+   std::vector<Config_piece> pieces{Config_piece{config}};
+   std::size_t piece_size = 0;
 
    while (config) {
       const auto child = config.read_child();
 
-      if (child.magic_number() == "DATA"_mn) {
-         buffer += read_data(Ucfb_reader_strict<"DATA"_mn>{child}, swbf_hashes, 0,
-                             strings_are_hashed);
-      }
-      else if (child.magic_number() == "SCOP"_mn) {
-         remove_last_semicolen(buffer);
+      pieces.back().child_count += 1;
+      piece_size += child.size() + 8;
 
-         buffer += read_scope(Ucfb_reader_strict<"SCOP"_mn>{child}, swbf_hashes, 1,
-                              strings_are_hashed);
+      if (child.magic_number() == "SCOP"_mn && piece_size >= min_config_piece_size &&
+          config) {
+         pieces.push_back(Config_piece{config});
+         piece_size = 0;
       }
    }
 
+   return pieces;
+}
+
+//! \brief Decompiles the pieces of a large config concurrently and joins them in order.
+auto read_root_scope_parallel(Ucfb_reader config, const Swbf_fnv_hashes& swbf_hashes,
+                              bool strings_are_hashed) -> std::string
+{
+   const auto pieces = split_root_scope(config);
+
+   // Each piece gets its own buffers, the thread's arena can't be used as this thread
+   // may decompile other configs while it waits.
+   std::vector<Decompile_arena> outputs(pieces.size());
+
+   tbb::parallel_for(std::size_t{0}, pieces.size(), [&](const std::size_t i) {
+      read_root_scope(pieces[i], swbf_hashes, strings_are_hashed, outputs[i].buffer,
+                      outputs[i].scopes);
+   });
+
+   std::size_t size = 0;
+
+   for (const auto& output : outputs) size += output.buffer.size();
+
+   std::string buffer;
+   buffer.reserve(size);
+
+   for (const auto& output : outputs) buffer += output.buffer;
+
    return buffer;
 }
 }
@@ -327,11 +391,28 @@ void handle_config(Ucfb_reader config, File_saver& file_saver,
 {
    const auto name_hash =
       config.read_child_strict<"NAME"_mn>().read_trivial<std::uint32_t>();
-   auto name = swbf_hashes.lookup(name_hash);
+   const auto name = swbf_hashes.lookup(name_hash);
+
+   if (config.size() >= parallel_config_size) {
+      auto buffer = read_root_scope_parallel(config, swbf_hashes, strings_are_hashed);
+
+      if (!buffer.empty()) {
+         file_saver.save_file(std::move(buffer), dir, name, file_type);
+      }
+
+      return;
+   }
 
-   auto buffer = read_root_scope(config, swbf_hashes, strings_are_hashed);
+   auto& [buffer, scopes] = thread_arena;
+
+   buffer.clear();
+
+   read_root_scope(Config_piece{config, std::numeric_limits<std::size_t>::max()},
+                   swbf_hashes, strings_are_hashed, buffer, scopes);
 
    if (!buffer.empty()) {
-      file_saver.save_file(buffer, dir, name, file_type);
+      file_saver.save_file(std::string_view{buffer}, dir, name, file_type);
    }
+
+   if (buffer.capacity() > max_retained_arena_size) buffer = std::string{};
 }
@@ -162,7 +162,7 @@ void dump_localization(Ucfb_reader_strict<"Locl"_mn> localization, File_saver& f
       buffer += '\n';
    }
 
-   file_saver.save_file(buffer, "localization"sv, name, ".txt"sv);
+   file_saver.save_file(std::move(buffer), "localization"sv, name, ".txt"sv);
 }
 }
 
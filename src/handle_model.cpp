@@ -1,5 +1,6 @@
 
 #include "bit_flags.hpp"
+#include "instrumentation.hpp"
 #include "magic_number.hpp"
 #include "math_helpers.hpp"
 #include "model_builder.hpp"
@@ -632,17 +633,26 @@ auto handle_model_impl(Segm_processor&& segm_processor, Ucfb_reader model) -> mo
 
 void handle_model(Ucfb_reader model, model::Models_builder& builders)
 {
+   const instrumentation::Scope scope{"handle_model"sv, model.magic_number(),
+                                      model.size()};
+
    builders.integrate(handle_model_impl(
       [](auto... args) { return process_segment_pc_xbox(args..., false); }, model));
 }
 
 void handle_model_xbox(Ucfb_reader model, model::Models_builder& builders)
 {
+   const instrumentation::Scope scope{"handle_model_xbox"sv, model.magic_number(),
+                                      model.size()};
+
    builders.integrate(handle_model_impl(
       [](auto... args) { return process_segment_pc_xbox(args..., true); }, model));
 }
 
 void handle_model_ps2(Ucfb_reader model, model::Models_builder& builders)
 {
+   const instrumentation::Scope scope{"handle_model_ps2"sv, model.magic_number(),
+                                      model.size()};
+
    builders.integrate(handle_model_impl(process_segment_ps2, model));
 }
@@ -7,9 +7,11 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 using namespace std::literals;
 
@@ -109,35 +111,39 @@ void write_property(std::string_view prop, std::string_view value, std::string&
    }
 }
 
-auto get_properties(Ucfb_reader object)
-   -> std::vector<std::pair<std::uint32_t, std::string_view>>
+struct Properties {
+   std::vector<std::uint32_t> hashes;
+   std::vector<std::string_view> values;
+};
+
+auto get_properties(Ucfb_reader object) -> Properties
 {
-   std::vector<std::pair<std::uint32_t, std::string_view>> properties;
-   properties.reserve(128);
+   Properties properties;
+   properties.hashes.reserve(128);
+   properties.values.reserve(128);
 
    while (object) {
       auto property = object.read_child_strict<"PROP"_mn>();
 
-      const auto hash = property.read_trivial<std::uint32_t>();
-      const auto value = property.read_string();
-
-      properties.emplace_back(hash, value);
+      properties.hashes.push_back(property.read_trivial<std::uint32_t>());
+      properties.values.push_back(property.read_string());
    }
 
    return properties;
 }
 
-auto find_geometry_name(
-   const std::vector<std::pair<std::uint32_t, std::string_view>>& properties)
-   -> std::optional<std::string>
+auto find_geometry_name(const Properties& properties) -> std::optional<std::string>
 {
    constexpr std::uint32_t geometry_name_hash = 0x47c86b4au;
 
-   const auto result =
-      std::find_if(std::cbegin(properties), std::cend(properties),
-                   [](const auto& prop) { return prop.first == geometry_name_hash; });
+   const auto result = std::find(std::cbegin(properties.hashes),
+                                 std::cend(properties.hashes), geometry_name_hash);
+
+   if (result != std::cend(properties.hashes)) {
+      const auto index = std::distance(std::cbegin(properties.hashes), result);
 
-   if (result != std::cend(properties)) return std::string{result->second} += ".msh"sv;
+      return std::string{properties.values[index]} += ".msh"sv;
+   }
 
    return std::nullopt;
 }
@@ -168,9 +174,13 @@ void handle_object(Ucfb_reader object, File_saver& file_saver,
 
    write_bracketed_str("Properties"sv, file_buffer);
 
-   for (const auto& property : properties) {
-      write_property(swbf_hashes.lookup(property.first), property.second, file_buffer);
+   std::vector<std::string_view> names(properties.hashes.size());
+
+   swbf_hashes.lookup(properties.hashes, names);
+
+   for (std::size_t i = 0; i < names.size(); ++i) {
+      write_property(names[i], properties.values[i], file_buffer);
    }
 
-   file_saver.save_file(file_buffer, "odf"sv, odf_name, ".odf"sv);
+   file_saver.save_file(std::move(file_buffer), "odf"sv, odf_name, ".odf"sv);
 }
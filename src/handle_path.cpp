@@ -1,6 +1,7 @@
 
 #include "file_saver.hpp"
 #include "magic_number.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
 #include "ucfb_reader.hpp"
 
@@ -78,21 +79,21 @@ void write_node(const std::pair<glm::vec3, glm::vec4>& node, std::string& buffer
 
    buffer += indent;
    buffer += "Position("sv;
-   buffer += std::to_string(node.first.x);
+   number_format::append(buffer, node.first.x);
    buffer += ", "sv;
-   buffer += std::to_string(node.first.y);
+   number_format::append(buffer, node.first.y);
    buffer += ", "sv;
-   buffer += std::to_string(node.first.z);
+   number_format::append(buffer, node.first.z);
    buffer += ");\n"sv;
    buffer += indent;
    buffer += "Rotation("sv;
-   buffer += std::to_string(node.second.x);
+   number_format::append(buffer, node.second.x);
    buffer += ", "sv;
-   buffer += std::to_string(node.second.y);
+   number_format::append(buffer, node.second.y);
    buffer += ", "sv;
-   buffer += std::to_string(node.second.z);
+   number_format::append(buffer, node.second.z);
    buffer += ", "sv;
-   buffer += std::to_string(node.second.w);
+   number_format::append(buffer, node.second.w);
    buffer += ");\n"sv;
 
    buffer += R"(
@@ -130,7 +131,7 @@ void write_path(const Path& path, std::string& buffer)
 
    buffer += path_common;
    buffer += "\tNodes("sv;
-   buffer += std::to_string(path.nodes.size());
+   number_format::append(buffer, path.nodes.size());
    buffer += ")\n\t{\n";
 
    for (const auto& node : path.nodes) {
@@ -147,7 +148,7 @@ void save_paths(std::vector<Path> paths, File_saver& file_saver)
 
    buffer += "Version(10);\n"sv;
    buffer += "PathCount("sv;
-   buffer += std::to_string(paths.size());
+   number_format::append(buffer, paths.size());
    buffer += ");\n\n"sv;
 
    for (const auto& path : paths) {
@@ -158,7 +159,7 @@ void save_paths(std::vector<Path> paths, File_saver& file_saver)
 
    std::string file_name = std::to_string(path_count.fetch_add(1));
 
-   file_saver.save_file(buffer, "world"s, file_name, ".pth"sv);
+   file_saver.save_file(std::move(buffer), "world"s, file_name, ".pth"sv);
 }
 }
 
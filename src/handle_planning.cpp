@@ -2,6 +2,7 @@
 #include "bit_flags.hpp"
 #include "file_saver.hpp"
 #include "magic_number.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
 #include "ucfb_reader.hpp"
 
@@ -56,14 +57,14 @@ struct Hub_info {
       buffer += "\")\n{\n"sv;
 
       buffer += "\tPos("sv;
-      buffer += std::to_string(x);
+      number_format::append(buffer, x);
       buffer += ", "sv;
-      buffer += std::to_string(y);
+      number_format::append(buffer, y);
       buffer += ", "sv;
-      buffer += std::to_string(z);
+      number_format::append(buffer, z);
       buffer += ");\n"sv;
       buffer += "\tRadius("sv;
-      buffer += std::to_string(radius);
+      number_format::append(buffer, radius);
       buffer += ");\n}\n\n"sv;
    }
 };
@@ -94,7 +95,7 @@ struct Connection_info {
       buffer += hubs[end].name;
       buffer += "\");\n"sv;
       buffer += "\tFlag("sv;
-      buffer += std::to_string(filter_flags);
+      number_format::append(buffer, filter_flags);
       buffer += ");\n"sv;
 
       if (one_way) buffer += "\tOneWay();\n"sv;
@@ -195,7 +196,7 @@ void write_planning(std::string_view name, const std::vector<Hub_info> hubs,
       buffer += "// Failed reading planning info //"sv;
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".pln"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".pln"sv);
 }
 }
 
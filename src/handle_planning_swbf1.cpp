@@ -1,6 +1,7 @@
 
 #include "file_saver.hpp"
 #include "magic_number.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
 #include "ucfb_reader.hpp"
 
@@ -66,14 +67,14 @@ struct Hub_info {
       buffer += "\")\n{\n"sv;
 
       buffer += "\tPos("sv;
-      buffer += std::to_string(x);
+      number_format::append(buffer, x);
       buffer += ", "sv;
-      buffer += std::to_string(y);
+      number_format::append(buffer, y);
       buffer += ", "sv;
-      buffer += std::to_string(z);
+      number_format::append(buffer, z);
       buffer += ");\n"sv;
       buffer += "\tRadius("sv;
-      buffer += std::to_string(radius);
+      number_format::append(buffer, radius);
       buffer += ");\n}\n\n"sv;
    }
 };
@@ -101,7 +102,7 @@ struct Connection_info {
       buffer += hubs[end].name;
       buffer += "\");\n"sv;
       buffer += "\tFlags("sv;
-      buffer += std::to_string(filter_flags);
+      number_format::append(buffer, filter_flags);
       buffer += ");\n"sv;
 
       buffer += "}\n\n"sv;
@@ -179,7 +180,7 @@ void write_planning(std::string_view name, const std::vector<Hub_info> hubs,
       buffer += "// Failed reading planning info //"sv;
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".pln"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".pln"sv);
 }
 }
 
@@ -1,6 +1,7 @@
 
 #include "app_options.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
 #include "magic_number.hpp"
 #include "math_helpers.hpp"
 #include "string_helpers.hpp"
@@ -328,6 +329,9 @@ void read_water(Ucfb_reader_strict<"WATR"_mn> water, Terrain_info terrain_info,
 void handle_terrain(Ucfb_reader terrain, Game_version output_version,
                     File_saver& file_saver)
 {
+   const instrumentation::Scope scope{"handle_terrain"sv, terrain.magic_number(),
+                                      terrain.size()};
+
    const auto name = terrain.read_child_strict<"NAME"_mn>().read_string();
 
    if (!terrain) return save_void_terrain(output_version, name, file_saver);
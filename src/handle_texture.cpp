@@ -1,9 +1,10 @@
 
 #include "app_options.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
 #include "magic_number.hpp"
 #include "save_image.hpp"
-#include "synced_cout.hpp"
 #include "ucfb_reader.hpp"
 
 #include <DirectXTex.h>
@@ -229,8 +230,8 @@ auto patch_luminance_format(DirectX::ScratchImage input, const D3DFORMAT format)
 
    if (FAILED(DirectX::Convert(*input.GetImage(0, 0, 0), DXGI_FORMAT_R8G8B8A8_UNORM,
                                DirectX::TEX_FILTER_DEFAULT, 0.5f, result))) {
-      synced_cout::print(
-         "Warning failed to convert luminance format texture. "
+      logger::warning(
+         "Failed to convert luminance format texture. "
          "The texture's contents will be intact but it's colour channels will need fixing up manually in an editor."sv);
 
       return input;
@@ -353,6 +354,9 @@ auto read_texture(Ucfb_reader_strict<"tex_"_mn> texture)
 void handle_texture(Ucfb_reader texture, File_saver& file_saver, Image_format save_format,
                     Model_format model_format)
 {
+   const instrumentation::Scope scope{"handle_texture"sv, texture.magic_number(),
+                                      texture.size()};
+
    auto [name, image] = read_texture(Ucfb_reader_strict<"tex_"_mn>{texture});
 
    save_image(name, std::move(image), file_saver, save_format, model_format);
@@ -2,6 +2,7 @@
 #include "DDS.h"
 #include "app_options.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
 #include "save_image.hpp"
 #include "ucfb_reader.hpp"
 
@@ -154,6 +155,9 @@ auto read_texture(Ucfb_reader_strict<"tex_"_mn> texture)
 void handle_texture_xbox(Ucfb_reader texture, File_saver& file_saver,
                          Image_format save_format, Model_format model_format)
 {
+   const instrumentation::Scope scope{"handle_texture_xbox"sv, texture.magic_number(),
+                                      texture.size()};
+
    auto [name, image] = read_texture(Ucfb_reader_strict<"tex_"_mn>{texture});
 
    save_image(name, std::move(image), file_saver, save_format, model_format);
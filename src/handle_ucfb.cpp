@@ -1,12 +1,151 @@
-
 #include "chunk_processor.hpp"
+#include "chunk_stream.hpp"
+#include "instrumentation.hpp"
 #include "model_builder.hpp"
 #include "swbf_fnv_hashes.hpp"
 
 #include "tbb/parallel_for_each.h"
+#include "tbb/task_group.h"
 
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+namespace {
+
+constexpr std::uint64_t chunk_header_size = 8;
+
+auto align_offset(const std::uint64_t offset) noexcept -> std::uint64_t
+{
+   return (offset + 3) & ~std::uint64_t{3};
+}
+
+struct Stream_context {
+   Chunk_stream& stream;
+   Buffer_pool& buffer_pool;
+   tbb::task_group& tasks;
+   std::list<model::Models_builder>& lvl_models_builders;
+
+   const App_options& app_options;
+   File_saver& file_saver;
+   const Swbf_fnv_hashes& swbf_hashes;
+   Layer_index& layer_index;
+};
+
+auto acquire_buffer(Stream_context& context, const std::size_t size)
+   -> Buffer_pool::Buffer
+{
+   for (;;) {
+      if (auto buffer = context.buffer_pool.try_acquire(size); buffer) {
+         return std::move(*buffer);
+      }
+
+      // Over the memory ceiling, help finish the in flight chunks to free some up.
+      context.tasks.wait();
+   }
+}
+
+// PS2 textures may need to read the sibling that follows them, so the window we read
+// for them extends over it. The sibling is then processed from the same window.
+auto find_window_end(Stream_context& context, const Chunk_stream::Header header,
+                     const std::uint64_t chunk_end, const std::uint64_t parent_end)
+   -> std::uint64_t
+{
+   if (context.app_options.input_platform() != Input_platform::ps2 ||
+       header.magic_number != "tex_"_mn) {
+      return chunk_end;
+   }
+
+   const auto sibling_offset = align_offset(chunk_end);
+
+   if (sibling_offset + chunk_header_size > parent_end) return chunk_end;
+
+   const auto sibling = context.stream.read_header(sibling_offset);
+   const auto sibling_end = sibling_offset + chunk_header_size + sibling.size;
+
+   if (sibling.magic_number != "tex_"_mn || sibling_end > parent_end) return chunk_end;
+
+   return sibling_end;
+}
+
+void stream_children(Stream_context& context, std::uint64_t offset,
+                     const std::uint64_t end, model::Models_builder& models_builder)
+{
+   while (offset + chunk_header_size <= end) {
+      const auto header = context.stream.read_header(offset);
+      const auto chunk_end = offset + chunk_header_size + header.size;
+
+      if (chunk_end > end) {
+         throw std::runtime_error{"Attempt to read past end of chunk."};
+      }
+
+      if (header.magic_number == "lvl_"_mn && header.size >= 8) {
+         // lvl name hash and lvl size left come before the children
+         stream_children(context, offset + chunk_header_size + 8, chunk_end,
+                         context.lvl_models_builders.emplace_back());
+
+         offset = align_offset(chunk_end);
+
+         continue;
+      }
+
+      // Skip chunks the filter will reject without reading them.
+      if (!context.app_options.chunk_filter().may_accept(header.magic_number)) {
+         offset = align_offset(chunk_end);
+
+         context.stream.discard(std::min(offset, end));
+
+         continue;
+      }
+
+      const auto window_end = find_window_end(context, header, chunk_end, end);
+      const auto window_size = static_cast<std::size_t>(window_end - offset);
+
+      auto buffer = acquire_buffer(context, window_size + chunk_header_size);
+      auto bytes = buffer.span();
+
+      // Give the window a header of its own so it can act as the parent reader.
+      const auto window_mn = "ucfb"_mn;
+      const auto window_chunk_size = static_cast<std::uint32_t>(window_size);
+
+      std::memcpy(&bytes[0], &window_mn, sizeof(window_mn));
+      std::memcpy(&bytes[4], &window_chunk_size, sizeof(window_chunk_size));
+
+      context.stream.read(offset, bytes.subspan(chunk_header_size));
+
+      context.tasks.run([buffer = std::make_shared<Buffer_pool::Buffer>(
+                            std::move(buffer)),
+                         &context, &models_builder,
+                         file = instrumentation::current_file()] {
+         const instrumentation::File_scope file_scope{file};
+
+         Ucfb_reader window{std::as_const(*buffer).span()};
+
+         while (window) {
+            const auto chunk = window.read_child();
+
+            process_chunk(chunk, window, context.app_options, context.file_saver,
+                          context.swbf_hashes, models_builder, context.layer_index);
+         }
+      });
+
+      offset = align_offset(window_end);
+   }
+}
+
+void save_models(model::Models_builder& models_builder, const App_options& app_options,
+                 File_saver& file_saver)
+{
+   models_builder.save_models(file_saver, app_options.output_game_version(),
+                              app_options.model_format(),
+                              app_options.model_discard_flags());
+}
+}
+
 void handle_ucfb(Ucfb_reader chunk, const App_options& app_options,
                  File_saver& file_saver, const Swbf_fnv_hashes& swbf_hashes,
                  Layer_index& layer_index)
@@ -30,3 +169,40 @@ void handle_ucfb(Ucfb_reader chunk, const App_options& app_options,
                               app_options.model_format(),
                               app_options.model_discard_flags());
 }
+
+void handle_ucfb_streamed(Chunk_stream& stream, const std::size_t memory_ceiling,
+                          const App_options& app_options, File_saver& file_saver,
+                          const Swbf_fnv_hashes& swbf_hashes, Layer_index& layer_index)
+{
+   const auto root = stream.read_header(0);
+
+   if (root.magic_number != "ucfb"_mn) {
+      throw std::runtime_error{"Root chunk is not ucfb as expected."};
+   }
+
+   Buffer_pool buffer_pool{memory_ceiling};
+   tbb::task_group tasks;
+   model::Models_builder models_builder;
+   std::list<model::Models_builder> lvl_models_builders;
+
+   Stream_context context{stream,      buffer_pool, tasks,       lvl_models_builders,
+                          app_options, file_saver,  swbf_hashes, layer_index};
+
+   try {
+      stream_children(context, chunk_header_size, chunk_header_size + root.size,
+                      models_builder);
+   }
+   catch (...) {
+      tasks.wait();
+
+      throw;
+   }
+
+   tasks.wait();
+
+   for (auto& lvl_models_builder : lvl_models_builders) {
+      save_models(lvl_models_builder, app_options, file_saver);
+   }
+
+   save_models(models_builder, app_options, file_saver);
+}
@@ -38,6 +38,7 @@ void handle_unknown(Ucfb_reader chunk, File_saver& file_saver,
    file += view_object_as_string(static_cast<std::uint32_t>(chunk.size()));
    file += view_object_span_as_string(chunk.read_bytes(chunk.size()));
 
-   file_saver.save_file(file, "munged", file_name ? *file_name : get_unique_chunk_name(),
+   file_saver.save_file(std::move(file), "munged",
+                        file_name ? *file_name : get_unique_chunk_name(),
                         file_extension ? *file_extension : ".munged"sv);
 }
@@ -1,7 +1,9 @@
 
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
 #include "layer_index.hpp"
 #include "magic_number.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
 #include "swbf_fnv_hashes.hpp"
 #include "ucfb_reader.hpp"
@@ -98,7 +100,7 @@ void write_key_value(bool indent, std::string_view key, std::int64_t value,
 
    buffer += key;
    buffer += "("sv;
-   buffer += std::to_string(value);
+   number_format::append(buffer, value);
    buffer += ");\n"sv;
 }
 
@@ -109,13 +111,13 @@ void write_key_value(bool indent, std::string_view key, glm::quat value,
 
    buffer += key;
    buffer += '(';
-   buffer += std::to_string(value.w);
+   number_format::append(buffer, value.w);
    buffer += ", "sv;
-   buffer += std::to_string(value.x);
+   number_format::append(buffer, value.x);
    buffer += ", "sv;
-   buffer += std::to_string(value.y);
+   number_format::append(buffer, value.y);
    buffer += ", "sv;
-   buffer += std::to_string(value.z);
+   number_format::append(buffer, value.z);
    buffer += ");\n"sv;
 }
 
@@ -126,11 +128,11 @@ void write_key_value(bool indent, std::string_view key, glm::vec3 value,
 
    buffer += key;
    buffer += '(';
-   buffer += std::to_string(value.x);
+   number_format::append(buffer, value.x);
    buffer += ", "sv;
-   buffer += std::to_string(value.y);
+   number_format::append(buffer, value.y);
    buffer += ", "sv;
-   buffer += std::to_string(value.z);
+   number_format::append(buffer, value.z);
    buffer += ");\n"sv;
 }
 
@@ -139,19 +141,19 @@ void write_animation_key(std::string_view key, Animation_key value, std::string&
    buffer += '\t';
    buffer += key;
    buffer += '(';
-   buffer += std::to_string(value.time);
+   number_format::append(buffer, value.time);
    buffer += ", "sv;
-   buffer += std::to_string(value.data[0]);
+   number_format::append(buffer, value.data[0]);
    buffer += ", "sv;
-   buffer += std::to_string(value.data[1]);
+   number_format::append(buffer, value.data[1]);
    buffer += ", "sv;
-   buffer += std::to_string(value.data[2]);
+   number_format::append(buffer, value.data[2]);
    buffer += ", "sv;
-   buffer += std::to_string(static_cast<std::int16_t>(value.type));
+   number_format::append(buffer, static_cast<std::int16_t>(value.type));
 
    for (const auto& fl : value.spline_data) {
       buffer += ", "sv;
-      buffer += std::to_string(fl);
+      number_format::append(buffer, fl);
    }
 
    buffer.resize(buffer.size() - 2);
@@ -463,7 +465,7 @@ void process_region_entries(std::vector<Ucfb_reader_strict<"regn"_mn>> regions,
       read_region(region, swbf_hashes, buffer);
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".rgn"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".rgn"sv);
 }
 
 auto process_instance_entries(std::vector<Ucfb_reader_strict<"inst"_mn>> instances,
@@ -495,7 +497,7 @@ auto process_instance_entries(std::vector<Ucfb_reader_strict<"inst"_mn>> instanc
 
    if (terrain_name.empty() || sky_name.empty()) extension = ".lyr"sv;
 
-   file_saver.save_file(buffer, "world"sv, name, extension);
+   file_saver.save_file(std::move(buffer), "world"sv, name, extension);
 
    return layer;
 }
@@ -513,7 +515,7 @@ void process_barrier_entries(std::vector<Ucfb_reader_strict<"BARR"_mn>> barriers
       read_barrier(barrier, buffer);
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".bar"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".bar"sv);
 }
 
 void process_hint_entries(std::vector<Ucfb_reader_strict<"Hint"_mn>> hints,
@@ -527,7 +529,7 @@ void process_hint_entries(std::vector<Ucfb_reader_strict<"Hint"_mn>> hints,
       read_hint(hint, swbf_hashes, buffer);
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".hnt"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".hnt"sv);
 }
 
 void process_animation_entries(std::vector<Ucfb_reader> entries, std::string_view name,
@@ -548,13 +550,15 @@ void process_animation_entries(std::vector<Ucfb_reader> entries, std::string_vie
       }
    }
 
-   file_saver.save_file(buffer, "world"sv, name, ".anm"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".anm"sv);
 }
 }
 
 void handle_world(Ucfb_reader world, File_saver& file_saver,
                   const Swbf_fnv_hashes& swbf_hashes, Layer_index& layer_index)
 {
+   const instrumentation::Scope scope{"handle_world"sv, world.magic_number(), world.size()};
+
    const auto name = world.read_child_strict<"NAME"_mn>().read_string();
 
    std::string_view terrain_name;
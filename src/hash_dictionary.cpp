@@ -0,0 +1,114 @@
+#include "hash_dictionary.hpp"
+#include "swbf_fnv_hashes.hpp"
+
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+//! \brief Splits the bytes of a dictionary into lines, without their line endings.
+auto split_lines(gsl::span<const std::byte> bytes) -> std::vector<std::string_view>
+{
+   std::vector<std::string_view> lines;
+
+   const auto* const first = reinterpret_cast<const char*>(bytes.data());
+   const auto* const last = first + bytes.size();
+
+   for (const auto* line = first; line != last;) {
+      const auto remaining = static_cast<std::size_t>(last - line);
+      const auto* end = static_cast<const char*>(std::memchr(line, '\n', remaining));
+      const auto* const next = end ? end + 1 : last;
+
+      if (!end) end = last;
+      if (end != line && end[-1] == '\r') --end;
+
+      lines.emplace_back(line, static_cast<std::size_t>(end - line));
+
+      line = next;
+   }
+
+   return lines;
+}
+
+}
+
+auto Hash_dictionary::load(const fs::path& path) -> Hash_dictionary
+{
+   std::error_code error;
+
+   const auto file_size = fs::file_size(path, error);
+
+   if (error) throw std::runtime_error{"Failed to open file"s};
+
+   Hash_dictionary dictionary;
+
+   // Empty files can't be mapped.
+   if (file_size == 0) return dictionary;
+
+   dictionary._file = Mapped_file{path, Mapped_file::Access_pattern::sequential};
+
+   const auto lines = split_lines(dictionary._file.bytes());
+
+   std::vector<std::uint32_t> hashes;
+   hashes.resize(lines.size());
+
+   tbb::parallel_for(std::size_t{0}, lines.size(), std::size_t{4096},
+                     [&](const std::size_t first) {
+                        const auto last = std::min(first + 4096, lines.size());
+
+                        for (auto i = first; i < last; ++i) {
+                           hashes[i] = fnv_1a_hash(lines[i]);
+                        }
+                     });
+
+   // Keep the table at most half full so probe sequences stay short.
+   const auto capacity = std::bit_ceil(std::max(lines.size() * 2, std::size_t{16}));
+   const auto mask = capacity - 1;
+
+   dictionary._slots.resize(capacity);
+
+   for (std::size_t i = 0; i < lines.size(); ++i) {
+      for (auto slot = hashes[i] & mask;; slot = (slot + 1) & mask) {
+         auto& entry = dictionary._slots[slot];
+
+         if (!entry.string.data()) {
+            entry = {hashes[i], lines[i]};
+            dictionary._size += 1;
+
+            break;
+         }
+
+         if (entry.hash == hashes[i]) break;
+      }
+   }
+
+   return dictionary;
+}
+
+auto Hash_dictionary::find(const std::uint32_t hash) const noexcept
+   -> std::optional<std::string_view>
+{
+   if (_slots.empty()) return std::nullopt;
+
+   const auto mask = _slots.size() - 1;
+
+   for (auto slot = hash & mask;; slot = (slot + 1) & mask) {
+      const auto& entry = _slots[slot];
+
+      if (!entry.string.data()) return std::nullopt;
+      if (entry.hash == hash) return entry.string;
+   }
+}
+
+auto Hash_dictionary::size() const noexcept -> std::size_t
+{
+   return _size;
+}
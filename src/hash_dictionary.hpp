@@ -0,0 +1,45 @@
+#pragma once
+
+#include "mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+//! \brief An immutable table of strings by their fnv_1a_hash, loaded from a dictionary
+//! file holding one string per line.
+//!
+//! The file is mapped into memory and its lines are hashed in parallel. The hashes are
+//! placed in a single open addressing table of views into the mapping, so loading does
+//! no allocation per string and a lookup touches one or two cache lines.
+class Hash_dictionary {
+public:
+   Hash_dictionary() = default;
+
+   //! \brief Loads a dictionary. Trailing carriage returns are stripped from lines. When
+   //! strings share a hash the first in the file is kept.
+   //!
+   //! \param path The path to the dictionary.
+   //!
+   //! \exception std::runtime_error Thrown when the dictionary could not be opened.
+   static auto load(const std::filesystem::path& path) -> Hash_dictionary;
+
+   auto find(std::uint32_t hash) const noexcept -> std::optional<std::string_view>;
+
+   //! \brief Gets the number of distinct hashes in the dictionary.
+   auto size() const noexcept -> std::size_t;
+
+private:
+   //! \brief A slot in the table, empty slots have a null string.
+   struct Slot {
+      std::uint32_t hash = 0;
+      std::string_view string;
+   };
+
+   Mapped_file _file;
+   std::vector<Slot> _slots;
+   std::size_t _size = 0;
+};
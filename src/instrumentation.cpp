@@ -0,0 +1,439 @@
+#include "instrumentation.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace instrumentation {
+
+namespace {
+
+struct Sample {
+   std::string_view name;
+   Magic_number magic_number;
+   File_id file;
+   std::uint32_t thread;
+   std::int64_t start;
+   std::int64_t duration;
+   std::uint64_t bytes_in;
+   std::uint64_t bytes_out;
+};
+
+std::atomic_bool is_enabled = false;
+
+const auto start_time = std::chrono::steady_clock::now();
+
+//! \brief Threads TBB doesn't know of, such as the write-behind I/O threads, are
+//! numbered after the TBB workers.
+const std::uint32_t first_other_thread_id =
+   static_cast<std::uint32_t>(tbb::this_task_arena::max_concurrency());
+
+std::atomic_uint32_t next_other_thread_id = first_other_thread_id;
+
+thread_local const std::uint32_t other_thread_id = next_other_thread_id++;
+
+//! \brief Identifies the current thread by its index in the TBB arena it's working
+//! in, so events line up with the scheduler's view of the workers.
+auto current_thread_id() noexcept -> std::uint32_t
+{
+   const auto index = tbb::this_task_arena::current_thread_index();
+
+   if (index == tbb::task_arena::not_initialized) return other_thread_id;
+
+   return static_cast<std::uint32_t>(index);
+}
+
+auto thread_name(const std::uint32_t thread) -> std::string
+{
+   if (thread < first_other_thread_id) return fmt::format("worker {}", thread);
+
+   return fmt::format("thread {}", thread - first_other_thread_id);
+}
+thread_local File_id thread_file = no_file;
+thread_local std::uint64_t thread_bytes_out = 0;
+
+std::mutex files_mutex;
+std::vector<std::string> files;
+
+tbb::enumerable_thread_specific<std::vector<Sample>> thread_samples;
+
+auto now() noexcept -> std::int64_t
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start_time)
+      .count();
+}
+
+auto file_name(const File_id file) -> std::string_view
+{
+   if (file == no_file) return ""sv;
+
+   std::lock_guard lock{files_mutex};
+
+   return files.at(file);
+}
+
+auto magic_number_name(const Magic_number magic_number) -> std::string
+{
+   const auto number = static_cast<std::uint32_t>(magic_number);
+
+   if (number == 0) return ""s;
+
+   std::string name;
+
+   for (auto i = 0u; i < 4u; ++i) {
+      const auto c = static_cast<char>((number >> (i * 8u)) & 0xffu);
+
+      if (!std::isprint(static_cast<unsigned char>(c))) {
+         return serialize_magic_number(magic_number);
+      }
+
+      name += c;
+   }
+
+   return name;
+}
+
+auto escape_json(std::string_view string) -> std::string
+{
+   std::string escaped;
+   escaped.reserve(string.size());
+
+   for (const auto c : string) {
+      if (c == '"' || c == '\\') {
+         escaped += '\\';
+         escaped += c;
+      }
+      else if (static_cast<unsigned char>(c) < 0x20) {
+         escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+      }
+      else {
+         escaped += c;
+      }
+   }
+
+   return escaped;
+}
+
+auto escape_csv(std::string_view string) -> std::string
+{
+   if (string.find_first_of(",\"\n"sv) == string.npos) return std::string{string};
+
+   std::string escaped{'"'};
+
+   for (const auto c : string) {
+      if (c == '"') escaped += '"';
+
+      escaped += c;
+   }
+
+   return escaped += '"';
+}
+
+struct Aggregate {
+   std::uint64_t count = 0;
+   std::int64_t total = 0;
+   std::int64_t max = 0;
+   std::uint64_t bytes_in = 0;
+   std::uint64_t bytes_out = 0;
+   std::set<std::uint32_t> threads;
+
+   // Sums for fitting duration = fixed + per_byte * bytes_in.
+   double sum_x = 0.0;
+   double sum_y = 0.0;
+   double sum_xx = 0.0;
+   double sum_xy = 0.0;
+
+   void add(const Sample& sample)
+   {
+      count += 1;
+      total += sample.duration;
+      max = std::max(max, sample.duration);
+      bytes_in += sample.bytes_in;
+      bytes_out += sample.bytes_out;
+      threads.insert(sample.thread);
+
+      const auto x = static_cast<double>(sample.bytes_in);
+      const auto y = static_cast<double>(sample.duration);
+
+      sum_x += x;
+      sum_y += y;
+      sum_xx += x * x;
+      sum_xy += x * y;
+   }
+
+   //! Least squares fit of nanoseconds against bytes in, as "per_byte, fixed".
+   auto cost_fit() const noexcept -> std::pair<double, double>
+   {
+      const auto n = static_cast<double>(count);
+      const auto denominator = n * sum_xx - sum_x * sum_x;
+
+      if (count < 2 || denominator <= 0.0) return {0.0, sum_y / std::max(n, 1.0)};
+
+      const auto per_byte = std::max((n * sum_xy - sum_x * sum_y) / denominator, 0.0);
+      const auto fixed = std::max((sum_y - per_byte * sum_x) / n, 0.0);
+
+      return {per_byte, fixed};
+   }
+};
+
+using Group_key = std::tuple<std::string_view, std::string>;
+
+struct Report {
+   std::int64_t wall_time = 0;
+   std::set<std::uint32_t> threads;
+   std::map<Group_key, Aggregate> by_magic_number;
+   std::map<Group_key, Aggregate> by_file;
+};
+
+auto build_report() -> Report
+{
+   Report report;
+
+   report.wall_time = now();
+
+   for (const auto& samples : thread_samples) {
+      for (const auto& sample : samples) {
+         report.threads.insert(sample.thread);
+         report.by_magic_number[{sample.name, magic_number_name(sample.magic_number)}]
+            .add(sample);
+         report.by_file[{sample.name, std::string{file_name(sample.file)}}].add(sample);
+      }
+   }
+
+   return report;
+}
+
+auto to_seconds(const std::int64_t nanoseconds) noexcept -> double
+{
+   return static_cast<double>(nanoseconds) / 1'000'000'000.0;
+}
+
+void write_json_group(std::ofstream& output, std::string_view key_name,
+                      const std::map<Group_key, Aggregate>& group, const bool fit)
+{
+   bool first = true;
+
+   for (const auto& [key, aggregate] : group) {
+      const auto& [scope, name] = key;
+
+      output << (std::exchange(first, false) ? "\n"sv : ",\n"sv);
+      output << fmt::format("    {{\"scope\": \"{}\", \"{}\": \"{}\", \"count\": {}, "
+                            "\"seconds\": {:.6f}, \"max_seconds\": {:.6f}, "
+                            "\"bytes_in\": {}, \"bytes_out\": {}, \"threads\": {}",
+                            escape_json(scope), key_name, escape_json(name),
+                            aggregate.count, to_seconds(aggregate.total),
+                            to_seconds(aggregate.max), aggregate.bytes_in,
+                            aggregate.bytes_out, aggregate.threads.size());
+
+      if (fit) {
+         const auto [per_byte, fixed] = aggregate.cost_fit();
+
+         output << fmt::format(", \"ns_per_byte\": {:.6f}, \"ns_fixed\": {:.1f}", per_byte,
+                               fixed);
+      }
+
+      output << '}';
+   }
+}
+
+void write_json(std::ofstream& output, const Report& report)
+{
+   output << fmt::format("{{\n  \"seconds\": {:.6f},\n  \"threads\": {},\n",
+                         to_seconds(report.wall_time), report.threads.size());
+
+   output << "  \"by_magic_number\": ["sv;
+   write_json_group(output, "magic_number"sv, report.by_magic_number, true);
+   output << "\n  ],\n"sv;
+
+   output << "  \"by_file\": ["sv;
+   write_json_group(output, "file"sv, report.by_file, false);
+   output << "\n  ]\n}\n"sv;
+}
+
+void write_csv_group(std::ofstream& output, std::string_view group_name,
+                     const std::map<Group_key, Aggregate>& group)
+{
+   for (const auto& [key, aggregate] : group) {
+      const auto& [scope, name] = key;
+      const auto [per_byte, fixed] = aggregate.cost_fit();
+
+      output << fmt::format("{},{},{},{},{:.6f},{:.6f},{},{},{},{:.6f},{:.1f}\n",
+                            group_name, escape_csv(scope), escape_csv(name),
+                            aggregate.count, to_seconds(aggregate.total),
+                            to_seconds(aggregate.max), aggregate.bytes_in,
+                            aggregate.bytes_out, aggregate.threads.size(), per_byte,
+                            fixed);
+   }
+}
+
+void write_csv(std::ofstream& output, const Report& report)
+{
+   output << "group,scope,key,count,seconds,max_seconds,bytes_in,bytes_out,threads,"
+             "ns_per_byte,ns_fixed\n"sv;
+
+   write_csv_group(output, "magic_number"sv, report.by_magic_number);
+   write_csv_group(output, "file"sv, report.by_file);
+}
+}
+
+void enable() noexcept
+{
+   is_enabled = true;
+}
+
+bool enabled() noexcept
+{
+   return is_enabled.load(std::memory_order_relaxed);
+}
+
+auto register_file(std::string_view file) -> File_id
+{
+   if (!enabled()) return no_file;
+
+   std::lock_guard lock{files_mutex};
+
+   const auto it = std::find(files.cbegin(), files.cend(), file);
+
+   if (it != files.cend()) return static_cast<File_id>(it - files.cbegin());
+
+   files.emplace_back(file);
+
+   return static_cast<File_id>(files.size() - 1);
+}
+
+auto current_file() noexcept -> File_id
+{
+   return thread_file;
+}
+
+File_scope::File_scope(File_id file) noexcept
+   : _previous_file{std::exchange(thread_file, file)}
+{
+}
+
+File_scope::~File_scope()
+{
+   thread_file = _previous_file;
+}
+
+Scope::Scope(std::string_view name, Magic_number magic_number, std::size_t bytes_in) noexcept
+   : _name{name}, _magic_number{magic_number}, _bytes_in{bytes_in}
+{
+   if (!enabled()) return;
+
+   _active = true;
+   _bytes_out_start = thread_bytes_out;
+   _start = now();
+}
+
+Scope::~Scope()
+{
+   if (!_active) return;
+
+   const auto end = now();
+
+   try {
+      thread_samples.local().push_back({.name = _name,
+                                        .magic_number = _magic_number,
+                                        .file = thread_file,
+                                        .thread = current_thread_id(),
+                                        .start = _start,
+                                        .duration = end - _start,
+                                        .bytes_in = _bytes_in,
+                                        .bytes_out = thread_bytes_out - _bytes_out_start});
+   }
+   catch (std::bad_alloc&) {
+   }
+}
+
+void add_bytes_out(std::size_t bytes) noexcept
+{
+   thread_bytes_out += bytes;
+}
+
+void write_report(const fs::path& path)
+{
+   std::ofstream output{path};
+
+   if (!output) throw std::runtime_error{"Failed to open report file for writing."};
+
+   const auto report = build_report();
+
+   if (path.extension() == ".json"sv) {
+      write_json(output, report);
+   }
+   else {
+      write_csv(output, report);
+   }
+
+   if (!output) throw std::runtime_error{"Failed to write report file."};
+}
+
+void write_trace(const fs::path& path)
+{
+   std::ofstream output{path};
+
+   if (!output) throw std::runtime_error{"Failed to open trace file for writing."};
+
+   // Timestamps and durations in trace events are in microseconds.
+   const auto to_microseconds = [](const std::int64_t nanoseconds) {
+      return static_cast<double>(nanoseconds) / 1000.0;
+   };
+
+   output << "{\"traceEvents\": ["sv;
+
+   bool first = true;
+
+   std::set<std::uint32_t> threads;
+
+   for (const auto& samples : thread_samples) {
+      for (const auto& sample : samples) threads.insert(sample.thread);
+   }
+
+   for (const auto thread : threads) {
+      output << (std::exchange(first, false) ? "\n"sv : ",\n"sv);
+      output << fmt::format("{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+                            "\"tid\": {}, \"args\": {{\"name\": \"{}\"}}}}",
+                            thread, thread_name(thread));
+   }
+
+   for (const auto& samples : thread_samples) {
+      for (const auto& sample : samples) {
+         output << (std::exchange(first, false) ? "\n"sv : ",\n"sv);
+         output << fmt::format(
+            "{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"ts\": {:.3f}, "
+            "\"dur\": {:.3f}, \"pid\": 1, \"tid\": {}, \"args\": {{\"file\": \"{}\", "
+            "\"magic_number\": \"{}\", \"bytes_in\": {}, \"bytes_out\": {}}}}}",
+            escape_json(sample.name),
+            sample.magic_number == Magic_number{} ? "task"sv : "chunk"sv,
+            to_microseconds(sample.start), to_microseconds(sample.duration),
+            sample.thread, escape_json(file_name(sample.file)),
+            escape_json(magic_number_name(sample.magic_number)), sample.bytes_in,
+            sample.bytes_out);
+      }
+   }
+
+   output << "\n]}\n"sv;
+
+   if (!output) throw std::runtime_error{"Failed to write trace file."};
+}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "magic_number.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+//! \brief Optional timing of the work done during a run.
+//!
+//! Scopes record their wall time, the bytes they read and wrote and the thread they ran
+//! on. Recording is off unless enable is called, in which case a disabled Scope costs a
+//! single branch.
+namespace instrumentation {
+
+using File_id = std::uint32_t;
+
+constexpr File_id no_file = 0xffffffffu;
+
+//! \brief Turns on recording. Should be called before any work starts.
+void enable() noexcept;
+
+bool enabled() noexcept;
+
+//! \brief Gets the id scopes attributed to a file are reported under.
+auto register_file(std::string_view file) -> File_id;
+
+//! \brief Gets the file scopes on the current thread are being attributed to.
+auto current_file() noexcept -> File_id;
+
+//! \brief Attributes scopes on the current thread to a file for its lifetime.
+class File_scope {
+public:
+   explicit File_scope(File_id file) noexcept;
+
+   File_scope(const File_scope&) = delete;
+   File_scope& operator=(const File_scope&) = delete;
+
+   ~File_scope();
+
+private:
+   File_id _previous_file;
+};
+
+//! \brief Records the time taken between construction and destruction on the current
+//! thread.
+class Scope {
+public:
+   //! \param name The name of the scope. Must outlive the run, usually a literal.
+   //! \param magic_number The magic number of the chunk being worked on, if any.
+   //! \param bytes_in The number of bytes being read.
+   explicit Scope(std::string_view name, Magic_number magic_number = {},
+                  std::size_t bytes_in = 0) noexcept;
+
+   Scope(const Scope&) = delete;
+   Scope& operator=(const Scope&) = delete;
+
+   ~Scope();
+
+private:
+   std::string_view _name;
+   Magic_number _magic_number;
+   std::size_t _bytes_in;
+   std::uint64_t _bytes_out_start = 0;
+   std::int64_t _start = 0;
+   bool _active = false;
+};
+
+//! \brief Counts bytes written by the current thread towards any open scopes.
+void add_bytes_out(std::size_t bytes) noexcept;
+
+//! \brief Writes the recorded scopes, aggregated per magic number and per file.
+//!
+//! The report is JSON if the path has a .json extension and CSV otherwise.
+//!
+//! \exception std::runtime_error Thrown when the report could not be written.
+void write_report(const std::filesystem::path& path);
+
+//! \brief Writes every recorded scope as a Chrome trace event file.
+//!
+//! \exception std::runtime_error Thrown when the trace could not be written.
+void write_trace(const std::filesystem::path& path);
+
+}
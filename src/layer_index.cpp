@@ -31,6 +31,6 @@ void Layer_index::save(File_saver& saver)
          buffer += "}\n\n";
       }
 
-      saver.save_file(buffer, "world", name, ".LDX");
+      saver.save_file(std::move(buffer), "world", name, ".LDX");
    }
 }
\ No newline at end of file
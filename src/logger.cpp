@@ -0,0 +1,234 @@
+#include "logger.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace std::literals;
+
+namespace logger {
+
+namespace {
+
+struct Message {
+   std::atomic<Message*> next = nullptr;
+   Level level = Level::info;
+   std::string text;
+};
+
+//! Intrusive multiple producer single consumer queue (Dmitry Vyukov's design). Pushing
+//! is a single atomic exchange, so producers never wait on each other or the consumer.
+class Message_queue {
+public:
+   void push(Message* message) noexcept
+   {
+      message->next.store(nullptr, std::memory_order_relaxed);
+
+      Message* const previous = _head.exchange(message, std::memory_order_acq_rel);
+
+      previous->next.store(message, std::memory_order_release);
+   }
+
+   //! Only to be called from the consumer thread. May return nullptr while a push is
+   //! in progress.
+   auto pop() noexcept -> Message*
+   {
+      Message* tail = _tail;
+      Message* next = tail->next.load(std::memory_order_acquire);
+
+      if (tail == &_stub) {
+         if (!next) return nullptr;
+
+         _tail = next;
+         tail = next;
+         next = next->next.load(std::memory_order_acquire);
+      }
+
+      if (next) {
+         _tail = next;
+
+         return tail;
+      }
+
+      if (tail != _head.load(std::memory_order_acquire)) return nullptr;
+
+      push(&_stub);
+
+      next = tail->next.load(std::memory_order_acquire);
+
+      if (!next) return nullptr;
+
+      _tail = next;
+
+      return tail;
+   }
+
+private:
+   Message _stub;
+   std::atomic<Message*> _head = &_stub;
+   Message* _tail = &_stub;
+};
+
+std::atomic<Level> log_level = Level::info;
+
+Message_queue queue;
+std::atomic_uint32_t queue_sequence = 0;
+std::atomic_bool writer_running = false;
+std::atomic_bool writer_stopping = false;
+std::thread writer_thread;
+
+std::mutex direct_write_mutex;
+//! Guarded by direct_write_mutex. Set once the writer thread has exited, from then on
+//! threads that pushed a message as it stopped drain the queue themselves.
+bool writer_stopped = true;
+
+auto prefix(const Level level) noexcept -> std::string_view
+{
+   switch (level) {
+   case Level::debug:
+      return "Debug: "sv;
+   case Level::warning:
+      return "Warning: "sv;
+   case Level::error:
+      return "Error: "sv;
+   default:
+      return ""sv;
+   }
+}
+
+void output(const Level level, std::string_view text)
+{
+   std::cout << prefix(level) << text;
+
+   if (text.empty() || text.back() != '\n') std::cout << '\n';
+}
+
+void drain_queue()
+{
+   bool wrote = false;
+
+   while (Message* const message = queue.pop()) {
+      output(message->level, message->text);
+
+      delete message;
+
+      wrote = true;
+   }
+
+   if (wrote) std::cout.flush();
+}
+
+void run_writer()
+{
+   for (;;) {
+      const auto sequence = queue_sequence.load(std::memory_order_acquire);
+
+      drain_queue();
+
+      if (writer_stopping.load(std::memory_order_acquire) &&
+          sequence == queue_sequence.load(std::memory_order_acquire)) {
+         drain_queue();
+
+         return;
+      }
+
+      queue_sequence.wait(sequence, std::memory_order_acquire);
+   }
+}
+
+}
+
+void set_level(Level level) noexcept
+{
+   log_level.store(level, std::memory_order_relaxed);
+}
+
+bool enabled(Level level) noexcept
+{
+   return level >= log_level.load(std::memory_order_relaxed);
+}
+
+Writer::Writer()
+{
+   {
+      std::lock_guard lock{direct_write_mutex};
+
+      writer_stopped = false;
+   }
+
+   writer_stopping = false;
+   writer_thread = std::thread{run_writer};
+   writer_running = true;
+}
+
+Writer::~Writer()
+{
+   writer_running = false;
+
+   // Pairs with the fence in submit. A thread that pushed a message and then still saw
+   // the writer running pushed it before this, so the drain below will find it.
+   std::atomic_thread_fence(std::memory_order_seq_cst);
+
+   writer_stopping = true;
+
+   queue_sequence.fetch_add(1, std::memory_order_release);
+   queue_sequence.notify_one();
+
+   writer_thread.join();
+
+   std::lock_guard lock{direct_write_mutex};
+
+   writer_stopped = true;
+
+   // Anything pushed by a thread that saw the writer running just before it stopped.
+   drain_queue();
+
+   std::cout.flush();
+}
+
+namespace detail {
+
+auto thread_buffer() -> std::ostringstream&
+{
+   thread_local std::ostringstream buffer;
+
+   return buffer;
+}
+
+void submit(Level level, std::string message)
+{
+   if (!writer_running.load(std::memory_order_acquire)) {
+      std::lock_guard lock{direct_write_mutex};
+
+      output(level, message);
+
+      return;
+   }
+
+   queue.push(new Message{.level = level, .text = std::move(message)});
+
+   std::atomic_thread_fence(std::memory_order_seq_cst);
+
+   // The writer stopped while the message was being pushed, it may have already done
+   // its final drain. The queue's consumer is whoever holds direct_write_mutex once
+   // the writer thread has exited.
+   if (!writer_running.load(std::memory_order_relaxed)) {
+      std::lock_guard lock{direct_write_mutex};
+
+      if (writer_stopped) {
+         drain_queue();
+
+         std::cout.flush();
+      }
+
+      return;
+   }
+
+   queue_sequence.fetch_add(1, std::memory_order_release);
+   queue_sequence.notify_one();
+}
+
+}
+
+}
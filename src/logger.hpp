@@ -0,0 +1,80 @@
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+//! \brief Logging that doesn't serialise the threads producing messages.
+//!
+//! Messages are formatted into a buffer owned by the calling thread and then pushed onto
+//! a lock-free queue. While a Writer exists a single thread drains that queue to standard
+//! output, otherwise messages are written immediately.
+namespace logger {
+
+enum class Level { debug, info, warning, error };
+
+void set_level(Level level) noexcept;
+
+bool enabled(Level level) noexcept;
+
+//! \brief Owns the thread that writes out queued messages. On destruction the queue is
+//! drained.
+class Writer {
+public:
+   Writer();
+
+   Writer(const Writer&) = delete;
+   Writer& operator=(const Writer&) = delete;
+
+   ~Writer();
+};
+
+namespace detail {
+
+auto thread_buffer() -> std::ostringstream&;
+
+void submit(Level level, std::string message);
+
+}
+
+template<typename... Args>
+inline void write(const Level level, Args&&... args)
+{
+   if (!enabled(level)) return;
+
+   auto& buffer = detail::thread_buffer();
+
+   buffer.str({});
+   buffer.clear();
+
+   (buffer << ... << std::forward<Args>(args));
+
+   detail::submit(level, std::move(buffer).str());
+}
+
+template<typename... Args>
+inline void debug(Args&&... args)
+{
+   write(Level::debug, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+inline void info(Args&&... args)
+{
+   write(Level::info, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+inline void warning(Args&&... args)
+{
+   write(Level::warning, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+inline void error(Args&&... args)
+{
+   write(Level::error, std::forward<Args>(args)...);
+}
+
+}
@@ -1,14 +1,23 @@
 
 #include "app_options.hpp"
 #include "assemble_chunks.hpp"
+#include "benchmark.hpp"
 #include "chunk_handlers.hpp"
+#include "chunk_stream.hpp"
+#include "create_swbf_hashes.hpp"
 #include "explode_chunk.hpp"
+#include "extract_scheduler.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
 #include "layer_index.hpp"
+#include "logger.hpp"
 #include "mapped_file.hpp"
+#include "number_format.hpp"
+#include "output_dedup.hpp"
+#include "output_sink.hpp"
 #include "swbf_fnv_hashes.hpp"
-#include "synced_cout.hpp"
 #include "ucfb_reader.hpp"
+#include "write_behind.hpp"
 
 #include "tbb/parallel_for_each.h"
 
@@ -17,9 +26,13 @@
 #include <filesystem>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 
 namespace fs = std::filesystem;
 using namespace std::literals;
@@ -28,155 +41,90 @@ const auto usage = R"(Usage: swbf-unmunge <options>
 
 Options:)"s;
 
-constexpr std::array common_layer_suffixes{"_1ctf"sv
-                                           "_1flag"sv
-                                           "_Buildings"sv
-                                           "_Buildings01"sv
-                                           "_Buildings02"sv
-                                           "_CP-Assult"sv
-                                           "_CP-Conquest"sv
-                                           "_CP-VehicleSpawns"sv
-                                           "_CP-VehicleSpawns"sv
-                                           "_CPs"sv
-                                           "_CommonDesign"sv
-                                           "_CW-Ships"sv
-                                           "_GCW-Ships"sv
-                                           "_Damage"sv
-                                           "_Damage01"sv
-                                           "_Damage02"sv
-                                           "_Death"sv
-                                           "_DeathRegions"sv
-                                           "_Design"sv
-                                           "_Design001"sv
-                                           "_Design002"sv
-                                           "_Design01"sv
-                                           "_Design02"sv
-                                           "_Design1"sv
-                                           "_Design2"sv
-                                           "_Doors"sv
-                                           "_Layer000"sv
-                                           "_Layer001"sv
-                                           "_Layer002"sv
-                                           "_Layer003"sv
-                                           "_Layer004"sv
-                                           "_Light_RG"sv
-                                           "_NewObjective"sv
-                                           "_Objective"sv
-                                           "_Platforms"sv
-                                           "_Props"sv
-                                           "_RainShadow"sv
-                                           "_Roids"sv
-                                           "_Roids01"sv
-                                           "_Roids02"sv
-                                           "_Shadow_RGN"sv
-                                           "_Shadows"sv
-                                           "_Shields"sv
-                                           "_SoundEmmiters"sv
-                                           "_SoundRegions"sv
-                                           "_SoundSpaces"sv
-                                           "_SoundTriggers"sv
-                                           "_Temp"sv
-                                           "_Tree"sv
-                                           "_Trees"sv
-                                           "_Vehicles"sv
-                                           "_animations"sv
-                                           "_campaign"sv
-                                           "_collision"sv
-                                           "_con"sv
-                                           "_conquest"sv
-                                           "_ctf"sv
-                                           "_deathreagen"sv
-                                           "_droids"sv
-                                           "_eli"sv
-                                           "_flags"sv
-                                           "_gunship"sv
-                                           "_hunt"sv
-                                           "_invisocube"sv
-                                           "_light_region"sv
-                                           "_objects01"sv
-                                           "_objects02"sv
-                                           "_reflections"sv
-                                           "_rumble"sv
-                                           "_rumbles"sv
-                                           "_sound"sv
-                                           "_tdm"sv
-                                           "_trees"sv
-                                           "_turrets"sv
-                                           "_xl"sv};
-
-void extract_file(const App_options& options, fs::path path) noexcept
+auto get_output_directory(const fs::path& path) -> fs::path
+{
+   // Standard input has no name of its own to give the output directory.
+   if (path == "-"sv) return "stdin/"s;
+
+   return fs::path{path}.replace_extension("") += '/';
+}
+
+void stream_file(const App_options& options, fs::path path,
+                 std::shared_ptr<const Swbf_fnv_hashes> base_hashes) noexcept
 {
    try {
+      const instrumentation::File_scope file_scope{
+         instrumentation::register_file(path.string())};
+      const instrumentation::Scope scope{"stream_file"sv};
 
-      Mapped_file file{path};
-      File_saver file_saver{fs::path{path}.replace_extension("") += '/',
-                            options.verbose()};
-      Swbf_fnv_hashes swbf_hashes;
+      const auto output_directory = get_output_directory(path);
+
+      File_saver file_saver{
+         output_directory, options.verbose(),
+         create_output_sink(output_directory, options.archive_output())};
+      const Swbf_fnv_hashes swbf_hashes{std::move(base_hashes)};
       Layer_index layer_index;
 
-      if (!options.user_string_dict().empty()) {
-
-         if (fs::exists(options.user_string_dict())) {
-            try {
-               read_swbf_fnv_hash_dictionary(swbf_hashes, options.user_string_dict());
-            }
-            catch (std::exception& e) {
-               synced_cout::print(
-                  "Error: Exception occured while reading string dictionary.\n   Path: "s,
-                  options.user_string_dict(), '\n', "   Message: "s, e.what(), '\n');
-            }
-         }
-         else {
-            std::cout << "Error: file '"s << options.user_string_dict()
-                      << "' does not exist\n";
-         }
-      }
+      Chunk_stream stream{path};
 
-      for (const auto& input_file : options.input_files()) {
-         const auto name = fs::path{input_file}.stem().string();
+      logger::info("Processing File: "s, path.string(), '\n');
 
-         swbf_hashes.add(name);
-         swbf_hashes.add("mapname.description."s += name);
-         swbf_hashes.add("mapname.name."s += name);
+      handle_ucfb_streamed(stream, options.stream_memory_ceiling(), options, file_saver,
+                           swbf_hashes, layer_index);
 
-         for (const auto& suffix : common_layer_suffixes) {
-            swbf_hashes.add(std::string{name} += suffix);
-         }
-      }
+      layer_index.save(file_saver);
+   }
+   catch (std::exception& e) {
+      logger::error("Exception occured while processing file.\n   File: "s,
+                    path.string(), '\n', "   Message: "s, e.what(), '\n');
+   }
+}
 
-      Ucfb_reader root_reader{file.bytes()};
+void extract_files(const App_options& options)
+{
+   Extract_scheduler scheduler{options};
+
+   // Every file looks hashes up in one shared dictionary, loaded once.
+   const auto base_hashes = create_swbf_hashes(options);
 
-      if (root_reader.magic_number() != "ucfb"_mn) {
-         throw std::runtime_error{"Root chunk is not ucfb as expected."};
+   tbb::parallel_for_each(options.input_files(), [&](const fs::path path) {
+      if (options.stream_input() || path == "-"sv) {
+         return stream_file(options, path, base_hashes);
       }
 
-      synced_cout::print("Processing File: "s, path.string(), '\n');
+      try {
+         scheduler.add_file(path, get_output_directory(path),
+                            Swbf_fnv_hashes{base_hashes});
+      }
+      catch (std::exception& e) {
+         logger::error("Exception occured while processing file.\n   File: "s,
+                       path.string(), '\n', "   Message: "s, e.what(), '\n');
+      }
+   });
 
-      handle_ucfb(static_cast<Ucfb_reader>(root_reader), options, file_saver, swbf_hashes,
-                  layer_index);
+   scheduler.run();
 
-      layer_index.save(file_saver);
-   }
-   catch (std::exception& e) {
-      synced_cout::print("Error: Exception occured while processing file.\n   File: "s,
-                         path.string(), '\n', "   Message: "s, e.what(), '\n');
-   }
+   base_hashes->log_unknown_hashes();
 }
 
 void explode_file(const App_options& options, fs::path path) noexcept
 {
    try {
-      Mapped_file file{path};
-      File_saver file_saver{fs::path{path}.replace_extension("") += '/',
-                            options.verbose()};
+      Mapped_file file{path, Mapped_file::Access_pattern::sequential,
+                       options.prefault_files()};
+      const auto output_directory = fs::path{path}.replace_extension("") += '/';
+
+      File_saver file_saver{
+         output_directory, options.verbose(),
+         create_output_sink(output_directory, options.archive_output())};
 
       Ucfb_reader root_reader{file.bytes()};
 
       explode_chunk(root_reader, file_saver);
    }
    catch (std::exception& e) {
-      synced_cout::print("Error: Exception occured while processing file.\n   File: "s,
-                         path.string(), '\n', "   Message: "s, e.what(), '\n');
+      logger::error("Exception occured while processing file.\n   File: "s,
+                    path.string(), '\n', "   Message: "s, e.what(), '\n');
    }
 }
 
@@ -189,8 +137,8 @@ void assemble_directory(const App_options& options, fs::path path) noexcept
       assemble_chunks(path, file_saver);
    }
    catch (std::exception& e) {
-      synced_cout::print(
-         "Error: Exception occured while assembling directory.\n   Directory: "s,
+      logger::error(
+         "Exception occured while assembling directory.\n   Directory: "s,
          path.string(), '\n', "   Message: "s, e.what(), '\n');
    }
 }
@@ -198,7 +146,6 @@ void assemble_directory(const App_options& options, fs::path path) noexcept
 auto get_file_processor(const Tool_mode mode)
    -> std::function<void(const App_options&, fs::path)>
 {
-   if (mode == Tool_mode::extract) return extract_file;
    if (mode == Tool_mode::explode) return explode_file;
    if (mode == Tool_mode::assemble) return assemble_directory;
 
@@ -227,13 +174,93 @@ int main(int argc, char* argv[])
       return 0;
    }
 
+#ifdef _WIN32
    CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+#endif
 
-   const auto processor = get_file_processor(app_options.tool_mode());
+   logger::set_level(app_options.log_level());
 
-   tbb::parallel_for_each(input_files, [&app_options, &processor](const auto& file) {
-      processor(app_options, file);
-   });
+   const logger::Writer log_writer;
+
+   std::optional<write_behind::Writer> file_writer;
+
+   if (app_options.write_threads() != 0) {
+      file_writer.emplace(app_options.write_threads(), app_options.write_memory_ceiling());
+   }
+
+   if (!app_options.report_file().empty() || !app_options.trace_file().empty()) {
+      instrumentation::enable();
+   }
+
+   if (app_options.exact_floats()) number_format::enable_exact_floats();
+
+   if (app_options.dedup_outputs()) {
+      if (app_options.archive_output()) {
+         logger::warning("-dedup and -cache have no effect with -archive.\n"s);
+      }
+      else {
+         output_dedup::enable();
+
+         if (!app_options.extract_cache_file().empty()) {
+            output_dedup::load_cache(app_options.extract_cache_file(), app_options);
+         }
+      }
+   }
+
+   if (app_options.tool_mode() == Tool_mode::extract) {
+      extract_files(app_options);
+   }
+   else if (app_options.tool_mode() == Tool_mode::bench) {
+      // Benchmarks are run one directory at a time so they don't compete for cores.
+      for (const auto& directory : input_files) run_benchmarks(app_options, directory);
+   }
+   else {
+      const auto processor = get_file_processor(app_options.tool_mode());
+
+      tbb::parallel_for_each(input_files, [&app_options, &processor](const auto& file) {
+         processor(app_options, file);
+      });
+   }
+
+   // Make sure the time spent writing queued files is in the report and trace.
+   write_behind::flush();
+
+   output_dedup::log_savings();
+
+   if (output_dedup::enabled() && !app_options.extract_cache_file().empty()) {
+      try {
+         output_dedup::save_cache(app_options.extract_cache_file());
+      }
+      catch (std::exception& e) {
+         logger::error("Unable to save extraction cache.\n   Path: "s,
+                       app_options.extract_cache_file(), '\n', "   Message: "s, e.what(),
+                       '\n');
+      }
+   }
+
+   if (!app_options.report_file().empty()) {
+      try {
+         instrumentation::write_report(app_options.report_file());
+      }
+      catch (std::exception& e) {
+         logger::error("Unable to write report.\n   Path: "s,
+                       app_options.report_file(), '\n', "   Message: "s, e.what(),
+                       '\n');
+      }
+   }
+
+   if (!app_options.trace_file().empty()) {
+      try {
+         instrumentation::write_trace(app_options.trace_file());
+      }
+      catch (std::exception& e) {
+         logger::error("Unable to write trace.\n   Path: "s,
+                       app_options.trace_file(), '\n', "   Message: "s, e.what(),
+                       '\n');
+      }
+   }
 
+#ifdef _WIN32
    CoUninitialize();
+#endif
 }
@@ -1,15 +1,24 @@
 
 #include "mapped_file.hpp"
 
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-#include <limits>
+#include <stdexcept>
 
 namespace fs = std::filesystem;
 
 namespace {
 
+#ifdef _WIN32
+
 struct Raii_handle {
    Raii_handle(HANDLE handle) noexcept : handle(handle){};
 
@@ -25,24 +34,65 @@ struct Raii_handle {
 
    HANDLE handle;
 };
+
+DWORD get_access_flags(const Mapped_file::Access_pattern access_pattern) noexcept
+{
+   switch (access_pattern) {
+   case Mapped_file::Access_pattern::sequential:
+      return FILE_FLAG_SEQUENTIAL_SCAN;
+   case Mapped_file::Access_pattern::random:
+      return FILE_FLAG_RANDOM_ACCESS;
+   default:
+      return FILE_ATTRIBUTE_NORMAL;
+   }
 }
 
-Mapped_file::Mapped_file(fs::path path)
+#else
+
+struct Raii_fd {
+   Raii_fd(int fd) noexcept : fd(fd){};
+
+   ~Raii_fd() noexcept
+   {
+      if (fd != -1) close(fd);
+   }
+
+   operator int() noexcept
+   {
+      return fd;
+   }
+
+   int fd;
+};
+
+int get_advice(const Mapped_file::Access_pattern access_pattern) noexcept
 {
-   if (!fs::exists(path) || fs::is_directory(path)) {
-      throw std::runtime_error{"File does not exist."};
+   switch (access_pattern) {
+   case Mapped_file::Access_pattern::sequential:
+      return MADV_SEQUENTIAL;
+   case Mapped_file::Access_pattern::random:
+      return MADV_RANDOM;
+   default:
+      return MADV_NORMAL;
    }
+}
+
+#endif
+}
 
-   const auto file_size = fs::file_size(path);
+#ifdef _WIN32
 
-   if (file_size > std::numeric_limits<std::uint32_t>::max()) {
-      throw std::runtime_error{"File too large."};
+Mapped_file::Mapped_file(fs::path path, Access_pattern access_pattern, bool prefault)
+{
+   if (!fs::exists(path) || fs::is_directory(path)) {
+      throw std::runtime_error{"File does not exist."};
    }
 
-   _size = static_cast<std::uint32_t>(file_size);
+   _size = static_cast<std::size_t>(fs::file_size(path));
 
-   Raii_handle file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ,
-                                  NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   Raii_handle file =
+      CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                  OPEN_EXISTING, get_access_flags(access_pattern), NULL);
 
    if (file == INVALID_HANDLE_VALUE) throw std::invalid_argument{"File does not exist."};
 
@@ -57,9 +107,91 @@ Mapped_file::Mapped_file(fs::path path)
 
    if (_view == nullptr)
       throw std::runtime_error{"Unable to create view of file mapping."};
+
+   prefetch(access_pattern, prefault);
+}
+
+void Mapped_file::prefetch(Access_pattern, bool prefault) const noexcept
+{
+   // The access pattern was given to CreateFileW. PrefetchVirtualMemory reads in the
+   // whole range, unlike MADV_WILLNEED it isn't just a hint, so like MAP_POPULATE it's
+   // only used when prefaulting.
+   if (!_view || !prefault) return;
+
+   WIN32_MEMORY_RANGE_ENTRY range{_view.get(), _size};
+
+   PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#else
+
+Mapped_file::Mapped_file(fs::path path, Access_pattern access_pattern, bool prefault)
+{
+   if (!fs::exists(path) || fs::is_directory(path)) {
+      throw std::runtime_error{"File does not exist."};
+   }
+
+   Raii_fd file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+   if (file == -1) throw std::invalid_argument{"File does not exist."};
+
+   struct stat file_stat {
+   };
+
+   if (fstat(file, &file_stat) != 0) {
+      throw std::runtime_error{"Unable to query size of file."};
+   }
+
+   _size = static_cast<std::size_t>(file_stat.st_size);
+
+   // mmap rejects zero length mappings, an empty view is all we need anyway.
+   if (_size == 0) return;
+
+   int flags = MAP_PRIVATE;
+
+#ifdef MAP_POPULATE
+   if (prefault) flags |= MAP_POPULATE;
+#endif
+
+   void* const view = mmap(nullptr, _size, PROT_READ, flags, file, 0);
+
+   if (view == MAP_FAILED) {
+      throw std::runtime_error{"Unable to create view of file mapping."};
+   }
+
+   const auto unmapper = [size = _size](std::byte* view) { munmap(view, size); };
+
+   _view = {static_cast<std::byte*>(view), unmapper};
+
+   if (access_pattern == Access_pattern::normal) return;
+
+   // When prefaulting mmap has already read the file in.
+   if (prefault) {
+      madvise(view, _size, get_advice(access_pattern));
+
+      return;
+   }
+
+   prefetch(access_pattern, false);
 }
 
+void Mapped_file::prefetch(Access_pattern access_pattern, bool prefault) const noexcept
+{
+   if (!_view) return;
+
+   // Advice failing is harmless, the mapping is still perfectly usable.
+   madvise(_view.get(), _size, get_advice(access_pattern));
+
+#ifdef MADV_POPULATE_READ
+   if (prefault && madvise(_view.get(), _size, MADV_POPULATE_READ) == 0) return;
+#endif
+
+   madvise(_view.get(), _size, MADV_WILLNEED);
+}
+
+#endif
+
 gsl::span<const std::byte> Mapped_file::bytes() const noexcept
 {
-   return {_view.get(), _size};
+   return {_view.get(), static_cast<std::ptrdiff_t>(_size)};
 }
@@ -8,12 +8,32 @@
 
 class Mapped_file {
 public:
+   //! \brief Hint for how the contents of the mapping will be read.
+   //!
+   //! sequential - The file will be read front to back (explode mode).
+   //! random - The file will be read out of order, but in its entirety (extract mode).
+   //!
+   //! On POSIX both sequential and random also request that the whole file be read
+   //! ahead, so handlers don't stall on page faults when touching a cold file. On
+   //! Windows files are only read ahead when prefaulting.
+   enum class Access_pattern { normal, sequential, random };
+
    Mapped_file() = default;
-   Mapped_file(std::filesystem::path path);
+   Mapped_file(std::filesystem::path path,
+               Access_pattern access_pattern = Access_pattern::normal,
+               bool prefault = false);
 
    gsl::span<const std::byte> bytes() const noexcept;
 
+   //! \brief Applies an access pattern to the mapping and requests that the whole file
+   //! be read ahead, for files mapped long before they're read. On Windows this does
+   //! nothing unless prefault is set.
+   //!
+   //! \param access_pattern How the contents of the mapping will be read.
+   //! \param prefault Whether to wait for the file to be read in, where supported.
+   void prefetch(Access_pattern access_pattern, bool prefault) const noexcept;
+
 private:
    std::shared_ptr<std::byte> _view;
-   std::uint32_t _size = 0;
+   std::size_t _size = 0;
 };
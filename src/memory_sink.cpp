@@ -0,0 +1,45 @@
+#include "memory_sink.hpp"
+
+#include <algorithm>
+
+namespace fs = std::filesystem;
+
+Memory_sink::Memory_sink(fs::path root) : _root{std::move(root)} {}
+
+void Memory_sink::create_directory(const fs::path&) {}
+
+void Memory_sink::write_file(fs::path path, std::string contents)
+{
+   decltype(_files)::accessor file;
+
+   _files.insert(file, file_key(path));
+
+   file->second = std::move(contents);
+}
+
+void Memory_sink::write_file(const fs::path& path, std::string_view contents)
+{
+   write_file(path, std::string{contents});
+}
+
+auto Memory_sink::take_files() -> std::vector<Saved_file>
+{
+   std::vector<Saved_file> files;
+   files.reserve(_files.size());
+
+   for (auto& [path, contents] : _files) {
+      files.push_back({path, std::move(contents)});
+   }
+
+   _files.clear();
+
+   std::sort(files.begin(), files.end(),
+             [](const Saved_file& l, const Saved_file& r) { return l.path < r.path; });
+
+   return files;
+}
+
+auto Memory_sink::file_key(const fs::path& path) const -> std::string
+{
+   return path.lexically_normal().lexically_relative(_root).generic_string();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "output_sink.hpp"
+
+#include "tbb/concurrent_hash_map.h"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Saved_file {
+   //! \brief The path of the file relative to the sink's root, with '/' separators.
+   std::string path;
+   std::string contents;
+};
+
+//! \brief Keeps saved files in memory instead of writing them anywhere. Directories are
+//! implied by the paths of the files in them. Saving to a path twice keeps the last
+//! file saved, as writing to disk would.
+class Memory_sink final : public Output_sink {
+public:
+   //! \param root The directory file paths are made relative to.
+   explicit Memory_sink(std::filesystem::path root = {});
+
+   void create_directory(const std::filesystem::path& path) override;
+
+   void write_file(std::filesystem::path path, std::string contents) override;
+
+   void write_file(const std::filesystem::path& path, std::string_view contents) override;
+
+   //! \brief Takes the files saved so far, sorted by path. Must not be called while files
+   //! are still being saved.
+   auto take_files() -> std::vector<Saved_file>;
+
+private:
+   auto file_key(const std::filesystem::path& path) const -> std::string;
+
+   const std::filesystem::path _root;
+
+   tbb::concurrent_hash_map<std::string, std::string> _files;
+};
@@ -1,10 +1,11 @@
 
 #include "model_builder.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
 #include "model_basic_primitives.hpp"
 #include "model_gltf_save.hpp"
 #include "model_msh_save.hpp"
 #include "model_scene.hpp"
-#include "synced_cout.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -305,6 +306,8 @@ void Model::merge_with(Model other) noexcept
 
 void Models_builder::integrate(Model model) noexcept
 {
+   const instrumentation::Scope scope{"integrate_model"sv};
+
    std::lock_guard lock{_mutex};
 
    if (const auto it = std::find_if(
@@ -324,7 +327,13 @@ void Models_builder::save_models(File_saver& file_saver, const Game_version game
 {
    std::lock_guard lock{_mutex};
 
+   const instrumentation::Scope scope{"save_models"sv};
+   const auto instrumentation_file = instrumentation::current_file();
+
    tbb::parallel_for_each(_models, [&](Model& model) {
+      const instrumentation::File_scope file_scope{instrumentation_file};
+      const instrumentation::Scope model_scope{"save_model"sv};
+
       const std::string name = model.name;
 
       try {
@@ -332,7 +341,7 @@ void Models_builder::save_models(File_saver& file_saver, const Game_version game
          save_model(std::move(model), file_saver, game_version, format);
       }
       catch (std::exception& e) {
-         synced_cout::print(
+         logger::error(
             fmt::format("Failed to save model {}! Reason: {}\n", name, e.what()));
       }
    });
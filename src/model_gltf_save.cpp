@@ -435,10 +435,11 @@ void save_scene(scene::Scene scene, File_saver& file_saver)
    doc.buffers.front() = {.byteLength = gsl::narrow<std::uint32_t>(buffer.size()),
                           .data = std::move(buffer)};
 
-   file_saver.create_dir("models"sv);
+   auto output = file_saver.open_save_file("models"sv, scene.name, ".glb"sv);
 
-   fx::gltf::Save(
-      doc, file_saver.build_file_path("models"sv, scene.name, ".glb"sv).string(), true);
+   // Everything is in the one binary buffer, so there are no external files to save
+   // relative to the document root.
+   fx::gltf::Save(doc, output, ""s, true);
 }
 
 }
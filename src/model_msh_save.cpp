@@ -1,9 +1,9 @@
 
 #include "model_msh_save.hpp"
 #include "file_saver.hpp"
+#include "logger.hpp"
 #include "model_topology_converter.hpp"
 #include "string_helpers.hpp"
-#include "synced_cout.hpp"
 #include "ucfb_writer.hpp"
 
 #include <iterator>
@@ -439,8 +439,7 @@ void write_modl(Ucfb_writer& msh2, const scene::Node& node, const std::uint32_t
 
 void save_option_file(const scene::Scene& scene, File_saver& file_saver)
 {
-   auto output =
-      file_saver.open_save_file("msh"sv, scene.name, ".msh.option"sv, std::ios::out);
+   auto output = file_saver.open_save_file("msh"sv, scene.name, ".msh.option"sv);
 
    if (scene.vertex_lighting) output << "-vertexlighting"sv << '\n';
    if (scene.softskin) output << "-softskin"sv << '\n';
@@ -0,0 +1,45 @@
+#include "number_format.hpp"
+
+#include <atomic>
+
+namespace number_format {
+
+namespace {
+
+std::atomic_bool exact_floats_enabled = false;
+
+//! \brief Enough for any float in fixed notation, the longest are the smallest
+//! denormals written exactly at nearly fifty characters.
+constexpr std::size_t max_float_chars = 64;
+
+}
+
+void enable_exact_floats() noexcept
+{
+   exact_floats_enabled.store(true, std::memory_order_relaxed);
+}
+
+bool exact_floats() noexcept
+{
+   return exact_floats_enabled.load(std::memory_order_relaxed);
+}
+
+void append(std::string& buffer, const float value)
+{
+   std::array<char, max_float_chars> chars;
+
+   // Fixed notation is used even for exact output, the game's tools don't all accept
+   // exponents.
+   const auto [last, error] =
+      exact_floats()
+         ? std::to_chars(chars.data(), chars.data() + chars.size(), value,
+                         std::chars_format::fixed)
+         : std::to_chars(chars.data(), chars.data() + chars.size(), value,
+                         std::chars_format::fixed, 6);
+
+   assert(error == std::errc{});
+
+   buffer.append(chars.data(), last);
+}
+
+}
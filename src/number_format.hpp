@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <string>
+
+//! \brief Appending numbers to the text files the tool writes.
+//!
+//! Numbers are formatted with std::to_chars straight into the caller's buffer, unlike
+//! std::to_string this doesn't consult the locale or allocate a string per number. By
+//! default floats are written with six decimal places, matching earlier versions. With
+//! exact floats enabled they're written with the fewest digits that read back as the
+//! same float instead.
+namespace number_format {
+
+//! \brief Turns on exact float output for the rest of the process. Called by main and
+//! unmunge::extract when -exactfloats is given, before any work starts.
+void enable_exact_floats() noexcept;
+
+bool exact_floats() noexcept;
+
+template<std::integral Integer>
+inline void append(std::string& buffer, const Integer value)
+{
+   std::array<char, 24> chars;
+
+   const auto [last, error] = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+
+   assert(error == std::errc{});
+
+   buffer.append(chars.data(), last);
+}
+
+//! \brief Appends a float in fixed notation, either with six decimal places or exactly
+//! depending on exact_floats.
+void append(std::string& buffer, float value);
+
+}
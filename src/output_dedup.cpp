@@ -0,0 +1,467 @@
+#include "output_dedup.hpp"
+#include "file_saver.hpp"
+#include "logger.hpp"
+
+#include <fmt/format.h>
+
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+#include "tbb/concurrent_hash_map.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace output_dedup {
+
+namespace {
+
+struct Chunk_key_hash_compare {
+   static auto hash(const Chunk_key& key) noexcept -> std::size_t
+   {
+      return static_cast<std::size_t>(key.hash_low);
+   }
+
+   static bool equal(const Chunk_key& l, const Chunk_key& r) noexcept
+   {
+      return l == r;
+   }
+};
+
+struct Entry {
+   //! \brief Whether the chunk has finished processing, until it has outputs is empty.
+   bool done = false;
+   //! \brief Whether the entry was loaded from a cache, its outputs must be checked
+   //! before they're reused.
+   bool cached = false;
+   std::vector<Recorder::Output> outputs;
+};
+
+using Chunk_map = tbb::concurrent_hash_map<Chunk_key, Entry, Chunk_key_hash_compare>;
+
+std::atomic_bool dedup_enabled = false;
+
+Chunk_map processed_chunks;
+
+std::atomic_size_t duplicate_chunks = 0;
+std::atomic_size_t duplicate_chunk_bytes = 0;
+std::atomic_size_t linked_files = 0;
+std::atomic_size_t linked_file_bytes = 0;
+
+//! \brief Bumped whenever a chunk handler's output changes, so caches saved by older
+//! builds are discarded.
+constexpr std::uint32_t cache_version = 2;
+
+struct Cache_header {
+   Magic_number magic_number = "xcch"_mn;
+   std::uint32_t version = cache_version;
+   std::uint64_t options_hash = 0;
+   std::uint64_t entry_count = 0;
+};
+
+static_assert(sizeof(Cache_header) == 24);
+
+std::uint64_t cache_options_hash = 0;
+
+auto get_file_write_time(const fs::path& file_path, std::error_code& error)
+   -> std::int64_t
+{
+   return static_cast<std::int64_t>(
+      fs::last_write_time(file_path, error).time_since_epoch().count());
+}
+
+//! \brief Hashes the options that decide what a chunk is saved as.
+auto hash_options(const App_options& app_options) -> std::uint64_t
+{
+   std::error_code error;
+
+   const auto user_dict = app_options.user_string_dict();
+   const auto user_dict_time =
+      user_dict.empty() ? 0 : get_file_write_time(user_dict, error);
+
+   const auto options = fmt::format(
+      "{} {} {} {} {} {} {} {} {}"sv, static_cast<int>(app_options.game_version()),
+      static_cast<int>(app_options.output_game_version()),
+      static_cast<int>(app_options.image_save_format()),
+      static_cast<int>(app_options.model_format()),
+      static_cast<int>(app_options.model_discard_flags()),
+      static_cast<int>(app_options.input_platform()), app_options.exact_floats(), user_dict,
+      user_dict_time);
+
+   return XXH3_64bits(options.data(), options.size());
+}
+
+//! \brief Checks the outputs of a cached entry haven't been changed or removed since
+//! the cache was saved.
+bool outputs_unchanged(const std::vector<Recorder::Output>& outputs) noexcept
+{
+   for (const auto& output : outputs) {
+      std::error_code error;
+
+      if (fs::file_size(output.source, error) != output.size || error) return false;
+
+      if (get_file_write_time(output.source, error) != output.write_time || error) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+template<typename Type>
+void write_value(std::ostream& output, const Type& value)
+{
+   static_assert(std::is_trivially_copyable_v<Type>);
+
+   output.write(reinterpret_cast<const char*>(&value), sizeof(Type));
+}
+
+void write_string(std::ostream& output, std::string_view string)
+{
+   write_value(output, static_cast<std::uint32_t>(string.size()));
+   output.write(string.data(), string.size());
+}
+
+//! \brief Reads a cache, keeping count of the bytes left so lengths read from the file
+//! can be checked before anything is allocated for them.
+struct Cache_reader {
+   std::istream& input;
+   std::uint64_t remaining = 0;
+};
+
+template<typename Type>
+bool read_value(Cache_reader& reader, Type& value)
+{
+   static_assert(std::is_trivially_copyable_v<Type>);
+
+   if (reader.remaining < sizeof(Type)) return false;
+
+   reader.remaining -= sizeof(Type);
+
+   return static_cast<bool>(
+      reader.input.read(reinterpret_cast<char*>(&value), sizeof(Type)));
+}
+
+bool read_string(Cache_reader& reader, std::string& string)
+{
+   std::uint32_t size = 0;
+
+   if (!read_value(reader, size) || reader.remaining < size) return false;
+
+   reader.remaining -= size;
+   string.resize(size);
+
+   return static_cast<bool>(reader.input.read(string.data(), size));
+}
+
+void write_key(std::ostream& output, const Chunk_key& key)
+{
+   write_value(output, static_cast<std::uint32_t>(key.magic_number));
+   write_value(output, static_cast<std::uint64_t>(key.size));
+   write_value(output, key.hash_low);
+   write_value(output, key.hash_high);
+}
+
+bool read_key(Cache_reader& reader, Chunk_key& key)
+{
+   std::uint32_t magic_number = 0;
+   std::uint64_t size = 0;
+
+   if (!read_value(reader, magic_number) || !read_value(reader, size) ||
+       !read_value(reader, key.hash_low) || !read_value(reader, key.hash_high)) {
+      return false;
+   }
+
+   key.magic_number = static_cast<Magic_number>(magic_number);
+   key.size = static_cast<std::size_t>(size);
+
+   return true;
+}
+
+}
+
+void enable() noexcept
+{
+   dedup_enabled.store(true, std::memory_order_relaxed);
+}
+
+bool enabled() noexcept
+{
+   return dedup_enabled.load(std::memory_order_relaxed);
+}
+
+bool dedupable(Magic_number magic_number, Input_platform platform) noexcept
+{
+   switch (magic_number) {
+   // PS2 textures take their palette from a sibling chunk, so the chunk's bytes alone
+   // don't decide their output.
+   case "tex_"_mn:
+      return platform != Input_platform::ps2;
+   case "entc"_mn:
+   case "expc"_mn:
+   case "ordc"_mn:
+   case "wpnc"_mn:
+      return true;
+   default:
+      return false;
+   }
+}
+
+auto chunk_key(Ucfb_reader chunk) -> Chunk_key
+{
+   chunk.reset_head();
+
+   const auto bytes = chunk.read_bytes(chunk.size());
+   const auto hash = XXH3_128bits(bytes.data(), bytes.size());
+
+   return {chunk.magic_number(), chunk.size(), hash.low64, hash.high64};
+}
+
+bool link_duplicate(const Chunk_key& key, File_saver& file_saver)
+{
+   std::vector<Recorder::Output> outputs;
+   bool cached = false;
+
+   if (Chunk_map::const_accessor entry;
+       processed_chunks.find(entry, key) && entry->second.done) {
+      outputs = entry->second.outputs;
+      cached = entry->second.cached;
+   }
+   else {
+      return false;
+   }
+
+   // Forget a stale entry so this copy of the chunk is recorded in its place.
+   if (cached && !outputs_unchanged(outputs)) {
+      processed_chunks.erase(key);
+
+      return false;
+   }
+
+   std::size_t file_bytes = 0;
+
+   for (const auto& output : outputs) {
+      if (!file_saver.link_file(output.source, output.directory, output.name, ""sv)) {
+         return false;
+      }
+
+      std::error_code error;
+
+      if (const auto size = fs::file_size(output.source, error); !error) {
+         file_bytes += size;
+      }
+   }
+
+   duplicate_chunks += 1;
+   duplicate_chunk_bytes += key.size;
+   linked_files += outputs.size();
+   linked_file_bytes += file_bytes;
+
+   return true;
+}
+
+Recorder::Recorder(const Chunk_key& key, const File_saver& file_saver)
+   : _key{key}, _root{file_saver.path()}
+{
+   Chunk_map::accessor entry;
+
+   _claimed = processed_chunks.insert(entry, key);
+}
+
+Recorder::~Recorder()
+{
+   if (_claimed && !_published) processed_chunks.erase(_key);
+}
+
+void Recorder::publish() noexcept
+{
+   std::lock_guard lock{_mutex};
+
+   if (!_claimed) return;
+
+   Chunk_map::accessor entry;
+
+   if (!processed_chunks.find(entry, _key)) return;
+
+   entry->second.outputs = std::move(_outputs);
+   entry->second.done = true;
+
+   _published = true;
+}
+
+void Recorder::record(const fs::path& path) noexcept
+{
+   std::lock_guard lock{_mutex};
+
+   if (!_claimed) return;
+
+   try {
+      const auto relative_path = path.lexically_normal().lexically_relative(_root);
+
+      _outputs.push_back({path, relative_path.parent_path().string(),
+                          relative_path.filename().string()});
+   }
+   catch (std::exception&) {
+      // Without a complete record of the chunk's outputs it can't be reused.
+      _claimed = false;
+      processed_chunks.erase(_key);
+   }
+}
+
+void load_cache(const fs::path& cache_path, const App_options& app_options)
+{
+   cache_options_hash = hash_options(app_options);
+
+   std::error_code error;
+
+   const auto cache_size = fs::file_size(cache_path, error);
+
+   if (error) return;
+
+   std::vector<std::pair<Chunk_key, Entry>> entries;
+
+   try {
+      std::ifstream input{cache_path, std::ios::binary};
+
+      if (!input) return;
+
+      Cache_reader reader{input, cache_size};
+      Cache_header header;
+
+      if (!read_value(reader, header) ||
+          header.magic_number != Cache_header{}.magic_number ||
+          header.version != cache_version || header.options_hash != cache_options_hash) {
+         logger::info("Ignoring extraction cache "s, cache_path.string(),
+                      " saved by a different version or with different options.\n"s);
+
+         return;
+      }
+
+      const auto read_entry = [&](Chunk_key& key, Entry& entry) {
+         std::uint32_t output_count = 0;
+
+         if (!read_key(reader, key) || !read_value(reader, output_count)) return false;
+
+         for (std::uint32_t output_index = 0; output_index < output_count;
+              ++output_index) {
+            auto& output = entry.outputs.emplace_back();
+            std::string source;
+
+            if (!read_string(reader, source) || !read_string(reader, output.directory) ||
+                !read_string(reader, output.name) || !read_value(reader, output.size) ||
+                !read_value(reader, output.write_time)) {
+               return false;
+            }
+
+            output.source = source;
+         }
+
+         return true;
+      };
+
+      for (std::uint64_t i = 0; i < header.entry_count; ++i) {
+         Chunk_key key{};
+         Entry entry{.done = true, .cached = true, .outputs = {}};
+
+         if (!read_entry(key, entry)) {
+            logger::warning("Extraction cache "s, cache_path.string(),
+                            " is truncated, it will be rebuilt.\n"s);
+
+            return;
+         }
+
+         entries.emplace_back(key, std::move(entry));
+      }
+   }
+   catch (std::exception& e) {
+      logger::warning("Extraction cache "s, cache_path.string(),
+                      " could not be read, it will be rebuilt.\n   Message: "s, e.what(),
+                      '\n');
+
+      return;
+   }
+
+   for (auto& [key, entry] : entries) {
+      Chunk_map::accessor accessor;
+
+      processed_chunks.insert(accessor, key);
+      accessor->second = std::move(entry);
+   }
+}
+
+void save_cache(const fs::path& cache_path)
+{
+   std::vector<std::pair<Chunk_key, std::vector<Recorder::Output>>> entries;
+   entries.reserve(processed_chunks.size());
+
+   for (const auto& [key, entry] : processed_chunks) {
+      if (!entry.done) continue;
+
+      // Entries loaded from the cache are kept as they were, unless their outputs changed.
+      if (entry.cached) {
+         if (outputs_unchanged(entry.outputs)) entries.emplace_back(key, entry.outputs);
+
+         continue;
+      }
+
+      auto outputs = entry.outputs;
+
+      const bool exists = std::all_of(outputs.begin(), outputs.end(), [](auto& output) {
+         std::error_code error;
+
+         output.source = fs::absolute(output.source, error);
+         output.size = fs::file_size(output.source, error);
+
+         if (error) return false;
+
+         output.write_time = get_file_write_time(output.source, error);
+
+         return !error;
+      });
+
+      if (exists) entries.emplace_back(key, std::move(outputs));
+   }
+
+   std::ofstream output{cache_path, std::ios::binary};
+
+   if (!output) throw std::runtime_error{"Failed to open cache file for writing."};
+
+   write_value(output, Cache_header{.options_hash = cache_options_hash,
+                                    .entry_count = entries.size()});
+
+   for (const auto& [key, outputs] : entries) {
+      write_key(output, key);
+      write_value(output, static_cast<std::uint32_t>(outputs.size()));
+
+      for (const auto& file : outputs) {
+         write_string(output, file.source.string());
+         write_string(output, file.directory);
+         write_string(output, file.name);
+         write_value(output, file.size);
+         write_value(output, file.write_time);
+      }
+   }
+
+   if (!output) throw std::runtime_error{"Failed to write cache file."};
+}
+
+void log_savings() noexcept
+{
+   if (duplicate_chunks == 0) return;
+
+   logger::info("Deduplicated "s, duplicate_chunks.load(), " chunks ("s,
+                duplicate_chunk_bytes.load(), " bytes), linking "s, linked_files.load(),
+                " files ("s, linked_file_bytes.load(), " bytes) instead of saving them.\n"s);
+}
+
+}
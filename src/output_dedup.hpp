@@ -0,0 +1,122 @@
+#pragma once
+
+#include "app_options.hpp"
+#include "magic_number.hpp"
+#include "ucfb_reader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class File_saver;
+
+//! \brief Decoding chunks that appear in more than one input file only once.
+//!
+//! Levels share a lot of their textures and object classes with each other, the same
+//! chunk is munged into every .lvl that uses it. While enabled the first time a chunk is
+//! processed the files it saves are recorded against a hash of the chunk's bytes. Later
+//! copies of the chunk are not decoded again, their outputs are hard linked to the
+//! recorded files instead, or copied where the output sink can't link them.
+//!
+//! The record can be saved and loaded by later runs. A chunk recorded by an earlier run
+//! is skipped if its outputs are still as that run left them, it's only saved where it
+//! wasn't before.
+namespace output_dedup {
+
+//! \brief Turns on deduplication. Should be called before any work starts.
+void enable() noexcept;
+
+bool enabled() noexcept;
+
+//! \brief Tests if the outputs of a chunk depend only on the chunk's bytes, so that they
+//! can be reused for another copy of the chunk.
+//!
+//! The handlers of these chunks must save every output through the File_saver they're
+//! given, or a saver nested in it, as only those saves are recorded.
+bool dedupable(Magic_number magic_number, Input_platform platform) noexcept;
+
+struct Chunk_key {
+   Magic_number magic_number;
+   std::size_t size;
+   std::uint64_t hash_low;
+   std::uint64_t hash_high;
+
+   bool operator==(const Chunk_key&) const noexcept = default;
+};
+
+//! \brief Hashes the bytes of a chunk.
+auto chunk_key(Ucfb_reader chunk) -> Chunk_key;
+
+//! \brief Saves the outputs of an already processed copy of a chunk through file_saver.
+//!
+//! \return True if the chunk was a duplicate and its outputs were linked, false if the
+//!         chunk needs to be processed.
+bool link_duplicate(const Chunk_key& key, File_saver& file_saver);
+
+//! \brief Records the files saved while processing a chunk, through a saver made with
+//! File_saver::create_recording. Files saved through that saver from any thread are
+//! recorded, and nothing else is.
+//!
+//! Only the first thread to process a chunk records its outputs, a copy of the chunk
+//! met while the first is still being processed is processed again rather than waited
+//! on. If the Recorder is destroyed without publish being called, because processing
+//! the chunk failed, nothing is kept.
+class Recorder {
+public:
+   //! \param key The key of the chunk being processed.
+   //! \param file_saver The saver the chunk is processed with. Outputs are recorded
+   //!                   relative to its path.
+   Recorder(const Chunk_key& key, const File_saver& file_saver);
+
+   Recorder(const Recorder&) = delete;
+   Recorder& operator=(const Recorder&) = delete;
+
+   ~Recorder();
+
+   //! \brief Makes the recorded outputs available to later copies of the chunk.
+   void publish() noexcept;
+
+   //! \brief Records a saved file, called by File_saver. Safe to call from multiple
+   //! threads.
+   void record(const std::filesystem::path& path) noexcept;
+
+   struct Output {
+      std::filesystem::path source;
+      std::string directory;
+      std::string name;
+      //! The size and write time of source, only known for outputs loaded from a cache.
+      std::uint64_t size = 0;
+      std::int64_t write_time = 0;
+   };
+
+private:
+   const Chunk_key _key;
+   const std::filesystem::path _root;
+   bool _claimed = false;
+   bool _published = false;
+   std::mutex _mutex;
+   std::vector<Output> _outputs;
+};
+
+//! \brief Loads the record of an earlier run. Should be called before any work starts.
+//! A missing cache, one saved with different options or one that can't be read is
+//! ignored, and is replaced by save_cache.
+//!
+//! \param cache_path The path to the cache.
+//! \param app_options The options of this run. Those that change the output of chunks
+//!                    must match the options the cache was saved with.
+void load_cache(const std::filesystem::path& cache_path, const App_options& app_options);
+
+//! \brief Saves the record of every chunk processed or loaded, including those loaded
+//! with load_cache. Should be called once every file has been written.
+//!
+//! \exception std::runtime_error Thrown when the cache could not be written.
+void save_cache(const std::filesystem::path& cache_path);
+
+//! \brief Logs how many chunks and bytes deduplication saved, if it saved any.
+void log_savings() noexcept;
+
+}
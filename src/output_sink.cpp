@@ -0,0 +1,95 @@
+#include "output_sink.hpp"
+#include "logger.hpp"
+#include "output_dedup.hpp"
+#include "tar_sink.hpp"
+#include "write_behind.hpp"
+
+#include <system_error>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+//! \brief When deduplicating outputs may be hard links to other outputs, writing through
+//! one would change them all. Such files are unlinked by the I/O thread instead.
+bool outputs_may_be_linked() noexcept
+{
+   return output_dedup::enabled();
+}
+
+class Directory_sink final : public Output_sink {
+public:
+   void create_directory(const fs::path& path) override
+   {
+      std::error_code error;
+
+      fs::create_directories(path, error);
+
+      if (error) {
+         logger::error("Unable to create directory "s, path.string(), "\n   Message: "s,
+                       error.message(), '\n');
+      }
+   }
+
+   void write_file(fs::path path, std::string contents) override
+   {
+      write_behind::write(std::move(path), std::move(contents), outputs_may_be_linked());
+   }
+
+   void write_file(const fs::path& path, std::string_view contents) override
+   {
+      if (write_behind::enabled()) {
+         write_behind::write(path, std::string{contents}, outputs_may_be_linked());
+      }
+      else {
+         write_behind::write_now(path, contents, outputs_may_be_linked());
+      }
+   }
+
+   bool link_file(const fs::path& existing, const fs::path& path) override
+   {
+      write_behind::wait_until_written(existing);
+      write_behind::wait_until_written(path);
+
+      std::error_code error;
+
+      if (fs::equivalent(existing, path, error)) return true;
+
+      fs::remove(path, error);
+
+      if (fs::create_hard_link(existing, path, error); !error) return true;
+
+      // Linking fails across volumes and on filesystems without hard links.
+      return fs::copy_file(existing, path, fs::copy_options::overwrite_existing, error);
+   }
+};
+
+}
+
+bool Output_sink::link_file(const fs::path&, const fs::path&)
+{
+   return false;
+}
+
+auto create_directory_sink() -> std::shared_ptr<Output_sink>
+{
+   return std::make_shared<Directory_sink>();
+}
+
+auto create_output_sink(const fs::path& output_directory, bool archive)
+   -> std::shared_ptr<Output_sink>
+{
+   if (!archive) return create_directory_sink();
+
+   auto directory = output_directory.lexically_normal();
+
+   if (!directory.has_filename() && directory.has_relative_path()) {
+      directory = directory.parent_path();
+   }
+
+   auto archive_path = directory;
+   archive_path += ".tar"sv;
+
+   return std::make_shared<Tar_sink>(archive_path, directory.parent_path());
+}
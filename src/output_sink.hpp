@@ -0,0 +1,45 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+//! \brief Where File_saver puts the files and directories it creates. Shared between a
+//! saver and every saver nested in it, so implementations must be safe to call from
+//! any thread.
+class Output_sink {
+public:
+   virtual ~Output_sink() = default;
+
+   //! \brief Creates a directory. File_saver asks for each directory once, before any
+   //! files are saved in it.
+   virtual void create_directory(const std::filesystem::path& path) = 0;
+
+   //! \brief Stores a file, taking ownership of its contents.
+   virtual void write_file(std::filesystem::path path, std::string contents) = 0;
+
+   //! \brief Stores a file, the contents only need to stay valid for the call.
+   virtual void write_file(const std::filesystem::path& path,
+                           std::string_view contents) = 0;
+
+   //! \brief Stores a file with the same contents as an existing file the sink has
+   //! stored, without copying the contents through memory.
+   //!
+   //! \return False if the sink can't do this, the file should be written normally.
+   virtual bool link_file(const std::filesystem::path& existing,
+                          const std::filesystem::path& path);
+};
+
+//! \brief Creates a sink writing files to disk, through the write-behind queue when it's
+//! running.
+auto create_directory_sink() -> std::shared_ptr<Output_sink>;
+
+//! \brief Creates the sink used for an input file's output.
+//!
+//! \param output_directory The directory the input file is extracted into.
+//! \param archive Whether to write a single <output_directory>.tar instead of a
+//!                directory tree. The archive's entries keep the name of the output
+//!                directory, so unpacking it gives the same tree.
+auto create_output_sink(const std::filesystem::path& output_directory, bool archive)
+   -> std::shared_ptr<Output_sink>;
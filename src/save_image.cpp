@@ -1,12 +1,14 @@
 
 #include "app_options.hpp"
 #include "file_saver.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
 #include "save_image_tga.hpp"
 #include "string_helpers.hpp"
-#include "synced_cout.hpp"
 
+#include <cstring>
 #include <exception>
-#include <fstream>
+#include <string>
 #include <string_view>
 
 #include <DirectXTex.h>
@@ -16,27 +18,55 @@ using namespace std::literals;
 
 namespace {
 
-void save_option_file(const DirectX::ScratchImage& image,
-                      std::filesystem::path path) noexcept
+void save_option_file(const DirectX::ScratchImage& image, File_saver& file_saver,
+                      std::string_view dir, std::string_view name,
+                      std::string_view extension)
 {
    const bool cubemap = image.GetMetadata().IsCubemap();
    const bool volume = image.GetMetadata().IsVolumemap();
 
    if (!cubemap && !volume) return;
 
-   path += L".option"sv;
+   std::string options;
 
-   std::ofstream out{path};
+   if (cubemap) options += "-cubemap "sv;
 
-   if (!out) {
-      synced_cout::print(fmt::format("Unable create .option file {}", path.string()));
+   if (volume) options += "-volume "sv;
 
-      return;
+   file_saver.save_file(std::move(options), dir, name,
+                        fmt::format("{}.option"sv, extension));
+}
+
+auto blob_as_string(const DirectX::Blob& blob) noexcept -> std::string_view
+{
+   return {static_cast<const char*>(blob.GetBufferPointer()), blob.GetBufferSize()};
+}
+
+//! \brief Encodes a DDS file into a string that can be handed to the write-behind queue.
+//!
+//! A ScratchImage's pixels are one allocation laid out the way DDS files store them, so
+//! the file is just the header followed by them. This avoids encoding into a Blob and
+//! then copying that.
+auto encode_image_dds(const DirectX::ScratchImage& image) -> std::string
+{
+   std::size_t header_size = 0;
+
+   if (FAILED(DirectX::EncodeDDSHeader(image.GetMetadata(), DirectX::DDS_FLAGS_NONE,
+                                       nullptr, 0, header_size))) {
+      return {};
+   }
+
+   std::string file;
+   file.resize(header_size + image.GetPixelsSize());
+
+   if (FAILED(DirectX::EncodeDDSHeader(image.GetMetadata(), DirectX::DDS_FLAGS_NONE,
+                                       file.data(), header_size, header_size))) {
+      return {};
    }
 
-   if (cubemap) out << "-cubemap "sv;
+   std::memcpy(file.data() + header_size, image.GetPixels(), image.GetPixelsSize());
 
-   if (volume) out << "-volume "sv;
+   return file;
 }
 
 bool image_needs_converting(const DirectX::ScratchImage& image) noexcept
@@ -58,6 +88,8 @@ bool image_needs_converting(const DirectX::ScratchImage& image) noexcept
 
 void ensure_basic_format(DirectX::ScratchImage& image)
 {
+   const instrumentation::Scope scope{"convert_image"sv};
+
    DirectX::ScratchImage conv_image;
 
    if (DirectX::IsCompressed(image.GetMetadata().format)) {
@@ -115,6 +147,8 @@ auto separate_3d_texture(DirectX::ScratchImage image) -> DirectX::ScratchImage
 
 void ensure_flat_image(DirectX::ScratchImage& image)
 {
+   const instrumentation::Scope scope{"flatten_image"sv};
+
    if (image.GetMetadata().IsCubemap()) {
       image = unfold_cubemap(std::move(image));
    }
@@ -143,6 +177,8 @@ void save_image(std::string_view name, DirectX::ScratchImage image,
                 File_saver& file_saver, Image_format save_format,
                 Model_format model_format)
 {
+   const instrumentation::Scope scope{"save_image"sv};
+
    // Windows' 3D Viewer doesn't handle relative texture paths, so we have to put the
    // textures in the same folder as the glTF files if we want them to be previewable in
    // it.
@@ -151,27 +187,60 @@ void save_image(std::string_view name, DirectX::ScratchImage image,
    // glTF doesn't support .tga files.
    save_format = model_format == Model_format::gltf2 ? Image_format::png : save_format;
 
-   const auto path = file_saver.build_file_path(dir, name, image_extension(save_format));
-
-   file_saver.create_dir(dir);
+   const auto extension = image_extension(save_format);
 
    if (save_format == Image_format::tga) {
-      save_option_file(image, path);
+      save_option_file(image, file_saver, dir, name, extension);
 
       ensure_basic_format(image);
       ensure_flat_image(image);
 
-      save_image_tga(path, *image.GetImage(0, 0, 0));
+      const instrumentation::Scope encode_scope{"encode_image"sv};
+
+      file_saver.save_file(encode_image_tga(*image.GetImage(0, 0, 0)), dir, name,
+                           extension);
+
+      return;
    }
-   else if (save_format == Image_format::png) {
-      ensure_basic_format(image);
-      ensure_flat_image(image);
 
-      DirectX::SaveToWICFile(*image.GetImage(0, 0, 0), DirectX::WIC_FLAGS_NONE,
-                             DirectX::GetWICCodec(DirectX::WIC_CODEC_PNG), path.c_str());
+   if (save_format == Image_format::dds) {
+      std::string file = [&] {
+         const instrumentation::Scope encode_scope{"encode_image"sv};
+
+         return encode_image_dds(image);
+      }();
+
+      if (file.empty()) {
+         logger::error(fmt::format("Failed to encode image {}{}\n"sv, name, extension));
+
+         return;
+      }
+
+      file_saver.save_file(std::move(file), dir, name, extension);
+
+      return;
    }
-   else if (save_format == Image_format::dds) {
-      DirectX::SaveToDDSFile(image.GetImages(), image.GetImageCount(),
-                             image.GetMetadata(), DirectX::DDS_FLAGS_NONE, path.c_str());
+
+   ensure_basic_format(image);
+   ensure_flat_image(image);
+
+   DirectX::Blob blob;
+   HRESULT result = S_OK;
+
+   {
+      const instrumentation::Scope encode_scope{"encode_image"sv};
+
+      result = DirectX::SaveToWICMemory(*image.GetImage(0, 0, 0), DirectX::WIC_FLAGS_NONE,
+                                        DirectX::GetWICCodec(DirectX::WIC_CODEC_PNG),
+                                        blob);
+   }
+
+   if (FAILED(result)) {
+      logger::error(fmt::format("Failed to encode image {}{}\n"sv, name, extension));
+
+      return;
    }
+
+   // WIC encodes into a Blob we can't take ownership of, so PNGs are copied once here.
+   file_saver.save_file(blob_as_string(blob), dir, name, extension);
 }
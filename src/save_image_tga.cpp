@@ -3,7 +3,6 @@
 #include "type_pun.hpp"
 
 #include <cstdint>
-#include <fstream>
 #include <stdexcept>
 
 namespace {
@@ -41,7 +40,7 @@ bool supports_format(const DXGI_FORMAT format)
 
 }
 
-void save_image_tga(const std::filesystem::path& save_path, DirectX::Image image)
+auto encode_image_tga(DirectX::Image image) -> std::string
 {
    const auto typeless_format = DirectX::MakeTypeless(image.format);
 
@@ -49,18 +48,19 @@ void save_image_tga(const std::filesystem::path& save_path, DirectX::Image image
       throw std::runtime_error{"Invalid image format passed to TGA save function!"};
    }
 
-   std::ofstream out{save_path, std::ios::binary};
-
    Tga_header header{};
 
    header.image_width = static_cast<std::uint16_t>(image.width);
    header.image_height = static_cast<std::uint16_t>(image.height);
 
-   out.write(to_char_pointer(&header), sizeof(header));
-
    const auto height = static_cast<std::ptrdiff_t>(image.height);
    const auto width = static_cast<std::ptrdiff_t>(image.width);
 
+   std::string out;
+   out.reserve(sizeof(header) + (image.width * image.height * sizeof(std::uint32_t)));
+
+   out.append(to_char_pointer(&header), sizeof(header));
+
    for (std::ptrdiff_t y = height - 1; y >= 0; --y) {
       for (std::ptrdiff_t x = 0; x < width; ++x) {
          std::array<std::uint8_t, 4> rgba;
@@ -76,7 +76,9 @@ void save_image_tga(const std::filesystem::path& save_path, DirectX::Image image
             rgba[3] = 0xff;
          }
 
-         out.write(to_char_pointer(rgba.data()), sizeof(rgba));
+         out.append(to_char_pointer(rgba.data()), sizeof(rgba));
       }
    }
+
+   return out;
 }
@@ -1,10 +1,8 @@
 #pragma once
 
-#include <filesystem>
-#include <string_view>
+#include <string>
 
 #include <DirectXTex.h>
 
-class File_saver;
-
-void save_image_tga(const std::filesystem::path& save_path, DirectX::Image image);
\ No newline at end of file
+//! \brief Encodes an uncompressed 32-bit TGA file into memory.
+auto encode_image_tga(DirectX::Image image) -> std::string;
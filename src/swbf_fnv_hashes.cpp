@@ -1,3896 +1,4093 @@
-
 #include "swbf_fnv_hashes.hpp"
+#include "logger.hpp"
+#include "number_format.hpp"
 #include "string_helpers.hpp"
-#include "synced_cout.hpp"
 
+#include "tbb/concurrent_unordered_map.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <fstream>
-#include <mutex>
-#include <shared_mutex>
-#include <unordered_map>
+#include <memory>
+#include <tuple>
 #include <utility>
 
 using namespace std::literals;
 
 namespace {
 
-std::pair<std::uint32_t, std::string_view> operator""_fnvp(const char* str,
-                                                           std::size_t length)
+constexpr std::array builtin_strings{
+   "--AttachOdf"sv,
+   "--AttachToHardPoint"sv,
+   "--DamageAttachPoint"sv,
+   "--DamageEffect"sv,
+   "--DamageEffectScale"sv,
+   "--DamageInheritVelocity"sv,
+   "--DamageStartPercent"sv,
+   "--DamageStopPercent"sv,
+   "--UnbuiltGeometryName"sv,
+   "--UnbuiltHoloOdf"sv,
+   "!Back"sv,
+   "!BackLeft"sv,
+   "!BackRight"sv,
+   "!Crouch"sv,
+   "!Fire"sv,
+   "!FireSecondary"sv,
+   "!Forward"sv,
+   "!Jet"sv,
+   "!Jump"sv,
+   "!Left"sv,
+   "!Prone"sv,
+   "!Reload"sv,
+   "!Right"sv,
+   "!Roll"sv,
+   "!Sprint"sv,
+   "!Stand"sv,
+   "!Thrust"sv,
+   "\\\\ChunkGeometryName"sv,
+   "\\\\ChunkPhysics"sv,
+   "\\\\ChunkSmokeEffect"sv,
+   "\\\\ChunkSmokeNodeName"sv,
+   "\\\\ChunkTrailEffect"sv,
+   "\\\\DeathAnimationExplosion"sv,
+   "\\\\IconTexture"sv,
+   "0"sv,
+   "1"sv,
+   "1Flag"sv,
+   "1PlayerHud"sv,
+   "2"sv,
+   "2Flag"sv,
+   "2PlayerHud"sv,
+   "3PlayerHud"sv,
+   "4PlayerHud"sv,
+   "6"sv,
+   "7"sv,
+   "8"sv,
+   "A"sv,
+   "aacylinder"sv,
+   "Above"sv,
+   "Accelerate"sv,
+   "acceleration"sv,
+   "Acceleraton"sv,
+   "AcquiredTargetSound"sv,
+   "ActiveRotateNode"sv,
+   "ActiveSpinNode"sv,
+   "AddHealth"sv,
+   "AddHitEffect"sv,
+   "Additive"sv,
+   "AddonAttachJoint"sv,
+   "AddSample"sv,
+   "AddShield"sv,
+   "AddShieldOff"sv,
+   "AddSpringBody"sv,
+   "AddToTop"sv,
+   "adminpw"sv,
+   "AdrenalineHigh"sv,
+   "AdrenalineLow"sv,
+   "AdrenalineMedium"sv,
+   "AffectEnemies"sv,
+   "AffectFriends"sv,
+   "AfterburnerOffSound"sv,
+   "AfterburnerOnSound"sv,
+   "AfterburnerSpeed"sv,
+   "AI"sv,
+   "ai_tactical_template"sv,
+   "AIBubbleCircle"sv,
+   "AIBubbleScaleClamp"sv,
+   "AIBubbleScaleDistDivider"sv,
+   "AIBubbleSizeMultiplier"sv,
+   "AICollisionRadius"sv,
+   "AimAzimuth"sv,
+   "AimDistance"sv,
+   "AimElevation"sv,
+   "AimerNodeName"sv,
+   "AimerOffset"sv,
+   "AimerPitchLimits"sv,
+   "AimerPitchLimts"sv,
+   "AimerPitchRate"sv,
+   "AimerRestDirection"sv,
+   "AimerYawLimits"sv,
+   "AimerYawLimts"sv,
+   "AimerYawRate"sv,
+   "AimFactorMove"sv,
+   "AimFactorPostureCrouch"sv,
+   "AimFactorPostureProne"sv,
+   "AimFactorPostureSpecial"sv,
+   "AimFactorPostureStand"sv,
+   "AimFactorStrafe"sv,
+   "AimTension"sv,
+   "AimType"sv,
+   "AimValue"sv,
+   "AINoRepair"sv,
+   "AISCDriverGetInSound"sv,
+   "AISCDriverGetOutSound"sv,
+   "AISCFieldFollowSound"sv,
+   "AISCFieldHoldSound"sv,
+   "AISCFieldMoveOutSound"sv,
+   "AISCGunnerAllClearSound"sv,
+   "AISCGunnerGetInSound"sv,
+   "AISCGunnerGetOutSound"sv,
+   "AISCGunnerSteadySound"sv,
+   "AISCPassengerGetInSound"sv,
+   "AISCPassengerGetOutSound"sv,
+   "AISCPassengerMoveOutSound"sv,
+   "AISCPassengerStopSound"sv,
+   "AISCResponseNosirSound"sv,
+   "AISCResponseYessirSound"sv,
+   "AISizeType"sv,
+   "AISoldierMusic"sv,
+   "AISpawnWeight"sv,
+   "AITargetAll"sv,
+   "AITargetAnimal"sv,
+   "AITargetBuilding"sv,
+   "AITargetBuildingDead"sv,
+   "AITargetBuildingUnbuilt"sv,
+   "AITargetDroid"sv,
+   "AITargetMine"sv,
+   "AITargetPerson"sv,
+   "AITargetVehicle"sv,
+   "AIText"sv,
+   "AIUseBubbleCircle"sv,
+   "AIUseHoverPhysics"sv,
+   "AIVisibilityFactor"sv,
+   "AlignedToThrust"sv,
+   "AlignVertical"sv,
+   "All"sv,
+   "all_halo"sv,
+   "all_hero_luke_jedi"sv,
+   "Alliance"sv,
+   "AllMusic"sv,
+   "AllowAIPickup"sv,
+   "AllowDestruct"sv,
+   "AllowMiniMap"sv,
+   "AllowTeamPickup"sv,
+   "AllyCount"sv,
+   "AllyPath"sv,
+   "Alpha"sv,
+   "AlphaMin"sv,
+   "AlphaMinMax"sv,
+   "AlwaysScroll"sv,
+   "Ambience"sv,
+   "Ambient"sv,
+   "Ambient2Sound"sv,
+   "AmbientColor"sv,
+   "ambientemt_static_template"sv,
+   "ambientemt_template"sv,
+   "ambientfx_template"sv,
+   "AmbientScale"sv,
+   "AmbientSound"sv,
+   "AmmoGainEffect"sv,
+   "AmmoPerShot"sv,
+   "Angle"sv,
+   "AngleEnd"sv,
+   "AngleFade"sv,
+   "AngleMin"sv,
+   "AngleStart"sv,
+   "Animal"sv,
+   "AnimalAmmo"sv,
+   "AnimalEnergy"sv,
+   "AnimalHealth"sv,
+   "AnimalScale"sv,
+   "Animated"sv,
+   "AnimatedAddon"sv,
+   "AnimatedBuilding"sv,
+   "AnimatedMove"sv,
+   "AnimatedPilotPosition"sv,
+   "AnimatedProp"sv,
+   "Animation"sv,
+   "AnimationAddon"sv,
+   "AnimationAmplitude0"sv,
+   "AnimationAmplitude1"sv,
+   "AnimationBank"sv,
+   "AnimationBlending"sv,
+   "AnimationExtraFile"sv,
+   "AnimationFrequency"sv,
+   "AnimationLowRes"sv,
+   "AnimationName"sv,
+   "AnimationTrigger"sv,
+   "AnimationTriggerSound"sv,
+   "AnimChange"sv,
+   "AnimDisable"sv,
+   "AnimEnable"sv,
+   "Anti-Armor"sv,
+   "Any"sv,
+   "ApplyOnOwnerIfOnOthers"sv,
+   "ApproachingTargetSound"sv,
+   "Arc"sv,
+   "AreaHeight"sv,
+   "AreaRadius"sv,
+   "AreaRange"sv,
+   "AreaType"sv,
+   "ArmedBuilding"sv,
+   "ArmedBuildingDynamic"sv,
+   "ArmName"sv,
+   "ArmorScale"sv,
+   "Assault"sv,
+   "ATAT"sv,
+   "AtmosphereColor"sv,
+   "AttachDynamic"sv,
+   "AttachedFirePoint"sv,
+   "attachedmesh"sv,
+   "AttachEffect"sv,
+   "AttachNodeName"sv,
+   "AttachOdf"sv,
+   "AttachToHardPoint"sv,
+   "AttachTrigger"sv,
+   "Attack"sv,
+   "AttackAnimation"sv,
+   "AttackBone"sv,
+   "AttackControls"sv,
+   "AttackDamage"sv,
+   "AttackDamageDistance"sv,
+   "AttackDamageTime"sv,
+   "AttackDuration"sv,
+   "AttackerOffScreen"sv,
+   "AttackerOffScreenBehind"sv,
+   "AttackerOnScreen"sv,
+   "AttackerOnScreenBehind"sv,
+   "AttackId"sv,
+   "AttackPosition"sv,
+   "AttackPositionVO"sv,
+   "AttackPush"sv,
+   "AttackRadius"sv,
+   "AttackRecoverBreakOutTime"sv,
+   "AttackRecoverDuration"sv,
+   "AttackSound"sv,
+   "AttackTime"sv,
+   "AttenuateBus"sv,
+   "Attenuation"sv,
+   "AttenuationLeadIn"sv,
+   "AttenuationLeadOut"sv,
+   "Attitude"sv,
+   "AttractCameras"sv,
+   "AttractGame"sv,
+   "AttractIngame"sv,
+   "AttractMap"sv,
+   "AttractTimeout"sv,
+   "AudioMaxChannels"sv,
+   "AudioMixBuffer"sv,
+   "AudionoEnhance"sv,
+   "AudioSampleRate"sv,
+   "AutoAim"sv,
+   "AutoAimSize"sv,
+   "AutoAimYLimits"sv,
+   "AutoBarrierEnable"sv,
+   "AutoBarrierRemoveOnDeath"sv,
+   "AutoBarrierSize"sv,
+   "AutoFire"sv,
+   "autonet"sv,
+   "AutoPitchScreenDist"sv,
+   "AutoRespawnEnable"sv,
+   "AutoTurnScreenDist"sv,
+   "AvailableForAnyTeam"sv,
+   "B01"sv,
+   "Back"sv,
+   "BackAngle"sv,
+   "BackColor"sv,
+   "BackDegree"sv,
+   "Backdrop"sv,
+   "BackdropLarge"sv,
+   "BackdropSmall"sv,
+   "BackdropSpawn"sv,
+   "Background"sv,
+   "BackgroundMaskShapeLarge"sv,
+   "BackgroundMaskShapeSmall"sv,
+   "BackgroundMaskShapeSpawn"sv,
+   "BackLeft"sv,
+   "BackRight"sv,
+   "BadName"sv,
+   "BallAcceleration"sv,
+   "BallCollision"sv,
+   "BallJumpForwardBoost"sv,
+   "BallJumpHeight"sv,
+   "BallLowResModel"sv,
+   "BallMaxLean"sv,
+   "BallMinMoveSpeed"sv,
+   "BallMoveSpeed"sv,
+   "BallMoveThreshold"sv,
+   "BallRadius"sv,
+   "BallRollingFriction"sv,
+   "BallSlippage"sv,
+   "BallSprintSpeedBoost"sv,
+   "BallSprintTurnSpeed"sv,
+   "BallStoppedTurnSpeed"sv,
+   "BallTurnSpeed"sv,
+   "BallWaterDamageHeight"sv,
+   "Bandwidth"sv,
+   "BankAngle"sv,
+   "BankFilter"sv,
+   "BarBitmap"sv,
+   "BarrageDelay"sv,
+   "BarrageMax"sv,
+   "BarrageMin"sv,
+   "BarrelLength"sv,
+   "BarrelNodeName"sv,
+   "BarrelOffset"sv,
+   "BarrelRecoil"sv,
+   "BarrelSound"sv,
+   "BarrelSoundFadeInTime"sv,
+   "BarrelSoundFadeOutTime"sv,
+   "BarSegmented"sv,
+   "Base"sv,
+   "Baseline"sv,
+   "battle_chatter_template"sv,
+   "battlechatter"sv,
+   "bazarre_sprays"sv,
+   "Beacon"sv,
+   "BeadColor"sv,
+   "BeadCount"sv,
+   "BeadModulate"sv,
+   "BeadSize"sv,
+   "BeadSpeed"sv,
+   "BeadTexture"sv,
+   "Beam"sv,
+   "BeamColor"sv,
+   "BeamGlowColor"sv,
+   "BeamGlowTexture"sv,
+   "BeamGlowWidth"sv,
+   "BeamIntensity"sv,
+   "BeamTexture"sv,
+   "BeamWidth"sv,
+   "Behind"sv,
+   "Below"sv,
+   "bendconstraint"sv,
+   "Bias"sv,
+   "Bidirectional"sv,
+   "big_glow"sv,
+   "bigartheap"sv,
+   "BILLBOARD"sv,
+   "Binoculars"sv,
+   "Bird"sv,
+   "BirdScatter"sv,
+   "BirdScatterSound"sv,
+   "BirdSound"sv,
+   "Bitmap"sv,
+   "BitmapHAlign"sv,
+   "BitmapRect"sv,
+   "BitmapStyle"sv,
+   "BitmapVAlign"sv,
+   "BitmapWidthHeight"sv,
+   "BlendInTime"sv,
+   "BlendMode"sv,
+   "BlendOutTime"sv,
+   "BlendTimeIn"sv,
+   "BlendTimeOut"sv,
+   "BlendTimeTo"sv,
+   "BlockSize"sv,
+   "Blue"sv,
+   "blue_blaster_bolt"sv,
+   "blue_blaster_bolt_small"sv,
+   "Blue_halo"sv,
+   "BlueFlame"sv,
+   "Blur"sv,
+   "BlurEffect"sv,
+   "BlurEnable"sv,
+   "BlurLength"sv,
+   "BlurRes"sv,
+   "BlurStart"sv,
+   "BlurValue"sv,
+   "BobOrient"sv,
+   "BobRSlope"sv,
+   "BobSlope"sv,
+   "BobTime"sv,
+   "BobVector"sv,
+   "Body"sv,
+   "body_movement_fall_template"sv,
+   "body_movement_metal_template"sv,
+   "body_movement_template"sv,
+   "body_movement_water_template"sv,
+   "BodyFall"sv,
+   "BodyOmegaXDampFactor"sv,
+   "BodyOmegaXSpringFactor"sv,
+   "BodyOmegaZDampFactor"sv,
+   "BodyOmegaZSpringFactor"sv,
+   "BodySpringLength"sv,
+   "BodySpringLengthRadiusMultiplier"sv,
+   "BodyVelocityDampFactor"sv,
+   "BodyVelocitySpringFactor"sv,
+   "Bolt"sv,
+   "BonesPerTentacle"sv,
+   "BonusAmplification"sv,
+   "BonusColor"sv,
+   "BoostAcceleration"sv,
+   "BoostFOV"sv,
+   "BoostSound"sv,
+   "BoostSpeed"sv,
+   "BoostTurnMultiplier"sv,
+   "BoostTurnSpeed"sv,
+   "bootlagger"sv,
+   "Border"sv,
+   "BorderDiffuseColor"sv,
+   "BorderedBox"sv,
+   "BorderOdf"sv,
+   "Bots"sv,
+   "Bottom"sv,
+   "BottomColor"sv,
+   "BottomDirectionalAmbientColor"sv,
+   "BottomDrop"sv,
+   "BottomRange"sv,
+   "bound01"sv,
+   "Bound02"sv,
+   "Bound03"sv,
+   "Boundary"sv,
+   "boundary01"sv,
+   "boundary02"sv,
+   "boundary1"sv,
+   "BoundingRadius"sv,
+   "BowlingPush"sv,
+   "Box"sv,
+   "BoxSize"sv,
+   "BranchDifferent"sv,
+   "BranchFactor"sv,
+   "BranchLength"sv,
+   "BranchPaths"sv,
+   "BranchProbability"sv,
+   "BranchRegion"sv,
+   "BranchSpreadFactor"sv,
+   "Break"sv,
+   "BreakDistance"sv,
+   "BrightnessMin"sv,
+   "BrightStarPercent"sv,
+   "brnbeep1"sv,
+   "BuffDefenseEffect"sv,
+   "BuffDefenseMult"sv,
+   "BuffDefenseTimer"sv,
+   "BuffHealthEffect"sv,
+   "BuffHealthRate"sv,
+   "BuffHealthTimer"sv,
+   "BuffOffenseEffect"sv,
+   "BuffOffenseMult"sv,
+   "BuffOffenseTimer"sv,
+   "BuildAnimation"sv,
+   "Building"sv,
+   "BuildingAmmo"sv,
+   "BuildingBuild"sv,
+   "BuildingCollision"sv,
+   "BuildingCollisionPrim"sv,
+   "BuildingEnergy"sv,
+   "BuildingHealth"sv,
+   "BuildingRebuild"sv,
+   "BuildingScale"sv,
+   "BuildingSection"sv,
+   "BuildingSound"sv,
+   "BuildModelOdf"sv,
+   "BuildPoint"sv,
+   "BuiltCollision"sv,
+   "BuiltSound"sv,
+   "Bullet"sv,
+   "BumpMap"sv,
+   "BumpMapTextures"sv,
+   "BumpTexture"sv,
+   "BurstCount"sv,
+   "BurstDelay"sv,
+   "Bus"sv,
+   "Button"sv,
+   "ButtonsPressed"sv,
+   "ButtonsReleased"sv,
+   "ByTime"sv,
+   "C"sv,
+   "CableLength"sv,
+   "CameraAxialVelocityScale"sv,
+   "CameraBlendTime"sv,
+   "CameraCrossVelocityScale"sv,
+   "CameraDistance"sv,
+   "CameraHeight"sv,
+   "CAMERASECTION"sv,
+   "Campaign"sv,
+   "CampaignLayout"sv,
+   "CampaignName"sv,
+   "CanDeflect"sv,
+   "Cannon"sv,
+   "CAPITOL"sv,
+   "CapturedSound"sv,
+   "CaptureMusic"sv,
+   "CapturePosts"sv,
+   "CaptureRegion"sv,
+   "CaptureTime"sv,
+   "CargoNodeName"sv,
+   "CargoNodeOffset"sv,
+   "CarriedColorize"sv,
+   "CarriedGeometryName"sv,
+   "CarriedOffset"sv,
+   "CastShadow"sv,
+   "CastSpecular"sv,
+   "Catapult"sv,
+   "CenterDeadZoneRadius"sv,
+   "Centered"sv,
+   "ChangeModeSound"sv,
+   "CharacterAmbientColor"sv,
+   "Charge"sv,
+   "ChargeDelayHeavy"sv,
+   "ChargeDelayLight"sv,
+   "ChargedSound"sv,
+   "ChargeMaxTime"sv,
+   "ChargeMinStrength"sv,
+   "ChargeRateHeavy"sv,
+   "ChargeRateLight"sv,
+   "ChargeSound"sv,
+   "ChargeSoundPitch"sv,
+   "ChargeSoundStop"sv,
+   "ChargeUpEffect"sv,
+   "Chase"sv,
+   "cheating"sv,
+   "ChildAsteroid"sv,
+   "ChildBreakDistance"sv,
+   "ChildColor"sv,
+   "ChildSpreadFactor"sv,
+   "ChildTextureSize"sv,
+   "ChildWidth"sv,
+   "Choke"sv,
+   "ChokeEffect"sv,
+   "ChokeSound"sv,
+   "CHUNK"sv,
+   "CHUNK1"sv,
+   "CHUNK2"sv,
+   "CHUNK3"sv,
+   "CHUNK4"sv,
+   "CHUNK5"sv,
+   "CHUNK6"sv,
+   "CHUNK7"sv,
+   "CHUNK8"sv,
+   "CHUNK9"sv,
+   "ChunkAngularDamping"sv,
+   "ChunkBounciness"sv,
+   "ChunkDeathSpeed"sv,
+   "ChunkFrequency"sv,
+   "ChunkGeometryName"sv,
+   "ChunkGravity"sv,
+   "ChunkInitialCollisionSound"sv,
+   "ChunkKeepSoldierCollision"sv,
+   "ChunkLifetime"sv,
+   "ChunkLinearDamping"sv,
+   "ChunkNodeName"sv,
+   "ChunkOmega"sv,
+   "ChunkPhysics"sv,
+   "ChunkScrapeCollisionSound"sv,
+   "CHUNKSECTION"sv,
+   "ChunkSimpleFriction"sv,
+   "ChunkSmokeEffect"sv,
+   "ChunkSmokeNodeName"sv,
+   "ChunkSpeed"sv,
+   "ChunkStartDistance"sv,
+   "ChunkStickiness"sv,
+   "ChunkTerrainCollisions"sv,
+   "ChunkTerrainEffect"sv,
+   "ChunkTrailEffect"sv,
+   "ChunkTrailNodeName"sv,
+   "ChunkUpFactor"sv,
+   "ChunkVelocityFactor"sv,
+   "Circle"sv,
+   "CircleATATFrequency"sv,
+   "Circular"sv,
+   "CIS"sv,
+   "cis_halo"sv,
+   "cis_hero_countdooku"sv,
+   "cis_hero_darthmaul"sv,
+   "cis_hero_grievous"sv,
+   "cis_sfx_droid_explosion"sv,
+   "cis_sfx_droideka_explosion"sv,
+   "cis_sfx_jetpack"sv,
+   "cis_sfx_sbd_missiles_red"sv,
+   "CISMusic"sv,
+   "ClankLeftRunSound"sv,
+   "ClankLeftWalkSound"sv,
+   "ClankRightRunSound"sv,
+   "ClankRightWalkSound"sv,
+   "Class"sv,
+   "Class1"sv,
+   "Class2"sv,
+   "Class3"sv,
+   "Class4"sv,
+   "Class5"sv,
+   "ClassAllATK"sv,
+   "ClassAllDEF"sv,
+   "ClassCISATK"sv,
+   "ClassCISDEF"sv,
+   "ClassHisATK"sv,
+   "ClassHisDEF"sv,
+   "ClassImpATK"sv,
+   "ClassImpDEF"sv,
+   "ClassLabel"sv,
+   "ClassLocals"sv,
+   "ClassLocATK"sv,
+   "ClassLocDEF"sv,
+   "ClassNeutral"sv,
+   "ClassRepATK"sv,
+   "ClassRepDEF"sv,
+   "ClearLockOnFire"sv,
+   "CloseSound"sv,
+   "ClothingRustleSound"sv,
+   "ClothODF"sv,
+   "CloudCluster"sv,
+   "CloudLayer"sv,
+   "CockedAngle"sv,
+   "Cockpit"sv,
+   "Cockpit1stPersonSound"sv,
+   "Cockpit3rdPersonSound"sv,
+   "CockpitChatterStream"sv,
+   "CockpitTension"sv,
+   "CodeInitialWidth"sv,
+   "Collidable"sv,
+   "CollisionFoliageSound"sv,
+   "CollisionHeadOffset"sv,
+   "CollisionHeadScale"sv,
+   "CollisionInflict"sv,
+   "collisionName"sv,
+   "CollisionOtherSound"sv,
+   "CollisionRootScale"sv,
+   "CollisionScale"sv,
+   "CollisionShieldSound"sv,
+   "CollisionSound"sv,
+   "CollisionThreshold"sv,
+   "CollisionTorsoOffset"sv,
+   "CollisionTorsoScale"sv,
+   "CollisionWaterSound"sv,
+   "Color"sv,
+   "ColorChange"sv,
+   "ColorChangeRate"sv,
+   "ColorFriendly"sv,
+   "ColorInterp"sv,
+   "ColorizeByTeam"sv,
+   "ColorPulseRate"sv,
+   "ColorSaturation"sv,
+   "ColorVariation"sv,
+   "com_icon_alliance"sv,
+   "com_icon_CIS"sv,
+   "com_icon_imperial"sv,
+   "com_icon_republic"sv,
+   "com_sfx_bif"sv,
+   "com_sfx_blammo"sv,
+   "com_sfx_buff_defense"sv,
+   "com_sfx_buff_offense"sv,
+   "com_sfx_buff_poison"sv,
+   "com_sfx_buff_regen"sv,
+   "com_sfx_buffed_defense"sv,
+   "com_sfx_buffed_offense"sv,
+   "com_sfx_buffed_poison"sv,
+   "com_sfx_buffed_regen"sv,
+   "com_sfx_chargeup"sv,
+   "com_sfx_chunksmolder"sv,
+   "com_sfx_chunktrail"sv,
+   "com_sfx_chunktrail_sm"sv,
+   "com_sfx_chunktrail_xs"sv,
+   "com_sfx_contrail"sv,
+   "com_sfx_dirtspray_lg"sv,
+   "com_sfx_dirtspray_sm"sv,
+   "com_sfx_dustwake"sv,
+   "com_sfx_exhaust_cloudcar"sv,
+   "com_sfx_exhaust_jedistarfighter"sv,
+   "com_sfx_exhaust_jedistarfighter_blue"sv,
+   "com_sfx_exhaust_kwing"sv,
+   "com_sfx_exhaust_xwing"sv,
+   "com_sfx_explosion_lg"sv,
+   "com_sfx_explosion_sm"sv,
+   "com_sfx_explosion_xl"sv,
+   "com_sfx_explosion_xs"sv,
+   "com_sfx_fireflies"sv,
+   "com_sfx_forcechoked"sv,
+   "com_sfx_forcepulled"sv,
+   "com_sfx_forcepushed"sv,
+   "com_sfx_groundcrack"sv,
+   "com_sfx_hackedvehicle"sv,
+   "com_sfx_inf_damage_disintergrate"sv,
+   "com_sfx_inf_damage_electricity"sv,
+   "com_sfx_inf_damage_fire"sv,
+   "com_sfx_inf_damage_smoke"sv,
+   "com_sfx_inf_disintergrate"sv,
+   "com_sfx_landmine"sv,
+   "com_sfx_lightning"sv,
+   "com_sfx_mineblink_blue"sv,
+   "com_sfx_mineblink_gold"sv,
+   "com_sfx_mineblink_green"sv,
+   "com_sfx_mineblink_purple"sv,
+   "com_sfx_mineblink_red"sv,
+   "com_sfx_muzzleflash_lg"sv,
+   "com_sfx_ord_exp"sv,
+   "com_sfx_ord_flame"sv,
+   "com_sfx_pow"sv,
+   "com_sfx_powerup_blue"sv,
+   "com_sfx_powerup_green"sv,
+   "com_sfx_powerup_red"sv,
+   "com_sfx_protontorpedo"sv,
+   "com_sfx_rainsplash"sv,
+   "com_sfx_repair"sv,
+   "com_sfx_sabredeflect"sv,
+   "com_sfx_sabrehit"sv,
+   "com_sfx_shieldimpact_sm"sv,
+   "com_sfx_shieldimpact_xl"sv,
+   "com_sfx_smokeplume"sv,
+   "com_sfx_timebomb"sv,
+   "com_sfx_vehicle_exp"sv,
+   "com_sfx_vehicleflame"sv,
+   "com_sfx_vehicleflame_sc"sv,
+   "com_sfx_vehicleflame_speeder"sv,
+   "com_sfx_vehiclesmoke"sv,
+   "com_sfx_vehiclesmoke_sc"sv,
+   "com_sfx_vehiclesmoke_speeder"sv,
+   "com_sfx_vehiclespark"sv,
+   "com_sfx_vehiclespark_sc"sv,
+   "com_sfx_vehiclespark_speeder"sv,
+   "com_sfx_walkerstomp"sv,
+   "com_sfx_waterbulletspray"sv,
+   "com_sfx_watersplash_lg"sv,
+   "com_sfx_watersplash_md"sv,
+   "com_sfx_watersplash_ord"sv,
+   "com_sfx_watersplash_ord_lg"sv,
+   "com_sfx_watersplash_ord_md"sv,
+   "com_sfx_watersplash_sm"sv,
+   "com_sfx_watersplash_wade"sv,
+   "com_sfx_watersplash_walker"sv,
+   "com_sfx_watersplash_xs"sv,
+   "com_sfx_waterwake_lg"sv,
+   "com_sfx_waterwake_sm"sv,
+   "com_sfx_weap_arccaster"sv,
+   "com_sfx_weap_beam_exp"sv,
+   "com_sfx_weap_beam_exp_lg"sv,
+   "com_sfx_weap_beam_exp_md"sv,
+   "com_sfx_weap_beam_exp_sm"sv,
+   "com_sfx_weap_beam_exp_xl"sv,
+   "com_sfx_weap_bluebolt_exp_lg"sv,
+   "com_sfx_weap_bluebolt_exp_md"sv,
+   "com_sfx_weap_bluebolt_exp_sm"sv,
+   "com_sfx_weap_bluebolt_exp_xl"sv,
+   "com_sfx_weap_bolt_exp_lg"sv,
+   "com_sfx_weap_bolt_exp_md"sv,
+   "com_sfx_weap_bolt_exp_sm"sv,
+   "com_sfx_weap_bolt_exp_xl"sv,
+   "com_sfx_weap_con_exp_lg"sv,
+   "com_sfx_weap_con_exp_md"sv,
+   "com_sfx_weap_con_exp_sm"sv,
+   "com_sfx_weap_con_exp_xl"sv,
+   "com_sfx_weap_detpack_exp"sv,
+   "com_sfx_weap_emp_exp_lg"sv,
+   "com_sfx_weap_emp_exp_md"sv,
+   "com_sfx_weap_emp_exp_sm"sv,
+   "com_sfx_weap_emp_exp_xl"sv,
+   "com_sfx_weap_empmortar_ord"sv,
+   "com_sfx_weap_flame_exp_lg"sv,
+   "com_sfx_weap_flame_exp_md"sv,
+   "com_sfx_weap_flame_exp_sm"sv,
+   "com_sfx_weap_flame_exp_xl"sv,
+   "com_sfx_weap_flamethrower_ord"sv,
+   "com_sfx_weap_greenbolt_exp_lg"sv,
+   "com_sfx_weap_greenbolt_exp_md"sv,
+   "com_sfx_weap_greenbolt_exp_sm"sv,
+   "com_sfx_weap_greenbolt_exp_xl"sv,
+   "com_sfx_weap_grenade_blue"sv,
+   "com_sfx_weap_grenade_emp_exp"sv,
+   "com_sfx_weap_grenade_gold"sv,
+   "com_sfx_weap_grenade_green"sv,
+   "com_sfx_weap_grenade_radiation_exp"sv,
+   "com_sfx_weap_grenade_red"sv,
+   "com_sfx_weap_grenade_schrap_exp"sv,
+   "com_sfx_weap_grenade_thermal"sv,
+   "com_sfx_weap_grenade_thermal_exp"sv,
+   "com_sfx_weap_incinerate_ord"sv,
+   "com_sfx_weap_incinerate_ord_exp"sv,
+   "com_sfx_weap_mortartrail_blue"sv,
+   "com_sfx_weap_mortartrail_red"sv,
+   "com_sfx_weap_mortartrail_yellow"sv,
+   "com_sfx_weap_orangebolt_exp_lg"sv,
+   "com_sfx_weap_orangebolt_exp_md"sv,
+   "com_sfx_weap_orangebolt_exp_sm"sv,
+   "com_sfx_weap_orangebolt_exp_xl"sv,
+   "com_sfx_weap_purplebolt_exp_lg"sv,
+   "com_sfx_weap_purplebolt_exp_md"sv,
+   "com_sfx_weap_purplebolt_exp_sm"sv,
+   "com_sfx_weap_purplebolt_exp_xl"sv,
+   "com_sfx_weap_rad_exp_lg"sv,
+   "com_sfx_weap_rad_exp_md"sv,
+   "com_sfx_weap_rad_exp_sm"sv,
+   "com_sfx_weap_rad_exp_xl"sv,
+   "com_sfx_weap_redbolt_exp_lg"sv,
+   "com_sfx_weap_redbolt_exp_md"sv,
+   "com_sfx_weap_redbolt_exp_sm"sv,
+   "com_sfx_weap_redbolt_exp_xl"sv,
+   "com_sfx_weap_remotedroid_exp"sv,
+   "com_sfx_weap_remotedroidcharge2"sv,
+   "com_sfx_weap_rockettrail"sv,
+   "com_sfx_weap_rockettrail_blue"sv,
+   "com_sfx_weap_rockettrail_gold"sv,
+   "com_sfx_weap_rockettrail_green"sv,
+   "com_sfx_weap_rockettrail_purple"sv,
+   "com_sfx_weap_sc_exp_lg"sv,
+   "com_sfx_weap_sc_exp_md"sv,
+   "com_sfx_weap_sc_exp_sm"sv,
+   "com_sfx_weap_sc_exp_xl"sv,
+   "com_sfx_weap_seismiccharge"sv,
+   "com_sfx_weap_shiplaser_exp_lg"sv,
+   "com_sfx_weap_shiplaser_exp_md"sv,
+   "com_sfx_weap_shiplaser_exp_sm"sv,
+   "com_sfx_weap_sonic_exp_sm"sv,
+   "com_sfx_weap_spyrifle_ord"sv,
+   "com_sfx_weap_timebomb"sv,
+   "com_sfx_weap_yellowbolt_exp_lg"sv,
+   "com_sfx_zap"sv,
+   "com_weap_overheat"sv,
+   "ComboAnimationBank"sv,
+   "ComboTime"sv,
+   "commandarmedanimatedbuilding"sv,
+   "CommandHover"sv,
+   "CommandPost"sv,
+   "commandpost_amb_template"sv,
+   "CommandPost_capturelost"sv,
+   "CommandWalker"sv,
+   "Cone"sv,
+   "ConeAngle"sv,
+   "ConeFadeFactor"sv,
+   "ConeFadeLength"sv,
+   "ConeHeight"sv,
+   "ConeInitialWidth"sv,
+   "ConeLength"sv,
+   "ConeWidth"sv,
+   "Connect"sv,
+   "Conquest"sv,
+   "ConstantBlend"sv,
+   "ContrailAttachOffset"sv,
+   "ContrailAttachPoint"sv,
+   "ContrailEffect"sv,
+   "ContrailEffectMaxScale"sv,
+   "ContrailEffectMaxSpeed"sv,
+   "ContrailEffectMinScale"sv,
+   "ContrailEffectMinSpeed"sv,
+   "Controllable"sv,
+   "ControlRegion"sv,
+   "ControlSpeed"sv,
+   "ControlZone"sv,
+   "CoolDownSound"sv,
+   "CoolDownSoundEndPitch"sv,
+   "CoolDownSoundFadeInTime"sv,
+   "CoolDownSoundFadeOutTime"sv,
+   "CoolDownTime"sv,
+   "cor_movies"sv,
+   "cor1tran1"sv,
+   "cormon01"sv,
+   "cormon02"sv,
+   "CorrectAimForSteering"sv,
+   "Count"sv,
+   "Cover"sv,
+   "CoverOdf"sv,
+   "crashed"sv,
+   "crawl1"sv,
+   "crawl2"sv,
+   "crossconstraint"sv,
+   "Crouch"sv,
+   "CrouchAimSpread"sv,
+   "CrouchMoveSpread"sv,
+   "CrouchStillSpread"sv,
+   "CROUCHZOOM"sv,
+   "CTFDefense"sv,
+   "CTFOffense"sv,
+   "CurHealth"sv,
+   "CurShield"sv,
+   "Cursing"sv,
+   "CustomAnimationBank"sv,
+   "cw_music"sv,
+   "CyclePlayback"sv,
+   "Cylinder"sv,
+   "Damage"sv,
+   "DamageAttachOffset"sv,
+   "DamageAttachPoint"sv,
+   "DamageDeduction"sv,
+   "DamageDistance"sv,
+   "DamageEdgeLength"sv,
+   "DamageEdgeWidth"sv,
+   "DamageEffect"sv,
+   "DamageEffectScale"sv,
+   "DamageEffectSound"sv,
+   "DamageFinalDamage"sv,
+   "DamageInheritVelocity"sv,
+   "DamageLength"sv,
+   "DamageRadius"sv,
+   "DamageRadiusInner"sv,
+   "DamageRadiusOuter"sv,
+   "DamageRegionSound"sv,
+   "DamageStartPercent"sv,
+   "DamageStopPercent"sv,
+   "DamageThreshold"sv,
+   "DamageTime"sv,
+   "DamageTransitionDelay"sv,
+   "DamageTransitionPeriod"sv,
+   "DamageWidth"sv,
+   "Dampening"sv,
+   "DarknessMax"sv,
+   "DarknessMin"sv,
+   "Data"sv,
+   "dea_movies"sv,
+   "dea1tran1"sv,
+   "deamon01"sv,
+   "deamon02"sv,
+   "DeathAnimation"sv,
+   "DeathAnimationExplosion"sv,
+   "DeathAnimationExplosionTime"sv,
+   "DeathDustDelay"sv,
+   "DeathDustEffect"sv,
+   "DeathDustOffset"sv,
+   "DeathEffect"sv,
+   "DeathEffectOffset"sv,
+   "DeathFadeTimeEnd"sv,
+   "DeathFadeTimeStart"sv,
+   "Deathmatch"sv,
+   "DeathOnCollision"sv,
+   "DeathShakeDelay"sv,
+   "DeathShakeDuration"sv,
+   "DeathShakeForce"sv,
+   "DeathShakeRadius"sv,
+   "DeathSound"sv,
+   "DeathTime"sv,
+   "DebuffDamageRate"sv,
+   "DebuffDamageTimer"sv,
+   "DebuffEffect"sv,
+   "DebugAnims"sv,
+   "DebugCombos"sv,
+   "Decal"sv,
+   "DecayHFRatio"sv,
+   "DecayTime"sv,
+   "Deceleration"sv,
+   "Default"sv,
+   "DefaultSize"sv,
+   "Defend"sv,
+   "DefendPositionVO"sv,
+   "Deflect"sv,
+   "DeflectAngle"sv,
+   "DeflectAnimation"sv,
+   "DeflectEffect"sv,
+   "DeflectSound"sv,
+   "Degree"sv,
+   "delfriend"sv,
+   "DemoMode"sv,
+   "Density"sv,
+   "DenyFlyerLand"sv,
+   "Depth"sv,
+   "Description"sv,
+   "Destroy"sv,
+   "DestroyedGeometryName"sv,
+   "Destruct"sv,
+   "DestructableBuilding"sv,
+   "DestructChargeEffect"sv,
+   "DestructTiltValue"sv,
+   "DestructTrackOffset"sv,
+   "DetailTexture"sv,
+   "DetailTextureScale"sv,
+   "DetatchSound"sv,
+   "Detonator"sv,
+   "Die"sv,
+   "Difficulty"sv,
+   "Diffusion"sv,
+   "DirectGain"sv,
+   "DirectHFGain"sv,
+   "Direction"sv,
+   "DisableAIAutoBalance"sv,
+   "DisabledEffect"sv,
+   "DisableForCloneWars"sv,
+   "DisableLowRes"sv,
+   "DisableOnEmpty"sv,
+   "DisableTime"sv,
+   "Discharge"sv,
+   "DischargeSound"sv,
+   "Disguise"sv,
+   "DisguiseOwnerModel"sv,
+   "Dispenser"sv,
+   "DisplayRefire"sv,
+   "DisplayTime"sv,
+   "DisputeSound"sv,
+   "Distance"sv,
+   "DistortionScale"sv,
+   "DomeColor"sv,
+   "DomeInfo"sv,
+   "DomeModel"sv,
+   "DopplerMode"sv,
+   "DoubleTap"sv,
+   "Down"sv,
+   "DownSizeFactor"sv,
+   "Drag"sv,
+   "Draw"sv,
+   "DrawDistance"sv,
+   "Droid"sv,
+   "DroidAmmo"sv,
+   "DroidekaAttachBone"sv,
+   "DroidekaShield"sv,
+   "DroidEnergy"sv,
+   "DroidHealth"sv,
+   "DroidScale"sv,
+   "DropItemClass"sv,
+   "DropItemProbability"sv,
+   "DropoffSound"sv,
+   "DroppedColorize"sv,
+   "DroppedInLandingZoneGeometryName"sv,
+   "DropShadowSize"sv,
+   "DropSound"sv,
+   "dumpanimmaps"sv,
+   "DumpMemory"sv,
+   "Duration"sv,
+   "DustEffect"sv,
+   "DustParticleSpeed"sv,
+   "DustVelocity"sv,
+   "DustWake"sv,
+   "Easy"sv,
+   "Edge"sv,
+   "EditOnly"sv,
+   "editor_grasspatch"sv,
+   "editor_prop_bush"sv,
+   "EditorGlobalDirIconSize"sv,
+   "Effect"sv,
+   "EffectDamage"sv,
+   "EffectFalloff"sv,
+   "EffectRegion"sv,
+   "EffectStrength"sv,
+   "EffectType"sv,
+   "EjectResistance"sv,
+   "email"sv,
+   "Emitter"sv,
+   "EmitterOrdnance"sv,
+   "Empire"sv,
+   "empire_halo"sv,
+   "empire_halo2"sv,
+   "Empty"sv,
+   "EmptyText"sv,
+   "Enable"sv,
+   "EnableBottom"sv,
+   "Enabled"sv,
+   "EnableDeathExplosions"sv,
+   "EnableFadeAdjustWithZoom"sv,
+   "EnableFlare"sv,
+   "EnableObject"sv,
+   "End"sv,
+   "EndLaserGlowColor"sv,
+   "EndLightColor"sv,
+   "EnemyColor"sv,
+   "Energy"sv,
+   "EnergyAutoRestore"sv,
+   "EnergyBar"sv,
+   "EnergyBoostDrain"sv,
+   "EnergyCost"sv,
+   "EnergyCostBowling"sv,
+   "EnergyCostJump"sv,
+   "EnergyCostJumpSprint"sv,
+   "EnergyCostRoll"sv,
+   "EnergyDrain"sv,
+   "EnergyDrainRate"sv,
+   "EnergyDrainSprint"sv,
+   "EnergyGainEffect"sv,
+   "EnergyMinSprint"sv,
+   "EnergyOverheat"sv,
+   "EnergyRestore"sv,
+   "EnergyRestoreIdle"sv,
+   "EnergyRestoreRate"sv,
+   "EnergyTrickDrainDoubleTap"sv,
+   "EnergyTrickDrainSingleTap"sv,
+   "EngineSound"sv,
+   "EntityLight"sv,
+   "EnvTexture"sv,
+   "ERDelay"sv,
+   "ERGain"sv,
+   "EventAlpha"sv,
+   "EventBitmap"sv,
+   "EventBlend"sv,
+   "EventChanged"sv,
+   "EventChangeMapMode"sv,
+   "EventColor"sv,
+   "EventDisable"sv,
+   "EventEnable"sv,
+   "EventFadeOut"sv,
+   "EventInput"sv,
+   "EventInputFactor"sv,
+   "EventMesh"sv,
+   "EventNameFilter"sv,
+   "EventNumber"sv,
+   "EventOutput"sv,
+   "EventPlayerIndex"sv,
+   "EventPosition"sv,
+   "EventPostHide"sv,
+   "EventPulseRate"sv,
+   "EventRefreshMarker"sv,
+   "EventRefreshPost"sv,
+   "EventRefreshTarget"sv,
+   "EventResetTargetCommon"sv,
+   "EventResetTargetPlayer"sv,
+   "EventRotation"sv,
+   "EventScale"sv,
+   "EventStop"sv,
+   "EventText"sv,
+   "EventToggleMapMode"sv,
+   "EventTrigger"sv,
+   "EventValue"sv,
+   "ExpireEffect"sv,
+   "ExpireTimeEnemy"sv,
+   "ExpireTimeField"sv,
+   "Explosion"sv,
+   "explosion_distant_template"sv,
+   "explosion_template"sv,
+   "explosion_verydistant_template"sv,
+   "ExplosionBreak"sv,
+   "ExplosionClass"sv,
+   "ExplosionCritical"sv,
+   "ExplosionDeath"sv,
+   "ExplosionDestruct"sv,
+   "ExplosionEffect"sv,
+   "ExplosionExpire"sv,
+   "ExplosionImpact"sv,
+   "ExplosionName"sv,
+   "ExplosionOffset"sv,
+   "ExplosionTrigger"sv,
+   "externlua"sv,
+   "ExtremeRange"sv,
+   "EyePointCenter"sv,
+   "EyePointOffset"sv,
+   "Fade"sv,
+   "FadeDist"sv,
+   "FadeFactor"sv,
+   "FadeHoldTime"sv,
+   "FadeInTime"sv,
+   "FadeLength"sv,
+   "FadeLightColor"sv,
+   "FadeOutTime"sv,
+   "FadePeriod"sv,
+   "FadeSustainTime"sv,
+   "FadeTime"sv,
+   "FadeViewDistance"sv,
+   "fall"sv,
+   "FarMultiScreenRange"sv,
+   "FarSceneRange"sv,
+   "FarSplitScreenRange"sv,
+   "fatray"sv,
+   "fel_movies"sv,
+   "fel1tran1"sv,
+   "felmon01"sv,
+   "felmon02"sv,
+   "FIGHTER"sv,
+   "File"sv,
+   "FileInfo"sv,
+   "Filter"sv,
+   "FinalExplosion"sv,
+   "FinalExplosionName"sv,
+   "FinalExplosionOffset"sv,
+   "FinalFrame"sv,
+   "FinalWidth"sv,
+   "FinAnimation"sv,
+   "Fire"sv,
+   "FIRE2"sv,
+   "FireAnim"sv,
+   "FireBoth"sv,
+   "FireEmptySound"sv,
+   "FireLoopSound"sv,
+   "FireNodeName"sv,
+   "FireOutsideLimits"sv,
+   "FirePoint"sv,
+   "FirePointExtraOffset"sv,
+   "FirePointName"sv,
+   "FireSecondary"sv,
+   "Firesound"sv,
+   "FireSoundStop"sv,
+   "FireStateTime"sv,
+   "Firestop"sv,
+   "FireType"sv,
+   "FireVelocity"sv,
+   "FirstPerson"sv,
+   "FirstPersonFOV"sv,
+   "FirstRadius"sv,
+   "FixedFunction"sv,
+   "FixedRate"sv,
+   "FlagOffScreen"sv,
+   "FlagOffScreenBehind"sv,
+   "FlagOnScreen"sv,
+   "FlagOnScreenBehind"sv,
+   "FlareAngle"sv,
+   "FlareIntensity"sv,
+   "FlareOutSize"sv,
+   "FlashColor"sv,
+   "FlashLength"sv,
+   "FlashLightColor"sv,
+   "FlashLightDuration"sv,
+   "FlashLightRadius"sv,
+   "FlashRadius"sv,
+   "FlashWidth"sv,
+   "FlashyDecFadeOutTime"sv,
+   "FlashyIncFadeOutTime"sv,
+   "FlashyScale"sv,
+   "FlatCount"sv,
+   "FlatFaceFactor"sv,
+   "FlatGrassSwing"sv,
+   "FlatHeight"sv,
+   "FlatInfo"sv,
+   "FlatShadowHeight"sv,
+   "FlatSizeMultiplier"sv,
+   "FleeLikeAHero"sv,
+   "FleeSound"sv,
+   "Flicker"sv,
+   "FlickerAmplitude"sv,
+   "FlickerPeriod"sv,
+   "FlickerTimeMax"sv,
+   "FlickerTimeMin"sv,
+   "FlickerType"sv,
+   "Flip"sv,
+   "FlipSound"sv,
+   "FloatFormat"sv,
+   "FloatsOnWater"sv,
+   "fly"sv,
+   "flyer"sv,
+   "flyer_eng_hi-mid_template"sv,
+   "flyer_eng_low_template"sv,
+   "flyer_foley_template"sv,
+   "flyer_shift_template"sv,
+   "flyer_trick_template"sv,
+   "flyer_weapon_template"sv,
+   "FlyerBan"sv,
+   "FlyerSection"sv,
+   "FlyerSpray"sv,
+   "flythrough_template"sv,
+   "FoamTexture"sv,
+   "FoamTile"sv,
+   "FogColor"sv,
+   "FogFar"sv,
+   "FogNear"sv,
+   "FogRamp"sv,
+   "FogRange"sv,
+   "FoleyFX"sv,
+   "FoleyFXClass"sv,
+   "FoleyFXGroup"sv,
+   "FoleyFXImpact"sv,
+   "FoleyFXSoldier"sv,
+   "FoleyFXWalker"sv,
+   "foliage_collision"sv,
+   "Follow"sv,
+   "font"sv,
+   "FootBoneLeft"sv,
+   "FootBoneRight"sv,
+   "FootSlideEffect"sv,
+   "Footstep0Sound"sv,
+   "Footstep1Sound"sv,
+   "Footstep2Sound"sv,
+   "FootstepLeftRun"sv,
+   "FootstepLeftStop"sv,
+   "FootstepLeftWalk"sv,
+   "FootstepRightRun"sv,
+   "FootstepRightStop"sv,
+   "FootstepRightWalk"sv,
+   "FootstepSound0"sv,
+   "FootstepSound1"sv,
+   "FootstepSound2"sv,
+   "FootstepSound3"sv,
+   "FootstepSound4"sv,
+   "FootstepSound5"sv,
+   "FootstepStride"sv,
+   "FootWaterSplashEffect"sv,
+   "ForceBoot"sv,
+   "ForceFireAnimation"sv,
+   "ForceHiDetail"sv,
+   "ForceLockAimerToParentAimer"sv,
+   "ForceMode"sv,
+   "Format"sv,
+   "Forward"sv,
+   "ForwardSpeed"sv,
+   "ForwardTurnSpeed"sv,
+   "fountain_halo"sv,
+   "FourSegmentLockOn"sv,
+   "FOVEffect1st"sv,
+   "FOVEffect3rd"sv,
+   "FOVEFFectMaxCamOffset3rd"sv,
+   "FOVEFFectMinCamOffset3rd"sv,
+   "FPModelAttachedtoCam"sv,
+   "FPPosePointName"sv,
+   "FPWalkScale"sv,
+   "FrameLock"sv,
+   "FrameRate"sv,
+   "Frames"sv,
+   "FrameSize"sv,
+   "FreeFlyTime"sv,
+   "Frequency"sv,
+   "FresnelMinMax"sv,
+   "Friction"sv,
+   "friend"sv,
+   "FriendlyColor"sv,
+   "friendvoice"sv,
+   "FromAnim"sv,
+   "FromEdge"sv,
+   "FromEnd"sv,
+   "FromSoldier"sv,
+   "FULL"sv,
+   "FullBody"sv,
+   "FXName"sv,
+   "Gain"sv,
+   "GainDev"sv,
+   "gal_sfx_assaultship_exp"sv,
+   "gal_sfx_cruiser_exp"sv,
+   "gal_sfx_fedcruiser_exp"sv,
+   "gal_sfx_moncalamaricruiser_exp"sv,
+   "gal_sfx_stardestroyer_exp"sv,
+   "GAL1"sv,
+   "gam_inf_axe"sv,
+   "gamefont_small"sv,
+   "GameName"sv,
+   "GameSlice"sv,
+   "GammaBrightness"sv,
+   "GammaColorBalance"sv,
+   "GammaContrast"sv,
+   "GammaCorrection"sv,
+   "GammaHue"sv,
+   "gcw_music"sv,
+   "gcwinall1"sv,
+   "GCwinCIS1"sv,
+   "GCwinIMP1"sv,
+   "GCwinREP1"sv,
+   "geo_inf_acklay"sv,
+   "geo_movies"sv,
+   "geo_sfx_weap_blunderbluss_ord"sv,
+   "geo_sfx_weap_blunderbuss_ord"sv,
+   "geo_wingsfly"sv,
+   "Geometry"sv,
+   "GeometryAddon"sv,
+   "GeometryColor"sv,
+   "GeometryColorMax"sv,
+   "GeometryColorMin"sv,
+   "GeometryHeight"sv,
+   "GeometryLowRes"sv,
+   "GeometryName"sv,
+   "geometryScale"sv,
+   "geomon01"sv,
+   "geomon02"sv,
+   "global"sv,
+   "GlobalLights"sv,
+   "Glow"sv,
+   "GlowAlphaBase"sv,
+   "GlowAlphaScale"sv,
+   "GlowFactor"sv,
+   "GlowLength"sv,
+   "GlowScaleSize"sv,
+   "GlowThreshold"sv,
+   "GodRay"sv,
+   "GrapplingHook"sv,
+   "GrapplingHookWeapon"sv,
+   "grasspatch"sv,
+   "Gravity"sv,
+   "GravityScale"sv,
+   "GravityVelocityTarget"sv,
+   "Green"sv,
+   "green_blaster_bolt"sv,
+   "green_blaster_bolt_small"sv,
+   "grenade"sv,
+   "GroundedHeight"sv,
+   "GroundedSound"sv,
+   "GroundEffect"sv,
+   "GroundEffectsPerSec"sv,
+   "GroundEffectSpread"sv,
+   "Group"sv,
+   "GuidedMissile"sv,
+   "GuidedMissileBoostExplosionSpeedThreshold"sv,
+   "GuidedMissileDamage"sv,
+   "GuidedMissileDamageBoost"sv,
+   "GuidedMissileDeathCamMinDistance"sv,
+   "GuidedMissileDeathCamPause"sv,
+   "GuidedMissileDeathCamPullbackSpeed"sv,
+   "hailfire_wake"sv,
+   "HAlign"sv,
+   "Halo"sv,
+   "HaloFadeFactor"sv,
+   "HaloFadeLength"sv,
+   "HaloInnerRing"sv,
+   "HaloMiddleRing"sv,
+   "HaloOutterRing"sv,
+   "HaloRadius"sv,
+   "hard"sv,
+   "HardEdge"sv,
+   "Hardpoint"sv,
+   "Haywire"sv,
+   "hcenter"sv,
+   "hdd"sv,
+   "Head"sv,
+   "HealthGainEffect"sv,
+   "HealthScale"sv,
+   "HealthSScale"sv,
+   "HealthTexture"sv,
+   "HealthType"sv,
+   "HealthTypeForLockOn"sv,
+   "HeardEnemySound"sv,
+   "HeatPerShot"sv,
+   "HeatRecoverRate"sv,
+   "HeatThreshold"sv,
+   "Heavy"sv,
+   "Height"sv,
+   "HeightScale"sv,
+   "her"sv,
+   "hero"sv,
+   "Hero_battle_chatter_template"sv,
+   "HeroDefeated"sv,
+   "heroes"sv,
+   "HeroesUnlocked"sv,
+   "HeroRulePlayer"sv,
+   "HeroRuleRespawn"sv,
+   "HeroRuleRespawnValue"sv,
+   "HeroRuleTeam"sv,
+   "HeroRuleUnlock"sv,
+   "HeroRuleUnlockValue"sv,
+   "HeroSpawned"sv,
+   "HFReference"sv,
+   "HideHealthBar"sv,
+   "HideOnEmpty"sv,
+   "HideOnFire"sv,
+   "HideUnbuiltModel"sv,
+   "HidingSound"sv,
+   "HierarchyLevel"sv,
+   "HighResGeometry"sv,
+   "HintFlagOffScreen"sv,
+   "HintFlagOffScreenBehind"sv,
+   "HintFlagOnScreen"sv,
+   "HintFlagOnScreenBehind"sv,
+   "HintOffScreen"sv,
+   "HintOffScreenBehind"sv,
+   "HintOnScreen"sv,
+   "HintOnScreenBehind"sv,
+   "HitEffect"sv,
+   "HitLocation"sv,
+   "HitSound"sv,
+   "Hold"sv,
+   "HoldRelease"sv,
+   "HoloBeamInitialWidth"sv,
+   "HoloBeamIntensity"sv,
+   "HoloFadeInTime"sv,
+   "HoloFlareIntensity"sv,
+   "HoloFlickerAlphaMax"sv,
+   "HoloFlickerAlphaMin"sv,
+   "HoloFlickerRate"sv,
+   "hologram"sv,
+   "HoloHeight"sv,
+   "HoloImageGeometry"sv,
+   "HoloImageIntensity"sv,
+   "HoloLightIntensity"sv,
+   "HoloLightRadius"sv,
+   "HoloOdf"sv,
+   "HoloPopRate"sv,
+   "HoloRotateRate"sv,
+   "HoloSize"sv,
+   "HoloTurnOnDistance"sv,
+   "HoloTurnOnTime"sv,
+   "HoloType"sv,
+   "HoloVisibleDistance"sv,
+   "HomeRegion"sv,
+   "HorizonAngleMinMax"sv,
+   "HorizontalSpread"sv,
+   "hot_inf_wampa"sv,
+   "hot_movies"sv,
+   "hot_sfx_weap_pawsmash"sv,
+   "hot_sfx_weap_smash"sv,
+   "hot1cam1"sv,
+   "hot1cam2"sv,
+   "hot1tran1"sv,
+   "hotmon01"sv,
+   "hotmon02"sv,
+   "hover"sv,
+   "HoverBan"sv,
+   "HrPlayer"sv,
+   "HrRespawn"sv,
+   "HrRespawnValue"sv,
+   "HrTeam"sv,
+   "HrUnlock"sv,
+   "HrUnlockValue"sv,
+   "hud"sv,
+   "HUDIndex"sv,
+   "HUDIndexDisplay"sv,
+   "HUDModel"sv,
+   "HUDTag"sv,
+   "hudtransforms"sv,
+   "Hue"sv,
+   "HugeBan"sv,
+   "HurtFallSound"sv,
+   "HurtOwner"sv,
+   "HurtSound"sv,
+   "HydraulicLowerHeight"sv,
+   "HydraulicLowerSound"sv,
+   "HydraulicSound"sv,
+   "HydraulicSoundHeight"sv,
+   "I"sv,
+   "i3dl2reverb"sv,
+   "I3DL2ReverbPreset"sv,
+   "IconTexture"sv,
+   "IdleAnimation"sv,
+   "IdleDelay"sv,
+   "IdleRotateSpeed"sv,
+   "IdleWaitTime"sv,
+   "IdleWobbleFactor"sv,
+   "IdleWobbleLeftFoot"sv,
+   "IdleWobbleNode"sv,
+   "IdleWobbleRightFoot"sv,
+   "If"sv,
+   "ifs.movies.corintro.line01"sv,
+   "ifs.movies.corintro.line02"sv,
+   "ifs.movies.corintro.line03"sv,
+   "ifs.movies.corintro.line04"sv,
+   "ifs.movies.corintro.line05"sv,
+   "ifs.movies.corintro.line06"sv,
+   "ifs.movies.corintro.line07"sv,
+   "ifs.movies.corintro.line08"sv,
+   "ifs.movies.corintro.line09"sv,
+   "ifs.movies.coroutro.line01"sv,
+   "ifs.movies.coroutro.line02"sv,
+   "ifs.movies.coroutro.line03"sv,
+   "ifs.movies.coroutro.line04"sv,
+   "ifs.movies.coroutro.line05"sv,
+   "ifs.movies.coroutro.line06"sv,
+   "ifs.movies.coroutro.line07"sv,
+   "ifs.movies.coroutro.line08"sv,
+   "ifs.movies.deaintro.line01"sv,
+   "ifs.movies.deaintro.line02"sv,
+   "ifs.movies.deaintro.line03"sv,
+   "ifs.movies.deaintro.line04"sv,
+   "ifs.movies.deaintro.line05"sv,
+   "ifs.movies.deaintro.line06"sv,
+   "ifs.movies.deaintro.line07"sv,
+   "ifs.movies.deaoutro.line01"sv,
+   "ifs.movies.deaoutro.line02"sv,
+   "ifs.movies.deaoutro.line03"sv,
+   "ifs.movies.deaoutro.line04"sv,
+   "ifs.movies.deaoutro.line05"sv,
+   "ifs.movies.deaoutro.line06"sv,
+   "ifs.movies.deaoutro.line07"sv,
+   "ifs.movies.felintro.line01"sv,
+   "ifs.movies.felintro.line02"sv,
+   "ifs.movies.felintro.line03"sv,
+   "ifs.movies.felintro.line04"sv,
+   "ifs.movies.felintro.line05"sv,
+   "ifs.movies.felintro.line06"sv,
+   "ifs.movies.felintro.line07"sv,
+   "ifs.movies.felintro.line08"sv,
+   "ifs.movies.felintro.line09"sv,
+   "ifs.movies.felintro.line10"sv,
+   "ifs.movies.felintro.line11"sv,
+   "ifs.movies.felintro.line12"sv,
+   "ifs.movies.feloutro.line01"sv,
+   "ifs.movies.feloutro.line02"sv,
+   "ifs.movies.feloutro.line03"sv,
+   "ifs.movies.feloutro.line04"sv,
+   "ifs.movies.geointro.line01"sv,
+   "ifs.movies.geointro.line02"sv,
+   "ifs.movies.geointro.line03"sv,
+   "ifs.movies.geointro.line04"sv,
+   "ifs.movies.geointro.line05"sv,
+   "ifs.movies.geointro.line06"sv,
+   "ifs.movies.geointro.line07"sv,
+   "ifs.movies.geooutro.line01"sv,
+   "ifs.movies.geooutro.line02"sv,
+   "ifs.movies.hotintro.line01"sv,
+   "ifs.movies.hotintro.line02"sv,
+   "ifs.movies.hotintro.line03"sv,
+   "ifs.movies.hotintro.line04"sv,
+   "ifs.movies.hotintro.line05"sv,
+   "ifs.movies.hotintro.line06"sv,
+   "ifs.movies.hotintro.line07"sv,
+   "ifs.movies.hotintro.line08"sv,
+   "ifs.movies.hotintro.line09"sv,
+   "ifs.movies.hotoutro.line01"sv,
+   "ifs.movies.hotoutro.line02"sv,
+   "ifs.movies.hotoutro.line03"sv,
+   "ifs.movies.hotoutro.line04"sv,
+   "ifs.movies.hotoutro.line05"sv,
+   "ifs.movies.hotoutro.line06"sv,
+   "ifs.movies.hotoutro.line07"sv,
+   "ifs.movies.hotoutro.line08"sv,
+   "ifs.movies.hotoutro.line09"sv,
+   "ifs.movies.kamintro.line01"sv,
+   "ifs.movies.kamintro.line02"sv,
+   "ifs.movies.kamintro.line04"sv,
+   "ifs.movies.kamintro.line05"sv,
+   "ifs.movies.kamintro.line06"sv,
+   "ifs.movies.kamintro.line07"sv,
+   "ifs.movies.kamoutro.line01"sv,
+   "ifs.movies.kamoutro.line02"sv,
+   "ifs.movies.kamoutro.line03"sv,
+   "ifs.movies.kamoutro.line04"sv,
+   "ifs.movies.kamoutro.line05"sv,
+   "ifs.movies.kamoutro.line06"sv,
+   "ifs.movies.kamoutro.line07"sv,
+   "ifs.movies.kasintro.line01"sv,
+   "ifs.movies.kasintro.line02"sv,
+   "ifs.movies.kasintro.line03"sv,
+   "ifs.movies.kasintro.line04"sv,
+   "ifs.movies.kasintro.line05"sv,
+   "ifs.movies.kasintro.line06"sv,
+   "ifs.movies.kasintro.line07"sv,
+   "ifs.movies.kasintro.line08"sv,
+   "ifs.movies.kasintro.line09"sv,
+   "ifs.movies.kasintro.line10"sv,
+   "ifs.movies.kasintro.line11"sv,
+   "ifs.movies.kasintro.line12"sv,
+   "ifs.movies.kasintro.line13"sv,
+   "ifs.movies.kasintro.line14"sv,
+   "ifs.movies.kasoutro.line01"sv,
+   "ifs.movies.kasoutro.line02"sv,
+   "ifs.movies.kasoutro.line03"sv,
+   "ifs.movies.kasoutro.line04"sv,
+   "ifs.movies.kasoutro.line05"sv,
+   "ifs.movies.musintro.line01"sv,
+   "ifs.movies.musintro.line02"sv,
+   "ifs.movies.musintro.line03"sv,
+   "ifs.movies.musintro.line04"sv,
+   "ifs.movies.musintro.line05"sv,
+   "ifs.movies.musintro.line06"sv,
+   "ifs.movies.musintro.line07"sv,
+   "ifs.movies.musintro.line08"sv,
+   "ifs.movies.musintro.line09"sv,
+   "ifs.movies.musoutro.line01"sv,
+   "ifs.movies.musoutro.line02"sv,
+   "ifs.movies.musoutro.line03"sv,
+   "ifs.movies.musoutro.line04"sv,
+   "ifs.movies.mygintro.line01"sv,
+   "ifs.movies.mygintro.line02"sv,
+   "ifs.movies.mygintro.line03"sv,
+   "ifs.movies.mygintro.line04"sv,
+   "ifs.movies.mygintro.line05"sv,
+   "ifs.movies.mygintro.line06"sv,
+   "ifs.movies.mygintro.line07"sv,
+   "ifs.movies.mygintro.line08"sv,
+   "ifs.movies.mygintro.line09"sv,
+   "ifs.movies.mygintro.line10"sv,
+   "ifs.movies.mygintro.line11"sv,
+   "ifs.movies.mygintro.line13"sv,
+   "ifs.movies.mygintro.line14"sv,
+   "ifs.movies.mygintro.line15"sv,
+   "ifs.movies.mygoutro.line01"sv,
+   "ifs.movies.mygoutro.line02"sv,
+   "ifs.movies.mygoutro.line03"sv,
+   "ifs.movies.mygoutro.line04"sv,
+   "ifs.movies.mygoutro.line05"sv,
+   "ifs.movies.nabintro.line01"sv,
+   "ifs.movies.nabintro.line02"sv,
+   "ifs.movies.nabintro.line03"sv,
+   "ifs.movies.nabintro.line04"sv,
+   "ifs.movies.nabintro.line05"sv,
+   "ifs.movies.nabintro.line06"sv,
+   "ifs.movies.nabintro.line07"sv,
+   "ifs.movies.nabintro.line08"sv,
+   "ifs.movies.nabintro.line09"sv,
+   "ifs.movies.nabintro.line10"sv,
+   "ifs.movies.nabintro.line11"sv,
+   "ifs.movies.nabintro.line12"sv,
+   "ifs.movies.nabintro.line13"sv,
+   "ifs.movies.nabintro.line14"sv,
+   "ifs.movies.nabintro.line15"sv,
+   "ifs.movies.naboutro.line01"sv,
+   "ifs.movies.naboutro.line02"sv,
+   "ifs.movies.naboutro.line03"sv,
+   "ifs.movies.naboutro.line04"sv,
+   "ifs.movies.naboutro.line05"sv,
+   "ifs.movies.naboutro.line06"sv,
+   "ifs.movies.polintro.line01"sv,
+   "ifs.movies.polintro.line02"sv,
+   "ifs.movies.polintro.line03"sv,
+   "ifs.movies.polintro.line04"sv,
+   "ifs.movies.polintro.line05"sv,
+   "ifs.movies.polintro.line06"sv,
+   "ifs.movies.polintro.line07"sv,
+   "ifs.movies.polintro.line08"sv,
+   "ifs.movies.polintro.line09"sv,
+   "ifs.movies.polintro.line10"sv,
+   "ifs.movies.polintro.line11"sv,
+   "ifs.movies.poloutro.line01"sv,
+   "ifs.movies.poloutro.line02"sv,
+   "ifs.movies.poloutro.line03"sv,
+   "ifs.movies.sb1intro.line01"sv,
+   "ifs.movies.sb1intro.line02"sv,
+   "ifs.movies.sb1intro.line03"sv,
+   "ifs.movies.sb1intro.line04"sv,
+   "ifs.movies.sb1intro.line05"sv,
+   "ifs.movies.sb1intro.line06"sv,
+   "ifs.movies.sb1intro.line07"sv,
+   "ifs.movies.sb1intro.line08"sv,
+   "ifs.movies.sb1intro.line09"sv,
+   "ifs.movies.sb1intro.line10"sv,
+   "ifs.movies.sb1intro.line11"sv,
+   "ifs.movies.sb1outro.line01"sv,
+   "ifs.movies.sb1outro.line02"sv,
+   "ifs.movies.sb1outro.line03"sv,
+   "ifs.movies.sb1outro.line04"sv,
+   "ifs.movies.sb2intro.line01"sv,
+   "ifs.movies.sb2intro.line02"sv,
+   "ifs.movies.sb2intro.line03"sv,
+   "ifs.movies.sb2intro.line04"sv,
+   "ifs.movies.sb2intro.line05"sv,
+   "ifs.movies.sb2outro.line01"sv,
+   "ifs.movies.sb2outro.line02"sv,
+   "ifs.movies.sb2outro.line03"sv,
+   "ifs.movies.sb2outro.line04"sv,
+   "ifs.movies.sb3intro.line01"sv,
+   "ifs.movies.sb3intro.line02"sv,
+   "ifs.movies.sb3intro.line03"sv,
+   "ifs.movies.sb3intro.line04"sv,
+   "ifs.movies.sb3intro.line05"sv,
+   "ifs.movies.sb3intro.line06"sv,
+   "ifs.movies.sb3intro.line07"sv,
+   "ifs.movies.sb3intro.line08"sv,
+   "ifs.movies.sb3intro.line09"sv,
+   "ifs.movies.sb3intro.line10"sv,
+   "ifs.movies.sb3outro.line01"sv,
+   "ifs.movies.sb3outro.line02"sv,
+   "ifs.movies.sb3outro.line03"sv,
+   "ifs.movies.sb4intro.line01"sv,
+   "ifs.movies.sb4intro.line02"sv,
+   "ifs.movies.sb4intro.line03"sv,
+   "ifs.movies.sb4intro.line04"sv,
+   "ifs.movies.sb4intro.line05"sv,
+   "ifs.movies.sb4intro.line06"sv,
+   "ifs.movies.sb4intro.line07"sv,
+   "ifs.movies.sb4intro.line08"sv,
+   "ifs.movies.sb4intro.line09"sv,
+   "ifs.movies.sb4outro.line01"sv,
+   "ifs.movies.sb4outro.line02"sv,
+   "ifs.movies.sb4outro.line03"sv,
+   "ifs.movies.sb4outro.line04"sv,
+   "ifs.movies.tanintro.line01"sv,
+   "ifs.movies.tanintro.line02"sv,
+   "ifs.movies.tanintro.line03"sv,
+   "ifs.movies.tanintro.line04"sv,
+   "ifs.movies.tanintro.line05"sv,
+   "ifs.movies.tanintro.line06"sv,
+   "ifs.movies.tanintro.line07"sv,
+   "ifs.movies.tanintro.line08"sv,
+   "ifs.movies.tanintro.line09"sv,
+   "ifs.movies.tanintro.line10"sv,
+   "ifs.movies.tanoutro.line01"sv,
+   "ifs.movies.tanoutro.line02"sv,
+   "ifs.movies.tanoutro.line03"sv,
+   "ifs.movies.tanoutro.line04"sv,
+   "ifs.movies.tanoutro.line05"sv,
+   "ifs.movies.tanoutro.line06"sv,
+   "ifs.movies.training.line01"sv,
+   "ifs.movies.training.line02"sv,
+   "ifs.movies.training.line03"sv,
+   "ifs.movies.training.line04"sv,
+   "ifs.movies.training.line05"sv,
+   "ifs.movies.training.line06"sv,
+   "ifs.movies.training.line07"sv,
+   "ifs.movies.training.line08"sv,
+   "ifs.movies.training.line09"sv,
+   "ifs.movies.training.line10"sv,
+   "ifs.movies.training.line11"sv,
+   "ifs.movies.training.line12"sv,
+   "ifs.movies.training.line13"sv,
+   "ifs.movies.training.line14"sv,
+   "ifs.movies.training.line15"sv,
+   "ifs.movies.training.line16"sv,
+   "ifs.movies.training.line17"sv,
+   "ifs.movies.training.line18"sv,
+   "ifs.movies.training.line19"sv,
+   "ifs.movies.training.line20"sv,
+   "ifs.movies.utaintro.line01"sv,
+   "ifs.movies.utaintro.line02"sv,
+   "ifs.movies.utaintro.line03"sv,
+   "ifs.movies.utaintro.line04"sv,
+   "ifs.movies.utaintro.line05"sv,
+   "ifs.movies.utaintro.line06"sv,
+   "ifs.movies.utaintro.line07"sv,
+   "ifs.movies.utaintro.line08"sv,
+   "ifs.movies.utaoutro.line01"sv,
+   "ifs.movies.utaoutro.line02"sv,
+   "ifs.movies.utaoutro.line03"sv,
+   "ifs.movies.utaoutro.line04"sv,
+   "ifs.movies.yavintro.line01"sv,
+   "ifs.movies.yavintro.line02"sv,
+   "ifs.movies.yavintro.line03"sv,
+   "ifs.movies.yavintro.line04"sv,
+   "ifs.movies.yavintro.line05"sv,
+   "ifs.movies.yavintro.line06"sv,
+   "ifs.movies.yavintro.line07"sv,
+   "ifs.movies.yavoutro.line01"sv,
+   "ifs.movies.yavoutro.line02"sv,
+   "ifs.movies.yavoutro.line03"sv,
+   "IgnorableCollision"sv,
+   "IgnorableCollsion"sv,
+   "IgnoreHintNodes"sv,
+   "ImmuneToMines"sv,
+   "imp"sv,
+   "imp_hero_darthvader"sv,
+   "imp_hero_emperor"sv,
+   "imp_sfx_atatexplosion"sv,
+   "imp_sfx_atatfinalexplosion"sv,
+   "imp_sfx_jetpack"sv,
+   "imp_sfx_jetpack_darktrooper"sv,
+   "imp_sfx_weap_sonicblast_ord"sv,
+   "imp_sfx_weap_wristrocket_gold"sv,
+   "Impact"sv,
+   "impact_template"sv,
+   "ImpactDecalStatic"sv,
+   "ImpactDecalTerrain"sv,
+   "ImpactEffect"sv,
+   "ImpactEffectRigid"sv,
+   "ImpactEffectShield"sv,
+   "ImpactEffectShieldLarge"sv,
+   "ImpactEffectShieldSmall"sv,
+   "ImpactEffectSoft"sv,
+   "ImpactEffectStatic"sv,
+   "ImpactEffectTerrain"sv,
+   "ImpactEffectWater"sv,
+   "ImpMusic"sv,
+   "Impulse"sv,
+   "InDirectionFactor"sv,
+   "InfiniteDashes"sv,
+   "InFlyer"sv,
+   "ingame"sv,
+   "ingame_movies"sv,
+   "ingame_spawnducked"sv,
+   "ingame_template"sv,
+   "ingamemusic"sv,
+   "Inherit"sv,
+   "InheritMeshInfo"sv,
+   "InheritVelocityFactor"sv,
+   "InHover"sv,
+   "Initial"sv,
+   "InitialCableLength"sv,
+   "InitialEnergyDrain"sv,
+   "InitialFlareOutAlpha"sv,
+   "InitialSalvoDelay"sv,
+   "InitialSalvoDelayProne"sv,
+   "InitialSalvoDelayUnderhand"sv,
+   "InitialWidth"sv,
+   "InputFactor"sv,
+   "InputLock"sv,
+   "Install"sv,
+   "InstantPlayFireAnim"sv,
+   "IntegerFormat"sv,
+   "Intensity"sv,
+   "InterpolationSpeed"sv,
+   "InTurret"sv,
+   "invincible"sv,
+   "InvincibleEffect"sv,
+   "InvisibilityDecRate"sv,
+   "InvisibilityIncRate"sv,
+   "InvisibilityMax"sv,
+   "InvisibilityMin"sv,
+   "InvisibilityPersistTime"sv,
+   "InvisibilityTrigger"sv,
+   "InWalker"sv,
+   "IsAcklay"sv,
+   "IsCollidable"sv,
+   "IsFlyer"sv,
+   "IsHero"sv,
+   "IsHover"sv,
+   "IsLocked"sv,
+   "IsNotTargetableByPlayer"sv,
+   "IsPilotExposed"sv,
+   "IsProne"sv,
+   "IsRocket"sv,
+   "IsSniper"sv,
+   "IsTurret"sv,
+   "IsVisible"sv,
+   "IsWalker"sv,
+   "IsZoomed"sv,
+   "Jet"sv,
+   "JetAcceleration"sv,
+   "JetDuration"sv,
+   "JetEffect"sv,
+   "JetEnergyDrain"sv,
+   "JetFuelCost"sv,
+   "JetFuelInitialCost"sv,
+   "JetFuelMinBorder"sv,
+   "JetFuelRechargeRate"sv,
+   "JetIdleEffect"sv,
+   "JetJump"sv,
+   "JetPush"sv,
+   "JetShowHud"sv,
+   "JetType"sv,
+   "Jitter"sv,
+   "Jump"sv,
+   "JumpDeduction"sv,
+   "JumpEnergyPerSec"sv,
+   "JumpForce"sv,
+   "JumpForwardSpeedBoost"sv,
+   "JumpForwardSpeedFactor"sv,
+   "JumpHeight"sv,
+   "JumpMinSpeed"sv,
+   "JumpMinSpeedMult"sv,
+   "JumpSound"sv,
+   "JumpStrafeSpeedFactor"sv,
+   "JumpTimeMax"sv,
+   "JumpTimeMin"sv,
+   "jungle1"sv,
+   "jungle2"sv,
+   "jungle3"sv,
+   "jungle4"sv,
+   "jungle5"sv,
+   "jungle6"sv,
+   "kam_movies"sv,
+   "kam1tran1"sv,
+   "kammon01"sv,
+   "kammon02"sv,
+   "kas_movies"sv,
+   "kas1c_h"sv,
+   "kas2tran1"sv,
+   "kasmon01"sv,
+   "kasmon02"sv,
+   "KickBuildup"sv,
+   "KickSpread"sv,
+   "KickStrength"sv,
+   "KillRegion"sv,
+   "KillSoldierSound"sv,
+   "Knot"sv,
+   "Label"sv,
+   "lan"sv,
+   "Land"sv,
+   "LandedHeight"sv,
+   "LandingSpeed"sv,
+   "LandingTime"sv,
+   "LandOnArrival"sv,
+   "LandSound"sv,
+   "lang"sv,
+   "large_muzzle_flash"sv,
+   "LaserGlowColor"sv,
+   "LaserLength"sv,
+   "LaserTexture"sv,
+   "LaserWidth"sv,
+   "latency"sv,
+   "launcher"sv,
+   "Layer"sv,
+   "Leaf"sv,
+   "LeafFall"sv,
+   "LeafPatch"sv,
+   "Left"sv,
+   "LeftFootstepSound"sv,
+   "LegBoneLeft"sv,
+   "LegBoneRight"sv,
+   "LegBoneTopLeft"sv,
+   "LegBoneTopRight"sv,
+   "LegPairCount"sv,
+   "LegRayHitLength"sv,
+   "Length"sv,
+   "LevelDamp"sv,
+   "LevelFilter"sv,
+   "LevelFilterLanding"sv,
+   "LevelSpring"sv,
+   "LifeSpan"sv,
+   "LifeTime"sv,
+   "LiftDamp"sv,
+   "LiftSpring"sv,
+   "Light"sv,
+   "Light1"sv,
+   "Light2"sv,
+   "LightAzimAndElev"sv,
+   "LightBeam"sv,
+   "LightColor"sv,
+   "LightDuration"sv,
+   "Lighting"sv,
+   "LightName"sv,
+   "LightningBolt"sv,
+   "LightningEffect"sv,
+   "LightningEffectScale"sv,
+   "LightOdf"sv,
+   "LightRadius"sv,
+   "LightSaberGlowTexture"sv,
+   "LightSaberLength"sv,
+   "LightSaberTexture"sv,
+   "LightSaberTrailColor"sv,
+   "LightSaberWidth"sv,
+   "LimitAi"sv,
+   "Load"sv,
+   "load_bar"sv,
+   "load_transition"sv,
+   "load_xtracking"sv,
+   "load_ytracking"sv,
+   "load_zoom"sv,
+   "LoadingTextBlinkRate"sv,
+   "LoadingTextColorPallete"sv,
+   "LoadSpam"sv,
+   "locals"sv,
+   "LocalsColor"sv,
+   "LockedOffScreen"sv,
+   "LockedOffScreenBehind"sv,
+   "LockedOnScreen"sv,
+   "LockedOnScreenBehind"sv,
+   "LockedOnSound"sv,
+   "LockedSound"sv,
+   "LockOffAngle"sv,
+   "LockOn"sv,
+   "LockOnAngle"sv,
+   "LockOnMaxDist"sv,
+   "LockOnMaxTrackDist"sv,
+   "LockOnMinDist"sv,
+   "LockOnRange"sv,
+   "LockOnTime"sv,
+   "LockTime"sv,
+   "LODDecimation"sv,
+   "LodGroup"sv,
+   "LODPriorityMod"sv,
+   "log"sv,
+   "logfinalscore"sv,
+   "Loop"sv,
+   "Looping"sv,
+   "loss"sv,
+   "LostMusic"sv,
+   "LostSound"sv,
+   "LowHealthSound"sv,
+   "LowHealthThreshold"sv,
+   "LowResModel"sv,
+   "LowResPose"sv,
+   "LowResTerrain"sv,
+   "MagReloadTime"sv,
+   "main"sv,
+   "MainMain"sv,
+   "MainTexture"sv,
+   "Map"sv,
+   "MapRangeOverall"sv,
+   "MapRangeShooting"sv,
+   "MapRangeViewCone"sv,
+   "MapScale"sv,
+   "MapSpeedMax"sv,
+   "MapSpeedMin"sv,
+   "MapTargetFadeRate"sv,
+   "MapTexture"sv,
+   "MapViewConeAngle"sv,
+   "MapViewMax"sv,
+   "MapViewMin"sv,
+   "MarkerLarge"sv,
+   "MarkerSmall"sv,
+   "MarkerSpawn"sv,
+   "Mask"sv,
+   "MaskTexCoords"sv,
+   "MaxAcceleration"sv,
+   "MaxAlpha"sv,
+   "MaxAngle"sv,
+   "MaxBallAngle"sv,
+   "MaxBranches"sv,
+   "MaxChargeStrengthHeavy"sv,
+   "MaxChargeStrengthLight"sv,
+   "MaxDamage"sv,
+   "MaxDecals"sv,
+   "MaxDelayHeavy"sv,
+   "MaxDelayLight"sv,
+   "MaxDiffuseColor"sv,
+   "MaxDist"sv,
+   "MaxDistance"sv,
+   "MaxEntities"sv,
+   "MaxFallingLeaves"sv,
+   "MaxGodraysInWorld"sv,
+   "MaxGodraysOnScreen"sv,
+   "MaxHealth"sv,
+   "MaxHeavy"sv,
+   "MaxHeavyDecay"sv,
+   "MaxInterval"sv,
+   "MaxItems"sv,
+   "MaxJumpDistance"sv,
+   "MaxLength"sv,
+   "MaxLifetime"sv,
+   "MaxLight"sv,
+   "MaxLightDecay"sv,
+   "MaxLodDist"sv,
+   "MaxOmega"sv,
+   "MaxParticles"sv,
+   "MaxParticleScale"sv,
+   "MaxPitchSpeed"sv,
+   "MaxPlaybackTime"sv,
+   "MaxPos"sv,
+   "MaxPressedTime"sv,
+   "MaxPush"sv,
+   "MaxRandomSideOffset"sv,
+   "MaxRange"sv,
+   "MaxRaysPerGodray"sv,
+   "MaxScale"sv,
+   "MaxScatterBirds"sv,
+   "MaxShadowLength"sv,
+   "MaxShakeAmt"sv,
+   "MaxShakeLen"sv,
+   "MaxShield"sv,
+   "MaxSize"sv,
+   "MaxSkew"sv,
+   "MaxSpeed"sv,
+   "maxsplit"sv,
+   "MaxSpread"sv,
+   "MaxSquadronSize"sv,
+   "maxsquadsize"sv,
+   "MaxStrafeSpeed"sv,
+   "MaxStrength"sv,
+   "MaxTargets"sv,
+   "MaxTerrainAngle"sv,
+   "MaxTimeLeftHeavy"sv,
+   "MaxTimeLeftLight"sv,
+   "MaxTotalWeight"sv,
+   "MaxTurnSpeed"sv,
+   "MaxValue"sv,
+   "MaxVel"sv,
+   "MaxViewDistance"sv,
+   "MaxYawSpeed"sv,
+   "med_muzzle_flash"sv,
+   "MedalsTypeToLock"sv,
+   "MedalsTypeToUnlock"sv,
+   "MEDIUM"sv,
+   "MediumBan"sv,
+   "melee"sv,
+   "MemberID"sv,
+   "Mesh"sv,
+   "MeshInfo"sv,
+   "MidSpeed"sv,
+   "MinAlpha"sv,
+   "MinDamage"sv,
+   "MinDelayHeavy"sv,
+   "MinDelayLight"sv,
+   "MinDiffuseColor"sv,
+   "MinDistance"sv,
+   "Mindtrick"sv,
+   "mine"sv,
+   "MineHealth"sv,
+   "MinEnemyRadius"sv,
+   "MinFootHeight"sv,
+   "MinHeavy"sv,
+   "MinHeavyDecay"sv,
+   "MinInactiveTime"sv,
+   "MinInterval"sv,
+   "MinLifeTime"sv,
+   "MinLight"sv,
+   "MinLightDecay"sv,
+   "MinLodDist"sv,
+   "MinMaxDepth"sv,
+   "MinOmega"sv,
+   "MinParticleScale"sv,
+   "MinPlaybackTime"sv,
+   "MinPos"sv,
+   "MinPush"sv,
+   "MinRange"sv,
+   "MinRaysPerGodray"sv,
+   "MinScale"sv,
+   "MinShakeAmt"sv,
+   "MinShakeLen"sv,
+   "MinSize"sv,
+   "MinSpeed"sv,
+   "MinSpread"sv,
+   "MinStrength"sv,
+   "MinTimeLeftHeavy"sv,
+   "MinTimeLeftLight"sv,
+   "MinValue"sv,
+   "MinVel"sv,
+   "MirrorInfo"sv,
+   "missile"sv,
+   "missile_incoming"sv,
+   "missile_locked_on_me"sv,
+   "missile_locking_on_me"sv,
+   "MissionLog"sv,
+   "Mode"sv,
+   "Mode3D"sv,
+   "ModeDoppler"sv,
+   "Model"sv,
+   "Model3D"sv,
+   "ModeTexture"sv,
+   "ModeTextureColor"sv,
+   "Modulate"sv,
+   "MomentumFilter"sv,
+   "MountPos"sv,
+   "MouseTurnDecay"sv,
+   "Move"sv,
+   "MovementScale"sv,
+   "MoveTension"sv,
+   "MoveTensionX"sv,
+   "MoveTensionY"sv,
+   "MoveTensionZ"sv,
+   "MoveX"sv,
+   "MoveY"sv,
+   "MoveZ"sv,
+   "Movie"sv,
+   "MovieProperties"sv,
+   "moviesubtitles"sv,
+   "MovingTurnOnly"sv,
+   "MultilineText"sv,
+   "multiworld"sv,
+   "mus_movies"sv,
+   "mus_sfx_blur"sv,
+   "mus_sfx_droidconcept"sv,
+   "mus_sfx_lavaburst"sv,
+   "mus_sfx_lavaburst_xl"sv,
+   "mus_sfx_lavaspray"sv,
+   "mus_sfx_lavaspray_skydome"sv,
+   "mus_sfx_lightningballs"sv,
+   "mus_sfx_sparks"sv,
+   "mus1"sv,
+   "mus1_1CTF"sv,
+   "mus1_BRun"sv,
+   "mus1_campaign"sv,
+   "mus1_CTF"sv,
+   "mus1_CTFCP"sv,
+   "mus1_deathreagen"sv,
+   "mus1_design"sv,
+   "mus1_grate2"sv,
+   "mus1_mist"sv,
+   "mus1_rumble"sv,
+   "mus1_SoundEmitters"sv,
+   "mus1_SoundRegions"sv,
+   "mus1_SoundSpaces"sv,
+   "mus1_TDM"sv,
+   "mus1tran1"sv,
+   "music"sv,
+   "MusicDelay"sv,
+   "MusicSpeed"sv,
+   "musmon01"sv,
+   "musmon02"sv,
+   "MustShowOneFrame"sv,
+   "mute"sv,
+   "MuteDistance"sv,
+   "MuzzleFlash"sv,
+   "MuzzleFlashEffect"sv,
+   "MuzzleFlashModel"sv,
+   "myg_movies"sv,
+   "myg_sfx_fire"sv,
+   "myg1"sv,
+   "myg1_Buildings"sv,
+   "myg1_Con-VehicleSpawns"sv,
+   "myg1_CP-Assault"sv,
+   "myg1_cp-conquest"sv,
+   "myg1_CTF"sv,
+   "myg1_design"sv,
+   "myg1_flags"sv,
+   "myg1_Platforms"sv,
+   "myg1_Rubble"sv,
+   "myg1_sfx_collector"sv,
+   "myg1_sfx_collector_damage1"sv,
+   "myg1_sfx_collector_damage2"sv,
+   "myg1_sfx_collector_damage3"sv,
+   "myg1_sfx_collector_damage4"sv,
+   "myg1_sfx_collector_exp"sv,
+   "myg1_sfx_generator_damage1"sv,
+   "myg1_sfx_generator_damage2"sv,
+   "myg1_sfx_generator_damage3"sv,
+   "myg1_shields"sv,
+   "myg1_SoundRegions"sv,
+   "myg1_Turrets"sv,
+   "myg1tran1"sv,
+   "mygmon01"sv,
+   "mygmon02"sv,
+   "nab_fireworks"sv,
+   "nab_movies"sv,
+   "nab_sfx_fountain"sv,
+   "nab1c_h"sv,
+   "nab1tran1"sv,
+   "nab2_attached_lights"sv,
+   "nab2_prop_treebill"sv,
+   "nab2c_h"sv,
+   "nabmon01"sv,
+   "nabmon02"sv,
+   "naboo2"sv,
+   "naboo2_1Flag"sv,
+   "naboo2_campaign"sv,
+   "naboo2_Collision"sv,
+   "naboo2_CommonDesign"sv,
+   "naboo2_Conquest"sv,
+   "naboo2_CTF"sv,
+   "naboo2_hunt"sv,
+   "naboo2_Reflections"sv,
+   "naboo2_soundemitters"sv,
+   "naboo2_SoundRegions"sv,
+   "naboo2_TDM"sv,
+   "Name"sv,
+   "NameMesh"sv,
+   "Near"sv,
+   "NearMultiScreenRange"sv,
+   "NearSceneRange"sv,
+   "NearSplitScreenRange"sv,
+   "NeedAmmoVO"sv,
+   "NeedBackupVO"sv,
+   "NeedMedicVO"sv,
+   "NeedPickupVO"sv,
+   "NeedRepairVO"sv,
+   "nethires"sv,
+   "NetPlayers"sv,
+   "NetRegion"sv,
+   "NetUpdateSize"sv,
+   "neu"sv,
+   "neutral"sv,
+   "NeutralColor"sv,
+   "NeutralizeTime"sv,
+   "NeverCrashWhenUnpiloted"sv,
+   "NewAttack"sv,
+   "Next"sv,
+   "NextAimer"sv,
+   "NextBarrel"sv,
+   "NEXTCHARGE"sv,
+   "NextDropItem"sv,
+   "NextIsGrouped"sv,
+   "NextLinkedTerminal"sv,
+   "NoAi"sv,
+   "NoAIBoard"sv,
+   "NoAim"sv,
+   "NoAudioStreaming"sv,
+   "NoChaining"sv,
+   "NoCheckcd"sv,
+   "NoCombatInterrupt"sv,
+   "Node"sv,
+   "NoDeathExplosions"sv,
+   "NoDebugHeap"sv,
+   "Nodes"sv,
+   "NoDrag"sv,
+   "NoEnterVehicles"sv,
+   "NoFirstPersonFireAnim"sv,
+   "NoFrameLock"sv,
+   "NoIntro"sv,
+   "NoiseFreq"sv,
+   "NoiseRoughness"sv,
+   "NoJournal"sv,
+   "NoLifeSpanDisplay"sv,
+   "NoMovies"sv,
+   "NoNames"sv,
+   "none"sv,
+   "none_reformat"sv,
+   "NoPoolErrors"sv,
+   "NoPortals"sv,
+   "NoPregame"sv,
+   "NoRandomSpring"sv,
+   "NoRegisterStep"sv,
+   "NoRender"sv,
+   "NoReverb"sv,
+   "Normal"sv,
+   "NormalDirection"sv,
+   "NormalMapTextures"sv,
+   "North"sv,
+   "NorthLarge"sv,
+   "NorthSmall"sv,
+   "NorthSpawn"sv,
+   "NoSound"sv,
+   "NoStartUpMusic"sv,
+   "NoTargetLightningEffectCount"sv,
+   "NoTargetLightningEffectRandomSpread"sv,
+   "noteamdamage"sv,
+   "NotValues"sv,
+   "NoWait"sv,
+   "NoWaitLate"sv,
+   "NTGUI"sv,
+   "NumberColor"sv,
+   "NumberToTime"sv,
+   "NumberVector3"sv,
+   "NumBloomPasses"sv,
+   "NumBobPoints"sv,
+   "NumChildren"sv,
+   "NumChunks"sv,
+   "NumDamageEdges"sv,
+   "NumDustObjectsInEffects"sv,
+   "NumFlareOuts"sv,
+   "NumLines"sv,
+   "NumObjects"sv,
+   "NumParticles"sv,
+   "NumParts"sv,
+   "NumRays"sv,
+   "NumSegments"sv,
+   "NumStars"sv,
+   "NumSubFlashesMinMax"sv,
+   "NumTentacles"sv,
+   "NumVisible"sv,
+   "Object"sv,
+   "ObjectiveList"sv,
+   "ObjectiveOffScreen"sv,
+   "ObjectiveOffScreenBehind"sv,
+   "ObjectiveOnScreen"sv,
+   "ObjectiveOnScreenBehind"sv,
+   "ObjectVisibility"sv,
+   "ObstructionHFGain"sv,
+   "ObstructionLFRatio"sv,
+   "OcclusionHFGain"sv,
+   "OcclusionLFRatio"sv,
+   "OceanEnable"sv,
+   "Odf"sv,
+   "offensive"sv,
+   "Offhand"sv,
+   "Offhand2"sv,
+   "Offhand3"sv,
+   "OffhandAnimation"sv,
+   "OffhandFirePointName"sv,
+   "OffhandGeometryName"sv,
+   "OffhandWeapon"sv,
+   "Offset"sv,
+   "OffsetAngle"sv,
+   "OffsetPath"sv,
+   "OffsetUV"sv,
+   "OffTime"sv,
+   "OldTerrainShader"sv,
+   "OmegaXDamp"sv,
+   "OmegaXSpring"sv,
+   "OmegaZDamp"sv,
+   "OmegaZSpring"sv,
+   "Omni"sv,
+   "OmniLightRadius"sv,
+   "OmniRadius"sv,
+   "On"sv,
+   "OneWorld"sv,
+   "OnSound"sv,
+   "OnTime"sv,
+   "OpenRatio"sv,
+   "OpenSound"sv,
+   "OpenTrigger"sv,
+   "OptimalRange"sv,
+   "Or"sv,
+   "Ordnance"sv,
+   "ordnance_template"sv,
+   "Ordnancecollision"sv,
+   "OrdnanceCollisionPrim"sv,
+   "OrdnanceEffect"sv,
+   "OrdnanceGeometryName"sv,
+   "OrdnanceName"sv,
+   "OrdnanceSound"sv,
+   "OscillationEnable"sv,
+   "OverheatSound"sv,
+   "OverheatSoundPitch"sv,
+   "OverheatStopSound"sv,
+   "OverrideTexture"sv,
+   "OverrideTexture2"sv,
+   "pain_chatter_template"sv,
+   "Pan"sv,
+   "Parent"sv,
+   "PARTICLE"sv,
+   "ParticleDensity"sv,
+   "ParticleDensityRange"sv,
+   "ParticleEmitter"sv,
+   "ParticleLengthMaxSpeed"sv,
+   "ParticleLengthMinSpeed"sv,
+   "particlemass"sv,
+   "ParticleSize"sv,
+   "PassengerEyePoint"sv,
+   "PassengerSlots"sv,
+   "PassThrough"sv,
+   "password"sv,
+   "PatchDivisions"sv,
+   "PatchResolution"sv,
+   "Path"sv,
+   "PathCount"sv,
+   "PathFollowerAcceleration"sv,
+   "PathFollowerBranchMaxAngle"sv,
+   "PathFollowerBranchPaths"sv,
+   "PathFollowerBranchRange"sv,
+   "PathFollowerClass"sv,
+   "PathFollowerClass_CTF"sv,
+   "PathFollowerFlyerVsFlyer"sv,
+   "PathFollowerMinBranchDist"sv,
+   "PathFollowerRollAcceleration"sv,
+   "PathFollowerRollAccelerationLag"sv,
+   "PathFollowerRollTolerance"sv,
+   "PathFollowerSpeed"sv,
+   "PathRoll"sv,
+   "PathSpeedType"sv,
+   "PathTime"sv,
+   "PathType"sv,
+   "PauseTime"sv,
+   "PCaxPitchSpeed"sv,
+   "PCMaxPitchSpeed"sv,
+   "PCMaxStrafeSpeed"sv,
+   "PCMaxTurnSpeed"sv,
+   "PCMaxYawSpeed"sv,
+   "PCPitchRate"sv,
+   "PCPitchSpeed"sv,
+   "PCPitchTurnFactor"sv,
+   "PCSpinRate"sv,
+   "PCTurnRate"sv,
+   "PCTurnSpeed"sv,
+   "PCYawTurnFactor"sv,
+   "PerceivedTeam"sv,
+   "Percent"sv,
+   "Person"sv,
+   "PersonAmmo"sv,
+   "PersonEnergy"sv,
+   "PersonHealth"sv,
+   "PersonScale"sv,
+   "PhillipsConstant"sv,
+   "PhysicsActive"sv,
+   "PickupSound"sv,
+   "Pilot"sv,
+   "Pilot9Pose"sv,
+   "PilotAnimation"sv,
+   "PilotDeath"sv,
+   "PilotPosition"sv,
+   "PilotSkillRepairScale"sv,
+   "PilotType"sv,
+   "Pitch"sv,
+   "PitchBuildupMultiplier"sv,
+   "PitchDamp"sv,
+   "PitchDev"sv,
+   "PitchFactor"sv,
+   "PitchFilter"sv,
+   "PitchFilterDecel"sv,
+   "PitchLimits"sv,
+   "PitchRate"sv,
+   "PitchSpread"sv,
+   "PitchTurnFactor"sv,
+   "PlantedHash"sv,
+   "Playback"sv,
+   "PlayEffectOnOwner"sv,
+   "PlayEffectOnOwnerAimer"sv,
+   "Player"sv,
+   "player_command_template"sv,
+   "Player1objectives"sv,
+   "Player2objectives"sv,
+   "Player3objectives"sv,
+   "Player4objectives"sv,
+   "playercount"sv,
+   "PlayerDirectionLarge"sv,
+   "PlayerDirectionSmall"sv,
+   "PlayerDirectionSpawn"sv,
+   "playerflyerpathing"sv,
+   "PlayerFOVLarge"sv,
+   "PlayerFOVSmall"sv,
+   "PlayerFOVSpawn"sv,
+   "PlayerHealthBelow25"sv,
+   "PlayerLimit"sv,
+   "PlayerText"sv,
+   "PlayExplosion"sv,
+   "PlayInterval"sv,
+   "PlayIntervalDev"sv,
+   "PlayProbability"sv,
+   "Point"sv,
+   "PointsToUnlock"sv,
+   "pol_movies"sv,
+   "pol1"sv,
+   "pol1_1flag"sv,
+   "pol1_buildings01"sv,
+   "pol1_Campaign"sv,
+   "pol1_Common_Design"sv,
+   "pol1_Conquest"sv,
+   "pol1_ctf"sv,
+   "pol1_Damage01"sv,
+   "pol1_death"sv,
+   "pol1_pol1_rumble"sv,
+   "pol1_Roids01"sv,
+   "pol1_SoundEmitters"sv,
+   "pol1_SoundRegions"sv,
+   "pol1_SoundSpaces"sv,
+   "pol1_TDM"sv,
+   "pol1_Temp"sv,
+   "pol1tran1"sv,
+   "polmon01"sv,
+   "polmon02"sv,
+   "PoolErrors"sv,
+   "Portal"sv,
+   "Position"sv,
+   "PositionLarge"sv,
+   "PositionRelative"sv,
+   "PositionRelativeLarge"sv,
+   "PositionRelativeSmall"sv,
+   "PositionRelativeSpawn"sv,
+   "PositionScale"sv,
+   "PositionSmall"sv,
+   "PositionSpawn"sv,
+   "PositionX"sv,
+   "PositionY"sv,
+   "PositionZ"sv,
+   "PostFlashColor"sv,
+   "PostFlashRadius"sv,
+   "PostFlashRate"sv,
+   "PostLarge"sv,
+   "PostNumbers"sv,
+   "PostSelectLarge"sv,
+   "PostSelectSmall"sv,
+   "PostSelectSpawn"sv,
+   "PostSmall"sv,
+   "PostSpawn"sv,
+   "PostTextLarge"sv,
+   "PostTextSmall"sv,
+   "PostTextSpawn"sv,
+   "Posture"sv,
+   "PowerupDelay"sv,
+   "PowerUpItem"sv,
+   "PowerupSound"sv,
+   "PowerUpStation"sv,
+   "ppass"sv,
+   "PPitchRate"sv,
+   "pregametime"sv,
+   "PreparingForDamageSound"sv,
+   "Press"sv,
+   "PrevLinkedTerminal"sv,
+   "PrimaryStance"sv,
+   "PrimaryWeapon"sv,
+   "PrimaryWeaponIndex"sv,
+   "priority"sv,
+   "ProceduralBarBitmap"sv,
+   "profile"sv,
+   "ProgressBarLEDColor"sv,
+   "ProgressBarLEDHeight"sv,
+   "ProgressBarLEDMinIntensity"sv,
+   "ProgressBarLEDSpacing"sv,
+   "ProgressBarLEDTexture"sv,
+   "ProgressBarLEDWidth"sv,
+   "ProgressBarNumLEDs"sv,
+   "ProgressBarTotalTime"sv,
+   "ProjectedTexture"sv,
+   "Prone"sv,
+   "ProneAimSpread"sv,
+   "ProneMoveSpread"sv,
+   "ProneSound"sv,
+   "ProneStillSpread"sv,
+   "ProneZoom"sv,
+   "prop"sv,
+   "prop_corridorsmoke"sv,
+   "prop_fan"sv,
+   "prop_steamgrate"sv,
+   "prop_steampipe"sv,
+   "prop_torturedroid"sv,
+   "PropagateAlpha"sv,
+   "PropClusterDensity"sv,
+   "PropClusterEnable"sv,
+   "PropClusterFadeAdj"sv,
+   "Properties"sv,
+   "Property"sv,
+   "props_template"sv,
+   "ProximityMaxDist"sv,
+   "ProximityMinDist"sv,
+   "PS2BlendMode"sv,
+   "PS2Overbright"sv,
+   "PuffInfo"sv,
+   "Pull"sv,
+   "Pulse"sv,
+   "Push"sv,
+   "PushDeadOnly"sv,
+   "PushDeduction"sv,
+   "PushRadius"sv,
+   "PushRadiusInner"sv,
+   "PushRadiusOuter"sv,
+   "QuadScreen"sv,
+   "quakecam"sv,
+   "R"sv,
+   "Radius"sv,
+   "RadiusDamageSizeScale"sv,
+   "RadiusFadeMax"sv,
+   "RadiusFadeMin"sv,
+   "RadiusForMaxRays"sv,
+   "RainInfo"sv,
+   "RandomBackdrop"sv,
+   "Randomize"sv,
+   "RandomSeed"sv,
+   "Range"sv,
+   "Ray"sv,
+   "RayRadius"sv,
+   "RayTriggerMinSpeed"sv,
+   "RayTriggerWidth"sv,
+   "Reach"sv,
+   "ReallyFar"sv,
+   "ReallyNear"sv,
+   "Rebound"sv,
+   "RecoilDecayHeavy"sv,
+   "RecoilDecayLight"sv,
+   "RecoilDelayHeavy"sv,
+   "RecoilDelayLight"sv,
+   "RecoilLengthHeavy"sv,
+   "RecoilLengthLight"sv,
+   "RecoilStrengthHeavy"sv,
+   "RecoilStrengthLight"sv,
+   "record"sv,
+   "recorddir"sv,
+   "RecoverFromTumble"sv,
+   "Rect"sv,
+   "Red"sv,
+   "red_blaster_bolt"sv,
+   "red_blaster_bolt_small"sv,
+   "ReferenceSpeed"sv,
+   "RefillFromItem"sv,
+   "Reflect"sv,
+   "Reflected"sv,
+   "ReflectionColor"sv,
+   "ReflectionFogColor"sv,
+   "RefractionColor"sv,
+   "Region"sv,
+   "Reinforcements"sv,
+   "Relative"sv,
+   "RelativeSize"sv,
+   "RelativeWidthHeight"sv,
+   "Release"sv,
+   "Reload"sv,
+   "ReloadSound"sv,
+   "ReloadTime"sv,
+   "Remote"sv,
+   "RemoteGameObject"sv,
+   "REMOTETERMINAL"sv,
+   "RemoveFromMapWhenDead"sv,
+   "RemoveSample"sv,
+   "rep"sv,
+   "rep_halo"sv,
+   "rep_hero_aalya"sv,
+   "rep_hero_ep3obiwan"sv,
+   "rep_hero_kiyadi"sv,
+   "rep_hero_macewindu"sv,
+   "rep_hero_yoda"sv,
+   "rep_sfx_jetpack"sv,
+   "Repair"sv,
+   "Repeat"sv,
+   "RepMusic"sv,
+   "republic"sv,
+   "ReserveOneForPlayer"sv,
+   "ResetTeam"sv,
+   "Resolution"sv,
+   "RespawnTime"sv,
+   "Restart"sv,
+   "RestartAnimation"sv,
+   "RestDir"sv,
+   "ReticuleInAimingOnly"sv,
+   "ReticuleTexture"sv,
+   "ReturnDuration"sv,
+   "ReverbDelay"sv,
+   "ReverbGain"sv,
+   "ReverseBackwardSteering"sv,
+   "ReverseSpeed"sv,
+   "RhenVar2"sv,
+   "RhenVar2_SoundRegions"sv,
+   "rhenvar2_soundspaces"sv,
+   "rhn_proprocks"sv,
+   "rhn_proprocks_02"sv,
+   "right"sv,
+   "RightFootstepSound"sv,
+   "roll"sv,
+   "RollIn"sv,
+   "RollInDistance"sv,
+   "RollOff"sv,
+   "RollRate"sv,
+   "RollRateAccel"sv,
+   "RollSound"sv,
+   "RollSpeedFactor"sv,
+   "RollTime"sv,
+   "RoomGain"sv,
+   "RoomHFGain"sv,
+   "RoomRollOff"sv,
+   "RoomRollOffFactor"sv,
+   "root"sv,
+   "RootIsSlot"sv,
+   "Rotation"sv,
+   "RotationRange"sv,
+   "RotationRate"sv,
+   "RotationSpeed"sv,
+   "RotationVelocity"sv,
+   "Rotator"sv,
+   "RoundDelay"sv,
+   "RoundsPerClip"sv,
+   "RoundsPerSalvo"sv,
+   "RumbleEffect"sv,
+   "RunSpeed"sv,
+   "safemode"sv,
+   "SalvoCount"sv,
+   "SalvoDelay"sv,
+   "SalvoTime"sv,
+   "Sample"sv,
+   "SampleList"sv,
+   "Saturation"sv,
+   "sb1mon01"sv,
+   "sb1mon02"sv,
+   "sb1tran1"sv,
+   "sb2mon01"sv,
+   "sb2mon02"sv,
+   "sb2tran1"sv,
+   "sb3mon01"sv,
+   "sb3mon02"sv,
+   "sb3tran1"sv,
+   "sb4mon01"sv,
+   "sb4mon02"sv,
+   "sb4tran1"sv,
+   "Scalable"sv,
+   "Scale"sv,
+   "ScaleAll"sv,
+   "ScaleSize"sv,
+   "ScaleTexture"sv,
+   "ScaleTime"sv,
+   "ScaleUniform"sv,
+   "ScanningRange"sv,
+   "ScatterDistance"sv,
+   "SCDriverGetInSound"sv,
+   "SCDriverGetOutSound"sv,
+   "SCFieldFollowSound"sv,
+   "SCFieldHoldSound"sv,
+   "SCFieldMoveOutSound"sv,
+   "SCGunnerAllClearSound"sv,
+   "SCGunnerGetInSound"sv,
+   "SCGunnerGetOutSound"sv,
+   "SCGunnerSteadySound"sv,
+   "ScopeDisplayAmbient"sv,
+   "ScopeDisplayZoomIn"sv,
+   "ScopeDisplayZoomOut"sv,
+   "ScopeTexture"sv,
+   "ScoreForMedalsType"sv,
+   "Scout"sv,
+   "SCPassengerGetInSound"sv,
+   "SCPassengerGetOutSound"sv,
+   "SCPassengerMoveOutSound"sv,
+   "SCPassengerStopSound"sv,
+   "screaming"sv,
+   "screen_template"sv,
+   "screenshot"sv,
+   "SCResponseNosirSound"sv,
+   "SCResponseYessirSound"sv,
+   "ScrollRate"sv,
+   "ScrollSpeed"sv,
+   "SecondaryOrdnance"sv,
+   "SecondaryOrdnanceName"sv,
+   "SecondaryOrdnancePeriod"sv,
+   "SecondaryStance"sv,
+   "SecondaryWeapon"sv,
+   "Seconds"sv,
+   "Sector"sv,
+   "Sector1"sv,
+   "Sector2"sv,
+   "Seed"sv,
+   "Segment"sv,
+   "SegmentList"sv,
+   "selected"sv,
+   "self"sv,
+   "SelfDestructSoundPitch"sv,
+   "SelfText"sv,
+   "session"sv,
+   "SetAltitude"sv,
+   "Shadow"sv,
+   "ShadowCaster"sv,
+   "ShadowColor"sv,
+   "Shake"sv,
+   "ShakeLength"sv,
+   "ShakeRadius"sv,
+   "ShakeRadiusInner"sv,
+   "ShakeRadiusOuter"sv,
+   "ShakeScale"sv,
+   "shell"sv,
+   "shell_keyboard_backspace"sv,
+   "shell_keyboard_key"sv,
+   "shell_menu_accept"sv,
+   "shell_menu_cancel"sv,
+   "shell_menu_enter"sv,
+   "shell_menu_error"sv,
+   "shell_menu_exit"sv,
+   "shell_movies"sv,
+   "shell_music"sv,
+   "shell_select_change"sv,
+   "shell_subtitles"sv,
+   "shellfx"sv,
+   "shellmovies"sv,
+   "shellmusic"sv,
+   "shield"sv,
+   "ShieldEffect"sv,
+   "ShieldOffset"sv,
+   "ShieldOffSound"sv,
+   "ShieldRadius"sv,
+   "ShieldScale"sv,
+   "ShieldSound"sv,
+   "ShockFadeInTime"sv,
+   "ShockFadeOutGain"sv,
+   "ShockFadeOutTime"sv,
+   "ShockSound"sv,
+   "ShotDelay"sv,
+   "ShotElevate"sv,
+   "ShotPatternCount"sv,
+   "ShotPatternPitchYaw"sv,
+   "ShotPerSalvo"sv,
+   "ShotsPerSalvo"sv,
+   "ShowAllServers"sv,
+   "ShowAllSessions"sv,
+   "showintro"sv,
+   "showlegal"sv,
+   "sideselect"sv,
+   "SIMPLE"sv,
+   "SingleDirection"sv,
+   "Size"sv,
+   "SkeletonLowRes"sv,
+   "SkeletonName"sv,
+   "SkeletonRootScale"sv,
+   "SkeletonRootScaleLowRes"sv,
+   "skill"sv,
+   "SkinnyFactor"sv,
+   "SkyDomeDarkenFactor"sv,
+   "SkyInfo"sv,
+   "SkyObject"sv,
+   "small_muzzle_flash"sv,
+   "SmallBan"sv,
+   "SmashParkedFlyers"sv,
+   "smoke_billow"sv,
+   "SmolderBone"sv,
+   "SmolderDamageRate"sv,
+   "SmolderEffect"sv,
+   "SmolderEffectTimer"sv,
+   "SmolderVanishDeath"sv,
+   "SndHeroDefeated"sv,
+   "SndHeroKiller"sv,
+   "SndHeroSelectable"sv,
+   "SndHeroSpawned"sv,
+   "SniperScope"sv,
+   "Softness"sv,
+   "SoftnessParam"sv,
+   "soldier"sv,
+   "SoldierAmmo"sv,
+   "SoldierAnimation"sv,
+   "SoldierAnnoucement"sv,
+   "SoldierAttachBone"sv,
+   "SoldierBan"sv,
+   "SoldierCollision"sv,
+   "SoldierCollisionPrim"sv,
+   "SoldierEnergy"sv,
+   "SoldierHealth"sv,
+   "SoldierMusic"sv,
+   "Sound"sv,
+   "SoundAmbienceStatic"sv,
+   "SoundAmbienceStreaming"sv,
+   "SoundCrack"sv,
+   "soundfx"sv,
+   "soundlayered"sv,
+   "SoundName"sv,
+   "SoundOffset"sv,
+   "soundparameterized"sv,
+   "SoundPitchDev"sv,
+   "SoundProperties"sv,
+   "SoundProperty"sv,
+   "SoundStream"sv,
+   "SoundStreamProperties"sv,
+   "SoundSubCrack"sv,
+   "soundwarning"sv,
+   "SoundWhenMoving"sv,
+   "spa_cor"sv,
+   "spa_dag"sv,
+   "spa_end"sv,
+   "spa_fel"sv,
+   "spa_geo"sv,
+   "spa_hot"sv,
+   "spa_kam"sv,
+   "spa_kas"sv,
+   "spa_mus"sv,
+   "spa_myg"sv,
+   "spa_nab"sv,
+   "spa_pol"sv,
+   "spa_sfx_blender"sv,
+   "spa_sfx_blender_destruct1"sv,
+   "spa_sfx_blender_destruct2"sv,
+   "spa_sfx_blender_destruct3"sv,
+   "spa_sfx_blender_destruct4"sv,
+   "spa_sfx_blender_destruct5"sv,
+   "spa_sfx_blender_destruct6"sv,
+   "spa_sfx_frigate_exp_1"sv,
+   "spa_sfx_frigate_exp_2"sv,
+   "spa_sfx_frigate_exp_3"sv,
+   "spa_sfx_frigate_exp_4"sv,
+   "spa_sfx_frigate_exp_5"sv,
+   "spa_sfx_lightningballs"sv,
+   "spa_sfx_skydomeexplosions"sv,
+   "spa_sfx_turret_exp"sv,
+   "spa_spa"sv,
+   "spa_steamgrate"sv,
+   "spa_tat"sv,
+   "spa_uta"sv,
+   "spa_yav"sv,
+   "spa1"sv,
+   "spa1_Assault Paths"sv,
+   "spa1_asteroids"sv,
+   "spa1_bomber paths"sv,
+   "spa1_campaign_flyers"sv,
+   "spa1_campaign_turrets"sv,
+   "spa1_capitalships"sv,
+   "spa1_CTF"sv,
+   "spa1_ctf_paths"sv,
+   "spa1_Flight Paths"sv,
+   "spa1_movies"sv,
+   "spa1_mp_flyers"sv,
+   "spa1_mp_turrets"sv,
+   "spa1_rumbleregions"sv,
+   "spa1_sfx_all_rebelcruiserengine_exp"sv,
+   "spa1_sfx_asteroid_shatter"sv,
+   "spa1_sfx_engine_exp_destruct2"sv,
+   "spa1_sfx_junkengine_exp"sv,
+   "spa1_sfx_lasertrail"sv,
+   "spa1_sfx_shipflames_lg"sv,
+   "spa1_sfx_weap_laser_exp_lg"sv,
+   "spa1_Shadows"sv,
+   "spa1_soundregions"sv,
+   "spa1_soundspaces"sv,
+   "spa1_soundtriggerregions"sv,
+   "spa1_swingassault"sv,
+   "spa1_transports"sv,
+   "spa1_turrets"sv,
+   "spa2"sv,
+   "spa2_Campaign"sv,
+   "spa2_capitalships"sv,
+   "spa2_cispaths"sv,
+   "spa2_design"sv,
+   "spa2_fighters"sv,
+   "spa2_flightschool"sv,
+   "spa2_movies"sv,
+   "spa2_reppaths"sv,
+   "spa2_rumbles"sv,
+   "spa2_sfx_cis_fedcruiser_descruct1_2_exp"sv,
+   "spa2_sfx_cis_fedcruiser_descruct1a"sv,
+   "spa2_sfx_cis_fedcruiser_descruct1b"sv,
+   "spa2_sfx_cis_fedcruiser_descruct1c"sv,
+   "spa2_sfx_cis_fedcruiser_descruct1d"sv,
+   "spa2_sfx_cis_fedcruiser_descruct2a"sv,
+   "spa2_sfx_cis_fedcruiser_descruct2b"sv,
+   "spa2_sfx_cis_fedcruiser_descruct2c"sv,
+   "spa2_sfx_cis_fedcruiser_descruct2d"sv,
+   "spa2_sfx_prop_antenna_descruct_exp"sv,
+   "spa2_sfx_prop_antenna_descruct1a"sv,
+   "spa2_sfx_prop_antenna_descruct1b"sv,
+   "spa2_sfx_prop_antenna_descruct1c"sv,
+   "spa2_sfx_prop_antenna_descruct1d"sv,
+   "spa2_Shadows"sv,
+   "spa2_soundregions"sv,
+   "spa2_soundspace"sv,
+   "spa2_turrets"sv,
+   "SPA3"sv,
+   "spa3_2_flag_ctf"sv,
+   "spa3_Assaultpaths"sv,
+   "spa3_c_gameplay"sv,
+   "spa3_C_objects"sv,
+   "spa3_c_ships"sv,
+   "spa3_c_turrets"sv,
+   "spa3_cisfrigate"sv,
+   "spa3_flightpaths"sv,
+   "spa3_hangarwars"sv,
+   "spa3_movies"sv,
+   "spa3_obj_turrets"sv,
+   "spa3_rumbles"sv,
+   "spa3_shadows"sv,
+   "spa3_SoundEmitters"sv,
+   "spa3_soundregions"sv,
+   "spa3_soundspaces"sv,
+   "spa3_swing turrets"sv,
+   "spa3_swing_camp"sv,
+   "spa3_swing_obj"sv,
+   "spa4"sv,
+   "spa4_asteroids"sv,
+   "spa4_c_cis-ships"sv,
+   "spa4_c_gameplay"sv,
+   "spa4_c_ships"sv,
+   "spa4_extra"sv,
+   "spa4_flightpaths"sv,
+   "spa4_movies"sv,
+   "spa4_rumbles"sv,
+   "spa4_shadows"sv,
+   "spa4_soundregions"sv,
+   "spa4_soundspaces"sv,
+   "spa5"sv,
+   "spa5_C_Gameplay"sv,
+   "spa5_c_ships"sv,
+   "spa5_flightpaths"sv,
+   "spa5_turrets"sv,
+   "SPA6"sv,
+   "spa6_1flag_flags"sv,
+   "spa6_1flag_paths"sv,
+   "spa6_capitalships"sv,
+   "spa6_cmn_hangar"sv,
+   "spa6_cmn_paths"sv,
+   "spa6_ctf_flags"sv,
+   "spa6_ctf_spawn"sv,
+   "spa6_frigates"sv,
+   "spa6_obj_hangar"sv,
+   "spa6_obj_paths"sv,
+   "spa6_obj_spawn"sv,
+   "spa6_shadows"sv,
+   "spa6_soundregions"sv,
+   "spa6_soundspaces"sv,
+   "spa7"sv,
+   "spa7_1flag_flags"sv,
+   "spa7_1flag_paths"sv,
+   "spa7_asteroids"sv,
+   "spa7_capitalships"sv,
+   "spa7_cmn_hangar"sv,
+   "spa7_cmn_paths"sv,
+   "spa7_ctf_flags"sv,
+   "spa7_ctf_spawn"sv,
+   "spa7_frigates"sv,
+   "spa7_obj_hangar"sv,
+   "spa7_obj_paths"sv,
+   "spa7_obj_spawn"sv,
+   "spa7_Shadows"sv,
+   "spa7_SoundRegions"sv,
+   "spa7_SoundSpace"sv,
+   "spa8"sv,
+   "spa8_1flag_flags"sv,
+   "spa8_1flag_paths"sv,
+   "spa8_ass_hangar"sv,
+   "spa8_ass_paths"sv,
+   "spa8_ass_spawn"sv,
+   "spa8_capitalships"sv,
+   "spa8_cmn_hangar"sv,
+   "spa8_cmn_paths"sv,
+   "spa8_ctf_flags"sv,
+   "spa8_ctf_spawn"sv,
+   "spa8_frigates"sv,
+   "spa8_Shadows"sv,
+   "spa8_SoundRegions"sv,
+   "spa8_soundspace"sv,
+   "spa9"sv,
+   "spa9_1flag_flags"sv,
+   "spa9_1flag_paths"sv,
+   "spa9_ass_hangar"sv,
+   "spa9_ass_paths"sv,
+   "spa9_ass_spawn"sv,
+   "spa9_asteroids"sv,
+   "spa9_capitalships"sv,
+   "spa9_cmn_hangar"sv,
+   "spa9_cmn_paths"sv,
+   "spa9_ctf_flags"sv,
+   "spa9_ctf_spawn"sv,
+   "spa9_eli_spawn"sv,
+   "spa9_Fighters"sv,
+   "spa9_Frigates"sv,
+   "spa9_shadows"sv,
+   "spa9_soundregions"sv,
+   "spa9_SoundSpace"sv,
+   "Space"sv,
+   "spaceassaultscorelimit"sv,
+   "Spark"sv,
+   "SparkLength"sv,
+   "spawn"sv,
+   "SpawnCount"sv,
+   "SpawnDelay"sv,
+   "SpawnDisplayBack"sv,
+   "SpawnDisplaySpawnPointAccept"sv,
+   "SpawnDisplaySpawnPointChange"sv,
+   "SpawnDisplayUnitAccept"sv,
+   "SpawnDisplayUnitChange"sv,
+   "SpawnDistance"sv,
+   "Spawner"sv,
+   "SpawnPath"sv,
+   "SpawnPointCount"sv,
+   "SpawnPointLocation"sv,
+   "SpawnPointNames"sv,
+   "SpawnRegion"sv,
+   "SpawnSound"sv,
+   "SpawnTime"sv,
+   "Special"sv,
+   "SpeckleAmbientColor"sv,
+   "SpeckleCoordShift"sv,
+   "SpeckleScrollSpeed"sv,
+   "SpeckleSpecularColor"sv,
+   "SpeckleTextures"sv,
+   "SpeckleTile"sv,
+   "SpecularCaster"sv,
+   "SpecularColor"sv,
+   "SpecularMaskScrollSpeed"sv,
+   "SpecularMaskTextures"sv,
+   "SpecularMaskTile"sv,
+   "Speed"sv,
+   "SpeedForInvisibilityMax"sv,
+   "SpeedForInvisibilityMin"sv,
+   "SpeedParticleMaxLength"sv,
+   "SpeedParticleMinLength"sv,
+   "Sphere"sv,
+   "SpikeColor"sv,
+   "SpikeSize"sv,
+   "SpinRate"sv,
+   "SplatInfo"sv,
+   "SplineType"sv,
+   "split"sv,
+   "split2"sv,
+   "split4"sv,
+   "SPLITCROUCH"sv,
+   "SPLITCROUCHZOOM"sv,
+   "SplitMode"sv,
+   "SplitOptions"sv,
+   "SPLITPRONE"sv,
+   "SPLITPRONEZOOM"sv,
+   "splitscreen"sv,
+   "SPLITSPRINT"sv,
+   "SPLITSTAND"sv,
+   "SPLITSTANDZOOM"sv,
+   "Spot"sv,
+   "SpotInnerConeAngle"sv,
+   "SpotOuterConeAngle"sv,
+   "SpottedVO"sv,
+   "Spread"sv,
+   "SpreadFactor"sv,
+   "SpreadLimit"sv,
+   "SpreadPerShot"sv,
+   "SpreadRadius"sv,
+   "SpreadRecover"sv,
+   "SpreadRecoverRate"sv,
+   "SpreadThreshold"sv,
+   "sprint"sv,
+   "SprintAccelerateTime"sv,
+   "SprintTimeForBowling"sv,
+   "SpritesInfo"sv,
+   "SquadronDistance"sv,
+   "SquadronFormation"sv,
+   "SquadronMaxAngle"sv,
+   "SquadronMemberID"sv,
+   "Squat"sv,
+   "SquatSound"sv,
+   "stand"sv,
+   "stand_attack1a"sv,
+   "stand_attack1a_end"sv,
+   "stand_attack1b"sv,
+   "stand_attack1b_end"sv,
+   "stand_attack1c"sv,
+   "StandAimSpread"sv,
+   "StandMoveSpread"sv,
+   "StandSound"sv,
+   "StandStillSpread"sv,
+   "STANDZOOM"sv,
+   "star"sv,
+   "starblue"sv,
+   "stars"sv,
+   "StarsInfo"sv,
+   "StartDelay"sv,
+   "StarTexture"sv,
+   "StartMovementSound"sv,
+   "StartMoveX"sv,
+   "StartMoveY"sv,
+   "StartMoveZ"sv,
+   "StartRotation"sv,
+   "StartTimerOnContact"sv,
+   "StartX"sv,
+   "StartY"sv,
+   "StartZ"sv,
+   "State"sv,
+   "STATIC"sv,
+   "StatusTexture"sv,
+   "SteerAtStrafeLimit"sv,
+   "SteerAtYawLimit"sv,
+   "SteerTowardAimFactor"sv,
+   "SteerTowardAimRate"sv,
+   "StickAll"sv,
+   "StickAnimal"sv,
+   "StickBuilding"sv,
+   "StickBuildingDead"sv,
+   "StickBuildingUnbuilt"sv,
+   "StickDroid"sv,
+   "StickPerson"sv,
+   "StickTerrain"sv,
+   "StickVehicle"sv,
+   "sticky"sv,
+   "Stiffness"sv,
+   "StompDecal"sv,
+   "StompDecalSize"sv,
+   "StompDetectionType"sv,
+   "StompEffect"sv,
+   "StompRumbleHeavy"sv,
+   "StompRumbleHeavyDuration"sv,
+   "StompRumbleLight"sv,
+   "StompRumbleLightDuration"sv,
+   "StompThreshold"sv,
+   "StopMovementSound"sv,
+   "StoppedTurnSpeed"sv,
+   "StrafeFactor"sv,
+   "StrafeRollAngle"sv,
+   "StrafeSpeed"sv,
+   "Strategic_Filter1"sv,
+   "Strategic_Filter2"sv,
+   "Strategic_Filter3"sv,
+   "Strategic_Filter4"sv,
+   "Strategic_Filter5"sv,
+   "Strategic_Filter6"sv,
+   "Streak"sv,
+   "StreakLength"sv,
+   "Stream"sv,
+   "stretchconstraint"sv,
+   "StrikeOrdnance"sv,
+   "StrikeOrdnanceName"sv,
+   "StringAngle"sv,
+   "StringGrids"sv,
+   "Strobe"sv,
+   "StrobeFade"sv,
+   "StrobeRandom"sv,
+   "Stun"sv,
+   "StunAnimation"sv,
+   "StunTime"sv,
+   "Subtitle"sv,
+   "SubtitleList"sv,
+   "SunColor"sv,
+   "SunDirection"sv,
+   "SunFlare"sv,
+   "SunInfo"sv,
+   "SunlightFadeFactor"sv,
+   "Support"sv,
+   "SuppressRadius"sv,
+   "SuspensionLeftArmNodeName"sv,
+   "SuspensionMaxOffset"sv,
+   "SuspensionMidOffset"sv,
+   "SuspensionNodeName"sv,
+   "SuspensionRightArmNodeName"sv,
+   "SwingAmount"sv,
+   "SwingSpeed"sv,
+   "SwingTime"sv,
+   "SWIPE_BT"sv,
+   "SWIPE_LR"sv,
+   "SWIPE_RAND"sv,
+   "SWIPE_RL"sv,
+   "SWIPE_TB"sv,
+   "SwitchClassRadius"sv,
+   "SwitchImmediately"sv,
+   "Synchronize"sv,
+   "SyncIfOvertime"sv,
+   "SyncType"sv,
+   "tactical_template"sv,
+   "TailPosition"sv,
+   "TakeoffHeight"sv,
+   "TakeoffSound"sv,
+   "TakeoffSpeed"sv,
+   "TakeoffTime"sv,
+   "tan_movies"sv,
+   "tan_sfx_console_damage1"sv,
+   "tan_sfx_console_damage2"sv,
+   "tan_sfx_console_damage3"sv,
+   "tan1"sv,
+   "tan1_1flag"sv,
+   "tan1_conquest"sv,
+   "tan1_CTF"sv,
+   "tan1_Design01"sv,
+   "tan1_NewCompProps"sv,
+   "tan1_NewObjective"sv,
+   "tan1_Props"sv,
+   "tan1_reflections"sv,
+   "tan1_Rumble"sv,
+   "tan1_sfx_turbine"sv,
+   "tan1_sfx_turbine_damage1"sv,
+   "tan1_sfx_turbine_damage2"sv,
+   "tan1_sfx_turbine_damage3"sv,
+   "tan1_shadows"sv,
+   "tan1_SoundEmitters"sv,
+   "tan1_SoundRegions"sv,
+   "tan1_SoundSpaces"sv,
+   "tan1tran1"sv,
+   "tanmon01"sv,
+   "tanmon02"sv,
+   "Tap"sv,
+   "TapHold"sv,
+   "TapPress"sv,
+   "Target"sv,
+   "TargetableCollision"sv,
+   "TargetableCollisionPrim"sv,
+   "TargetAll"sv,
+   "TargetAnimal"sv,
+   "TargetBuilding"sv,
+   "TargetBuildingDead"sv,
+   "TargetBuildingUnbuilt"sv,
+   "TargetDroid"sv,
+   "TargetEnemy"sv,
+   "TargetFireColor"sv,
+   "TargetFriendly"sv,
+   "TargetHealthBelow25"sv,
+   "TargetLarge"sv,
+   "TargetLock"sv,
+   "TargetLockMaxDistance"sv,
+   "TargetLockMaxDistanceLose"sv,
+   "TargetMine"sv,
+   "TargetNeutral"sv,
+   "TargetPerson"sv,
+   "TargetPointOffset"sv,
+   "TargetPointOffsetCrouch"sv,
+   "TargetPointOffsetStand"sv,
+   "TargetSmall"sv,
+   "TargetSpawn"sv,
+   "TargetVehicle"sv,
+   "tat2"sv,
+   "tat2_1flag"sv,
+   "tat2_Collision"sv,
+   "tat2_con"sv,
+   "tat2_ctf"sv,
+   "tat2_Design"sv,
+   "tat2_hunt"sv,
+   "tat2_soundregions"sv,
+   "tat2_tdm"sv,
+   "tat2_turrets"sv,
+   "tat3"sv,
+   "tat3_1flag"sv,
+   "tat3_con"sv,
+   "tat3_ctf"sv,
+   "tat3_Design"sv,
+   "tat3_hunt"sv,
+   "tat3_Shadows"sv,
+   "tat3_SoundEmitters"sv,
+   "tat3_soundregions"sv,
+   "tat3_SoundSpaces"sv,
+   "tat3_white_light01"sv,
+   "Team"sv,
+   "team_bonus_advanced_blasters"sv,
+   "team_bonus_autoturrets"sv,
+   "team_bonus_bacta_tanks"sv,
+   "team_bonus_combat_shielding"sv,
+   "team_bonus_energy_boost"sv,
+   "team_bonus_garrison"sv,
+   "team_bonus_garrison_used_by"sv,
+   "team_bonus_leader"sv,
+   "team_bonus_sabotage"sv,
+   "team_bonus_sensor_array"sv,
+   "team_bonus_supplies"sv,
+   "TeamModel"sv,
+   "TeamModelRotationSpeed"sv,
+   "TEMP_AnimationSpeed"sv,
+   "TEMP_Type"sv,
+   "TentacleCollType"sv,
+   "terrain_foley"sv,
+   "TerrainBumpSpecularTexture"sv,
+   "TerrainBumpTexture"sv,
+   "TerrainCollision"sv,
+   "TerrainCollisionPrim"sv,
+   "TerrainColorDarkening"sv,
+   "TerrainLeft"sv,
+   "TerrainRight"sv,
+   "Tessellation"sv,
+   "test1"sv,
+   "test1_Layer000"sv,
+   "TexCoords"sv,
+   "Text"sv,
+   "TextAlignment"sv,
+   "TextBox"sv,
+   "TextBreak"sv,
+   "TextCharacterSpacing"sv,
+   "TextClip"sv,
+   "TextFont"sv,
+   "TextHAlignment"sv,
+   "TextScale"sv,
+   "TextStyle"sv,
+   "TextTabSpacing"sv,
+   "Texture"sv,
+   "TextureJitterSpeed"sv,
+   "TextureScale"sv,
+   "TextureSize"sv,
+   "TextureSpeed"sv,
+   "TextureVelocity"sv,
+   "TextVAlignment"sv,
+   "ThirdPersonFOV"sv,
+   "threats"sv,
+   "Threshold"sv,
+   "throttle"sv,
+   "ThrowAnimation"sv,
+   "Thrust"sv,
+   "ThrustAngle"sv,
+   "ThrustAngleToStop"sv,
+   "ThrustAngleToStrafe"sv,
+   "ThrustAngleToTurn"sv,
+   "ThrustAttachOffset"sv,
+   "ThrustAttachPoint"sv,
+   "ThrustEffect"sv,
+   "ThrustEffectMaxScale"sv,
+   "ThrustEffectMinScale"sv,
+   "ThrustEffectScaleStart"sv,
+   "ThrustFactor"sv,
+   "ThrustPitchAngle"sv,
+   "TickSound"sv,
+   "TickSoundPitch"sv,
+   "Tile"sv,
+   "TileSize"sv,
+   "TileUV"sv,
+   "TiltValue"sv,
+   "Time"sv,
+   "TimeAtMaxCharge"sv,
+   "TimeBetweenFlashesMinMax"sv,
+   "TimeBetweenSubFlashesMinMax"sv,
+   "TimeEnd"sv,
+   "TimeInPosture"sv,
+   "TimePerFrame"sv,
+   "TimeRequiredToEject"sv,
+   "TimeStart"sv,
+   "TimeTilReboard"sv,
+   "TimeToChange"sv,
+   "TipsBoxTexture"sv,
+   "TipsColor"sv,
+   "TipsPrefix"sv,
+   "TipsTime"sv,
+   "Toggle"sv,
+   "toggledisplay"sv,
+   "Top"sv,
+   "TopColor"sv,
+   "TopDirectionalAmbientColor"sv,
+   "TopRange"sv,
+   "torchflame"sv,
+   "Torso"sv,
+   "TotalFrames"sv,
+   "towcable"sv,
+   "TowCableCollision"sv,
+   "towcableweapon"sv,
+   "tps"sv,
+   "TrackCenter"sv,
+   "TrackDeathOnAttach"sv,
+   "TrackingSound"sv,
+   "TrackOffset"sv,
+   "TrackUseRoot"sv,
+   "Traction"sv,
+   "TrailEffect"sv,
+   "training"sv,
+   "training1"sv,
+   "TrakCenter"sv,
+   "Transformer"sv,
+   "TransformNameMesh"sv,
+   "TransformNumberColor"sv,
+   "TransformNumberVector3"sv,
+   "Transition"sv,
+   "transition_template"sv,
+   "TransitionTime"sv,
+   "TransmitRange"sv,
+   "transparent"sv,
+   "TransparentType"sv,
+   "Transport"sv,
+   "trap"sv,
+   "TreeLine"sv,
+   "TrickFlipCameraDetach"sv,
+   "TrickFlipSpeed"sv,
+   "TrickRollSpeed"sv,
+   "TrickSideRollCameraDetach"sv,
+   "TrickSideRollStrafeSpeed"sv,
+   "TrickSound"sv,
+   "TrickTimeMid"sv,
+   "TrickTimeRange"sv,
+   "TriggerAll"sv,
+   "TriggerAnimation"sv,
+   "TriggerCollision"sv,
+   "TriggerContact"sv,
+   "TriggerNode"sv,
+   "TriggerOffset"sv,
+   "TriggerRadius"sv,
+   "TriggerSingle"sv,
+   "TriggerSound"sv,
+   "TriggerTeam"sv,
+   "Trooper"sv,
+   "ttachEffect"sv,
+   "tumble"sv,
+   "TurnBuildupMultiplier"sv,
+   "TurnFactor"sv,
+   "TurnFilter"sv,
+   "TurnFilterDecel"sv,
+   "TurningOffSound"sv,
+   "TurnOffLightsaber"sv,
+   "TurnOffSound"sv,
+   "TurnOffTime"sv,
+   "TurnOnDuration"sv,
+   "TurnOnSound"sv,
+   "TurnOnTime"sv,
+   "TurnRate"sv,
+   "TurnThreshold"sv,
+   "Turret"sv,
+   "turret_template"sv,
+   "TURRET1"sv,
+   "TURRET2"sv,
+   "TURRET3"sv,
+   "TURRET4"sv,
+   "TURRET5"sv,
+   "TURRET6"sv,
+   "TURRET7"sv,
+   "TURRET8"sv,
+   "TurretActivateSound"sv,
+   "TurretAmbientSound"sv,
+   "TurretDeactivateSound"sv,
+   "TurretMoveSound"sv,
+   "TurretMoveSoundStartEndPitch"sv,
+   "TurretMoveSoundStartEndTime"sv,
+   "TurretNodeName"sv,
+   "TurretPath"sv,
+   "TurretPitchoundPitch"sv,
+   "TurretPitchSound"sv,
+   "TurretPitchSoundPitch"sv,
+   "TURRETSECTION"sv,
+   "TurretStartSound"sv,
+   "TurretStopSound"sv,
+   "TurretYawSound"sv,
+   "TurretYawSoundPitch"sv,
+   "TwinkleFactor"sv,
+   "TwinkleFrequency"sv,
+   "Type"sv,
+   "TypeCount"sv,
+   "ui_cancel"sv,
+   "ui_keyboardtype"sv,
+   "ui_load_lp"sv,
+   "ui_menuBack"sv,
+   "ui_menuMove"sv,
+   "ui_menuSelectionToggle"sv,
+   "ui_planetzoom"sv,
+   "UnbuiltGeometryName"sv,
+   "UnbuiltHoloOdf"sv,
+   "UnderwaterColor"sv,
+   "unitName"sv,
+   "UnitType"sv,
+   "unlimitedammo"sv,
+   "UnrollTime"sv,
+   "Until"sv,
+   "Up"sv,
+   "UprightLowResModel"sv,
+   "UprightWaterDamageHeight"sv,
+   "UseChangeColor"sv,
+   "UseCollision"sv,
+   "UseDirectionalDeaths"sv,
+   "UseDirectionalJumps"sv,
+   "UseHSV"sv,
+   "UseTexture"sv,
+   "UseVCollForFlyers"sv,
+   "uta_bldg_tower_damage1"sv,
+   "uta_bldg_tower_damage2"sv,
+   "uta_bldg_tower_damage3"sv,
+   "uta_bldg_tower_damage4"sv,
+   "uta_bldg_tower_damage5"sv,
+   "uta_bldg_tower_damage6"sv,
+   "uta_movies"sv,
+   "uta1"sv,
+   "uta1_1flag"sv,
+   "uta1_bldg_lizardpen"sv,
+   "uta1_Campaign"sv,
+   "uta1_Conquest"sv,
+   "uta1_CTF2flag"sv,
+   "uta1_Droids"sv,
+   "uta1_Light_RG"sv,
+   "uta1_Pens"sv,
+   "uta1_post_spot"sv,
+   "uta1_props"sv,
+   "uta1_Rumbles"sv,
+   "uta1_sfx_bldg_tower_exp"sv,
+   "uta1_SoundRegions"sv,
+   "uta1_SoundSpaces"sv,
+   "uta1_steamgrate"sv,
+   "uta1_TDM"sv,
+   "uta1_Vehicles"sv,
+   "uta1tran1"sv,
+   "utamon01"sv,
+   "utamon02"sv,
+   "VAlign"sv,
+   "Value"sv,
+   "Value_ATK_Alliance"sv,
+   "Value_ATK_CIS"sv,
+   "Value_ATK_Empire"sv,
+   "Value_ATK_Locals"sv,
+   "Value_ATK_Republic"sv,
+   "Value_DEF_Alliance"sv,
+   "Value_DEF_CIS"sv,
+   "Value_DEF_Empire"sv,
+   "Value_DEF_Locals"sv,
+   "Value_DEF_Republic"sv,
+   "ValueBleed"sv,
+   "ValueBleed_Alliance"sv,
+   "ValueBleed_CIS"sv,
+   "ValueBleed_Empire"sv,
+   "ValueBleed_Locals"sv,
+   "ValueBleed_Neutral"sv,
+   "ValueBleed_Republic"sv,
+   "VarianceX"sv,
+   "VarianceY"sv,
+   "VarianceZ"sv,
+   "vBarrelNodeName"sv,
+   "vcenter"sv,
+   "veh_weapon_template"sv,
+   "Vehicle"sv,
+   "vehicle_eng_hi-mid_template"sv,
+   "vehicle_eng_low_template"sv,
+   "vehicle_foley_template"sv,
+   "vehicle_template"sv,
+   "VehicleAmbientColor"sv,
+   "VehicleAmmo"sv,
+   "vehiclecollision"sv,
+   "vehiclecollisiononly"sv,
+   "VehicleCollisionPrim"sv,
+   "VehicleCollisionSound"sv,
+   "VehicleEnergy"sv,
+   "VehicleHealth"sv,
+   "vehiclepad"sv,
+   "VehiclePosition"sv,
+   "VehicleScale"sv,
+   "VehicleSeating"sv,
+   "vehicleself"sv,
+   "vehiclespawn"sv,
+   "VehicleType"sv,
+   "Velocity"sv,
+   "VelocityChangeRate"sv,
+   "VelocityDamp"sv,
+   "VelocityFromStrafe"sv,
+   "VelocityFromThrust"sv,
+   "VelocityRange"sv,
+   "VelocityScale"sv,
+   "VelocitySpring"sv,
+   "VelocityX"sv,
+   "VelocityXZ"sv,
+   "VelocityXZAngle"sv,
+   "VelocityY"sv,
+   "VelocityYAbs"sv,
+   "VelocityZ"sv,
+   "Version"sv,
+   "VerticalSpread"sv,
+   "ViewAngleFactor"sv,
+   "Viewport"sv,
+   "Viewport0Position"sv,
+   "Viewport0UseSafezone"sv,
+   "Viewport1Position"sv,
+   "Viewport1UseSafezone"sv,
+   "Viewport2Position"sv,
+   "Viewport2UseSafezone"sv,
+   "Viewport3Position"sv,
+   "Viewport3UseSafezone"sv,
+   "Viewports"sv,
+   "vil"sv,
+   "villain"sv,
+   "villains"sv,
+   "Vine"sv,
+   "VineLength"sv,
+   "VineSpread"sv,
+   "Virtual"sv,
+   "VisibilityRange"sv,
+   "VisibleRadius"sv,
+   "VO_All_AllCapture"sv,
+   "VO_All_AllInDispute"sv,
+   "VO_All_AllInfo"sv,
+   "VO_All_AllLost"sv,
+   "VO_All_AllSaved"sv,
+   "VO_All_ImpCapture"sv,
+   "VO_All_ImpInDispute"sv,
+   "VO_All_ImpInfo"sv,
+   "VO_All_ImpLost"sv,
+   "VO_All_ImpSaved"sv,
+   "VO_CIS_CISCapture"sv,
+   "VO_CIS_CISInDispute"sv,
+   "VO_CIS_CISInfo"sv,
+   "VO_CIS_CISLost"sv,
+   "VO_CIS_CISSaved"sv,
+   "VO_CIS_RepCapture"sv,
+   "VO_CIS_RepInDispute"sv,
+   "VO_CIS_RepInfo"sv,
+   "VO_CIS_RepLost"sv,
+   "VO_CIS_RepSaved"sv,
+   "VO_Imp_AllCapture"sv,
+   "VO_Imp_AllInDispute"sv,
+   "VO_Imp_AllInfo"sv,
+   "VO_Imp_AllLost"sv,
+   "VO_Imp_AllSaved"sv,
+   "VO_Imp_ImpCapture"sv,
+   "VO_Imp_ImpInDispute"sv,
+   "VO_Imp_ImpInfo"sv,
+   "VO_Imp_ImpLost"sv,
+   "VO_Imp_ImpSaved"sv,
+   "VO_Rep_CISCapture"sv,
+   "VO_Rep_CISInDispute"sv,
+   "VO_Rep_CISInfo"sv,
+   "VO_Rep_CISLost"sv,
+   "VO_Rep_CISSaved"sv,
+   "VO_Rep_RepCapture"sv,
+   "VO_Rep_RepInDispute"sv,
+   "VO_Rep_RepInfo"sv,
+   "VO_Rep_RepLost"sv,
+   "VO_Rep_RepSaved"sv,
+   "vo_template"sv,
+   "Voice"sv,
+   "VoiceChat"sv,
+   "voicemode"sv,
+   "voiceover"sv,
+   "VORadius"sv,
+   "Vortex"sv,
+   "VOSound"sv,
+   "VOUnitType"sv,
+   "WaitMax"sv,
+   "WaitMin"sv,
+   "WakeEffect"sv,
+   "WakeWaterSplashEffect"sv,
+   "walker"sv,
+   "walkerdroid"sv,
+   "WalkerLegPair"sv,
+   "WalkerOrientRoll"sv,
+   "WALKERSECTION"sv,
+   "walkerstomp"sv,
+   "WalkerWidth"sv,
+   "WarmUpSound"sv,
+   "WarmUpSoundFadeInTime"sv,
+   "WarmUpSoundFadeOutTime"sv,
+   "WarmUpSoundStartPitch"sv,
+   "WarmUpTime"sv,
+   "water"sv,
+   "water_foley"sv,
+   "WaterDamageAmount"sv,
+   "WaterDamageInterval"sv,
+   "WaterEffect"sv,
+   "waterfall_bottom_center"sv,
+   "waterfall_bottom_side"sv,
+   "WaterInfo"sv,
+   "WaterRingColor"sv,
+   "WaterSplashColor"sv,
+   "WaterSplashEffect"sv,
+   "WaterWadingSound"sv,
+   "WaterWakeColor"sv,
+   "WaverRate"sv,
+   "WaverTurn"sv,
+   "Weapon"sv,
+   "weapon_template"sv,
+   "WeaponAmmo"sv,
+   "WeaponAmmo1"sv,
+   "WeaponAmmo2"sv,
+   "WeaponAmmo3"sv,
+   "WeaponAmmo4"sv,
+   "WeaponChange"sv,
+   "WeaponChangeSound"sv,
+   "WeaponChannel"sv,
+   "WeaponChannel1"sv,
+   "WeaponChannel2"sv,
+   "WeaponChannel3"sv,
+   "WeaponChannel4"sv,
+   "WeaponName"sv,
+   "WeaponName1"sv,
+   "WeaponName2"sv,
+   "WeaponName3"sv,
+   "WeaponName4"sv,
+   "WeaponSection"sv,
+   "WeaponShareAmmo"sv,
+   "WeaponShareAmmo1"sv,
+   "WeaponShareAmmo2"sv,
+   "WeaponShareAmmo3"sv,
+   "WeaponShareAmmo4"sv,
+   "WeaponShareHeat"sv,
+   "WeaponShareHeat1"sv,
+   "WeaponShareHeat2"sv,
+   "WeaponShareHeat3"sv,
+   "WeaponShareHeat4"sv,
+   "WeaponUnableSelect"sv,
+   "WheelOmegaToU"sv,
+   "WheelOmegaToV"sv,
+   "WheelSection"sv,
+   "WheelTexture"sv,
+   "WheelVelocToU"sv,
+   "WheelVelocToV"sv,
+   "Widescreen"sv,
+   "Width"sv,
+   "WiggleAmount"sv,
+   "WiggleSpeed"sv,
+   "win"sv,
+   "winddirection"sv,
+   "WindDownSound"sv,
+   "WindSound"sv,
+   "WindSpeed"sv,
+   "WindUpSound"sv,
+   "WingModel"sv,
+   "wookie_movement_metal_template"sv,
+   "wookie_movement_template"sv,
+   "word"sv,
+   "word_reformat"sv,
+   "WorldAligned"sv,
+   "WorldBrightness"sv,
+   "WorldContrast"sv,
+   "WorldFogRange"sv,
+   "WorldHeight"sv,
+   "WorldRange"sv,
+   "WorldSaturation"sv,
+   "WrapInput"sv,
+   "yav_movies"sv,
+   "yav_prop_bush"sv,
+   "yav_prop_bush2"sv,
+   "yav_prop_grass"sv,
+   "yav_prop_shrub1"sv,
+   "yav_prop_treebillboard"sv,
+   "yav1tran1"sv,
+   "yavin1"sv,
+   "yavin1_Campaign"sv,
+   "yavin1_CommonDesign"sv,
+   "yavin1_Conquest"sv,
+   "yavin1_ctf"sv,
+   "yavin1_CTF_centerflag"sv,
+   "yavin1_soundemitters"sv,
+   "yavin1_soundregionenv"sv,
+   "yavin1_SoundRegions"sv,
+   "yavin1_SoundSpaces"sv,
+   "yavin1_tdm"sv,
+   "yavin1_tree"sv,
+   "yavmon01"sv,
+   "yavmon02"sv,
+   "YawLimits"sv,
+   "YawSpread"sv,
+   "YawTurnFactor"sv,
+   "YOffset"sv,
+   "ZeroGravity"sv,
+   "ZoomFirstPerson"sv,
+   "ZoomMax"sv,
+   "ZoomMin"sv,
+   "ZoomRate"sv,
+   "ZoomTurnDivisorMax"sv,
+   "ZoomTurnDivisorMin"sv,
+   "ZOrder"sv,
+};
+
+struct Builtin_hash {
+   std::uint32_t hash;
+   std::string_view string;
+};
+
+//! \brief The built-in strings sorted by their hash, so looking one up is a binary
+//! search over a table built by the compiler instead of at startup.
+constexpr auto builtin_hashes = [] {
+   std::array<Builtin_hash, builtin_strings.size()> hashes{};
+
+   std::transform(builtin_strings.cbegin(), builtin_strings.cend(), hashes.begin(),
+                  [](const std::string_view string) {
+                     return Builtin_hash{fnv_1a_hash(string), string};
+                  });
+
+   std::sort(hashes.begin(), hashes.end(),
+             [](const Builtin_hash& l, const Builtin_hash& r) {
+                return l.hash < r.hash;
+             });
+
+   return hashes;
+}();
+
+static_assert(std::adjacent_find(builtin_hashes.cbegin(), builtin_hashes.cend(),
+                                 [](const Builtin_hash& l, const Builtin_hash& r) {
+                                    return l.hash == r.hash;
+                                 }) == builtin_hashes.cend(),
+              "Two built-in strings have the same hash, only one can be kept.");
+
+struct Unknown_hash {
+   explicit Unknown_hash(const std::uint32_t hash) : string{to_hexstring(hash)} {}
+
+   const std::string string;
+   std::atomic_uint64_t lookups = 0;
+};
+
+auto find_builtin(const std::uint32_t hash) noexcept -> std::optional<std::string_view>
 {
-   return {fnv_1a_hash({str, length}), {str, length}};
+   const auto builtin =
+      std::lower_bound(builtin_hashes.cbegin(), builtin_hashes.cend(), hash,
+                       [](const Builtin_hash& entry, const std::uint32_t hash) {
+                          return entry.hash < hash;
+                       });
+
+   if (builtin != builtin_hashes.cend() && builtin->hash == hash) {
+      return builtin->string;
+   }
+
+   return std::nullopt;
+}
+
+std::atomic_uint64_t memo_ids = 0;
+
+//! How many unknown hashes are listed by log_unknown_hashes.
+constexpr std::size_t max_logged_unknown_hashes = 64;
+
 }
 
-const std::unordered_map<std::uint32_t, std::string_view> swbf_hashes{
-   "--AttachOdf"_fnvp,
-   "--AttachToHardPoint"_fnvp,
-   "--DamageAttachPoint"_fnvp,
-   "--DamageEffect"_fnvp,
-   "--DamageEffectScale"_fnvp,
-   "--DamageInheritVelocity"_fnvp,
-   "--DamageStartPercent"_fnvp,
-   "--DamageStopPercent"_fnvp,
-   "--UnbuiltGeometryName"_fnvp,
-   "--UnbuiltHoloOdf"_fnvp,
-   "!Back"_fnvp,
-   "!BackLeft"_fnvp,
-   "!BackRight"_fnvp,
-   "!Crouch"_fnvp,
-   "!Fire"_fnvp,
-   "!FireSecondary"_fnvp,
-   "!Forward"_fnvp,
-   "!Jet"_fnvp,
-   "!Jump"_fnvp,
-   "!Left"_fnvp,
-   "!Prone"_fnvp,
-   "!Reload"_fnvp,
-   "!Right"_fnvp,
-   "!Roll"_fnvp,
-   "!Sprint"_fnvp,
-   "!Stand"_fnvp,
-   "!Thrust"_fnvp,
-   "\\\\ChunkGeometryName"_fnvp,
-   "\\\\ChunkPhysics"_fnvp,
-   "\\\\ChunkSmokeEffect"_fnvp,
-   "\\\\ChunkSmokeNodeName"_fnvp,
-   "\\\\ChunkTrailEffect"_fnvp,
-   "\\\\DeathAnimationExplosion"_fnvp,
-   "\\\\IconTexture"_fnvp,
-   "0"_fnvp,
-   "1"_fnvp,
-   "1Flag"_fnvp,
-   "1PlayerHud"_fnvp,
-   "2"_fnvp,
-   "2Flag"_fnvp,
-   "2PlayerHud"_fnvp,
-   "3PlayerHud"_fnvp,
-   "4PlayerHud"_fnvp,
-   "6"_fnvp,
-   "7"_fnvp,
-   "8"_fnvp,
-   "A"_fnvp,
-   "aacylinder"_fnvp,
-   "Above"_fnvp,
-   "Accelerate"_fnvp,
-   "acceleration"_fnvp,
-   "Acceleraton"_fnvp,
-   "AcquiredTargetSound"_fnvp,
-   "ActiveRotateNode"_fnvp,
-   "ActiveSpinNode"_fnvp,
-   "AddHealth"_fnvp,
-   "AddHitEffect"_fnvp,
-   "Additive"_fnvp,
-   "AddonAttachJoint"_fnvp,
-   "AddSample"_fnvp,
-   "AddShield"_fnvp,
-   "AddShieldOff"_fnvp,
-   "AddSpringBody"_fnvp,
-   "AddToTop"_fnvp,
-   "adminpw"_fnvp,
-   "AdrenalineHigh"_fnvp,
-   "AdrenalineLow"_fnvp,
-   "AdrenalineMedium"_fnvp,
-   "AffectEnemies"_fnvp,
-   "AffectFriends"_fnvp,
-   "AfterburnerOffSound"_fnvp,
-   "AfterburnerOnSound"_fnvp,
-   "AfterburnerSpeed"_fnvp,
-   "AI"_fnvp,
-   "ai_tactical_template"_fnvp,
-   "AIBubbleCircle"_fnvp,
-   "AIBubbleScaleClamp"_fnvp,
-   "AIBubbleScaleDistDivider"_fnvp,
-   "AIBubbleSizeMultiplier"_fnvp,
-   "AICollisionRadius"_fnvp,
-   "AimAzimuth"_fnvp,
-   "AimDistance"_fnvp,
-   "AimElevation"_fnvp,
-   "AimerNodeName"_fnvp,
-   "AimerOffset"_fnvp,
-   "AimerPitchLimits"_fnvp,
-   "AimerPitchLimts"_fnvp,
-   "AimerPitchRate"_fnvp,
-   "AimerRestDirection"_fnvp,
-   "AimerYawLimits"_fnvp,
-   "AimerYawLimts"_fnvp,
-   "AimerYawRate"_fnvp,
-   "AimFactorMove"_fnvp,
-   "AimFactorPostureCrouch"_fnvp,
-   "AimFactorPostureProne"_fnvp,
-   "AimFactorPostureSpecial"_fnvp,
-   "AimFactorPostureStand"_fnvp,
-   "AimFactorStrafe"_fnvp,
-   "AimTension"_fnvp,
-   "AimType"_fnvp,
-   "AimValue"_fnvp,
-   "AINoRepair"_fnvp,
-   "AISCDriverGetInSound"_fnvp,
-   "AISCDriverGetOutSound"_fnvp,
-   "AISCFieldFollowSound"_fnvp,
-   "AISCFieldHoldSound"_fnvp,
-   "AISCFieldMoveOutSound"_fnvp,
-   "AISCGunnerAllClearSound"_fnvp,
-   "AISCGunnerGetInSound"_fnvp,
-   "AISCGunnerGetOutSound"_fnvp,
-   "AISCGunnerSteadySound"_fnvp,
-   "AISCPassengerGetInSound"_fnvp,
-   "AISCPassengerGetOutSound"_fnvp,
-   "AISCPassengerMoveOutSound"_fnvp,
-   "AISCPassengerStopSound"_fnvp,
-   "AISCResponseNosirSound"_fnvp,
-   "AISCResponseYessirSound"_fnvp,
-   "AISizeType"_fnvp,
-   "AISoldierMusic"_fnvp,
-   "AISpawnWeight"_fnvp,
-   "AITargetAll"_fnvp,
-   "AITargetAnimal"_fnvp,
-   "AITargetBuilding"_fnvp,
-   "AITargetBuildingDead"_fnvp,
-   "AITargetBuildingUnbuilt"_fnvp,
-   "AITargetDroid"_fnvp,
-   "AITargetMine"_fnvp,
-   "AITargetPerson"_fnvp,
-   "AITargetVehicle"_fnvp,
-   "AIText"_fnvp,
-   "AIUseBubbleCircle"_fnvp,
-   "AIUseHoverPhysics"_fnvp,
-   "AIVisibilityFactor"_fnvp,
-   "AlignedToThrust"_fnvp,
-   "AlignVertical"_fnvp,
-   "All"_fnvp,
-   "all_halo"_fnvp,
-   "all_hero_luke_jedi"_fnvp,
-   "Alliance"_fnvp,
-   "AllMusic"_fnvp,
-   "AllowAIPickup"_fnvp,
-   "AllowDestruct"_fnvp,
-   "AllowMiniMap"_fnvp,
-   "AllowTeamPickup"_fnvp,
-   "AllyCount"_fnvp,
-   "AllyPath"_fnvp,
-   "Alpha"_fnvp,
-   "AlphaMin"_fnvp,
-   "AlphaMinMax"_fnvp,
-   "AlwaysScroll"_fnvp,
-   "Ambience"_fnvp,
-   "Ambient"_fnvp,
-   "Ambient2Sound"_fnvp,
-   "AmbientColor"_fnvp,
-   "ambientemt_static_template"_fnvp,
-   "ambientemt_template"_fnvp,
-   "ambientfx_template"_fnvp,
-   "AmbientScale"_fnvp,
-   "AmbientSound"_fnvp,
-   "AmmoGainEffect"_fnvp,
-   "AmmoPerShot"_fnvp,
-   "Angle"_fnvp,
-   "AngleEnd"_fnvp,
-   "AngleFade"_fnvp,
-   "AngleMin"_fnvp,
-   "AngleStart"_fnvp,
-   "Animal"_fnvp,
-   "AnimalAmmo"_fnvp,
-   "AnimalEnergy"_fnvp,
-   "AnimalHealth"_fnvp,
-   "AnimalScale"_fnvp,
-   "Animated"_fnvp,
-   "AnimatedAddon"_fnvp,
-   "AnimatedBuilding"_fnvp,
-   "AnimatedMove"_fnvp,
-   "AnimatedPilotPosition"_fnvp,
-   "AnimatedProp"_fnvp,
-   "Animation"_fnvp,
-   "AnimationAddon"_fnvp,
-   "AnimationAmplitude0"_fnvp,
-   "AnimationAmplitude1"_fnvp,
-   "AnimationBank"_fnvp,
-   "AnimationBlending"_fnvp,
-   "AnimationExtraFile"_fnvp,
-   "AnimationFrequency"_fnvp,
-   "AnimationLowRes"_fnvp,
-   "AnimationName"_fnvp,
-   "AnimationTrigger"_fnvp,
-   "AnimationTriggerSound"_fnvp,
-   "AnimChange"_fnvp,
-   "AnimDisable"_fnvp,
-   "AnimEnable"_fnvp,
-   "Anti-Armor"_fnvp,
-   "Any"_fnvp,
-   "ApplyOnOwnerIfOnOthers"_fnvp,
-   "ApproachingTargetSound"_fnvp,
-   "Arc"_fnvp,
-   "AreaHeight"_fnvp,
-   "AreaRadius"_fnvp,
-   "AreaRange"_fnvp,
-   "AreaType"_fnvp,
-   "ArmedBuilding"_fnvp,
-   "ArmedBuildingDynamic"_fnvp,
-   "ArmName"_fnvp,
-   "ArmorScale"_fnvp,
-   "Assault"_fnvp,
-   "ATAT"_fnvp,
-   "AtmosphereColor"_fnvp,
-   "AttachDynamic"_fnvp,
-   "AttachedFirePoint"_fnvp,
-   "attachedmesh"_fnvp,
-   "AttachEffect"_fnvp,
-   "AttachNodeName"_fnvp,
-   "AttachOdf"_fnvp,
-   "AttachToHardPoint"_fnvp,
-   "AttachTrigger"_fnvp,
-   "Attack"_fnvp,
-   "AttackAnimation"_fnvp,
-   "AttackBone"_fnvp,
-   "AttackControls"_fnvp,
-   "AttackDamage"_fnvp,
-   "AttackDamageDistance"_fnvp,
-   "AttackDamageTime"_fnvp,
-   "AttackDuration"_fnvp,
-   "AttackerOffScreen"_fnvp,
-   "AttackerOffScreenBehind"_fnvp,
-   "AttackerOnScreen"_fnvp,
-   "AttackerOnScreenBehind"_fnvp,
-   "AttackId"_fnvp,
-   "AttackPosition"_fnvp,
-   "AttackPositionVO"_fnvp,
-   "AttackPush"_fnvp,
-   "AttackRadius"_fnvp,
-   "AttackRecoverBreakOutTime"_fnvp,
-   "AttackRecoverDuration"_fnvp,
-   "AttackSound"_fnvp,
-   "AttackTime"_fnvp,
-   "AttenuateBus"_fnvp,
-   "Attenuation"_fnvp,
-   "AttenuationLeadIn"_fnvp,
-   "AttenuationLeadOut"_fnvp,
-   "Attitude"_fnvp,
-   "AttractCameras"_fnvp,
-   "AttractGame"_fnvp,
-   "AttractIngame"_fnvp,
-   "AttractMap"_fnvp,
-   "AttractTimeout"_fnvp,
-   "AudioMaxChannels"_fnvp,
-   "AudioMixBuffer"_fnvp,
-   "AudionoEnhance"_fnvp,
-   "AudioSampleRate"_fnvp,
-   "AutoAim"_fnvp,
-   "AutoAimSize"_fnvp,
-   "AutoAimYLimits"_fnvp,
-   "AutoBarrierEnable"_fnvp,
-   "AutoBarrierRemoveOnDeath"_fnvp,
-   "AutoBarrierSize"_fnvp,
-   "AutoFire"_fnvp,
-   "autonet"_fnvp,
-   "AutoPitchScreenDist"_fnvp,
-   "AutoRespawnEnable"_fnvp,
-   "AutoTurnScreenDist"_fnvp,
-   "AvailableForAnyTeam"_fnvp,
-   "B01"_fnvp,
-   "Back"_fnvp,
-   "BackAngle"_fnvp,
-   "BackColor"_fnvp,
-   "BackDegree"_fnvp,
-   "Backdrop"_fnvp,
-   "BackdropLarge"_fnvp,
-   "BackdropSmall"_fnvp,
-   "BackdropSpawn"_fnvp,
-   "Background"_fnvp,
-   "BackgroundMaskShapeLarge"_fnvp,
-   "BackgroundMaskShapeSmall"_fnvp,
-   "BackgroundMaskShapeSpawn"_fnvp,
-   "BackLeft"_fnvp,
-   "BackRight"_fnvp,
-   "BadName"_fnvp,
-   "BallAcceleration"_fnvp,
-   "BallCollision"_fnvp,
-   "BallJumpForwardBoost"_fnvp,
-   "BallJumpHeight"_fnvp,
-   "BallLowResModel"_fnvp,
-   "BallMaxLean"_fnvp,
-   "BallMinMoveSpeed"_fnvp,
-   "BallMoveSpeed"_fnvp,
-   "BallMoveThreshold"_fnvp,
-   "BallRadius"_fnvp,
-   "BallRollingFriction"_fnvp,
-   "BallSlippage"_fnvp,
-   "BallSprintSpeedBoost"_fnvp,
-   "BallSprintTurnSpeed"_fnvp,
-   "BallStoppedTurnSpeed"_fnvp,
-   "BallTurnSpeed"_fnvp,
-   "BallWaterDamageHeight"_fnvp,
-   "Bandwidth"_fnvp,
-   "BankAngle"_fnvp,
-   "BankFilter"_fnvp,
-   "BarBitmap"_fnvp,
-   "BarrageDelay"_fnvp,
-   "BarrageMax"_fnvp,
-   "BarrageMin"_fnvp,
-   "BarrelLength"_fnvp,
-   "BarrelNodeName"_fnvp,
-   "BarrelOffset"_fnvp,
-   "BarrelRecoil"_fnvp,
-   "BarrelSound"_fnvp,
-   "BarrelSoundFadeInTime"_fnvp,
-   "BarrelSoundFadeOutTime"_fnvp,
-   "BarSegmented"_fnvp,
-   "Base"_fnvp,
-   "Baseline"_fnvp,
-   "battle_chatter_template"_fnvp,
-   "battlechatter"_fnvp,
-   "bazarre_sprays"_fnvp,
-   "Beacon"_fnvp,
-   "BeadColor"_fnvp,
-   "BeadCount"_fnvp,
-   "BeadModulate"_fnvp,
-   "BeadSize"_fnvp,
-   "BeadSpeed"_fnvp,
-   "BeadTexture"_fnvp,
-   "Beam"_fnvp,
-   "BeamColor"_fnvp,
-   "BeamGlowColor"_fnvp,
-   "BeamGlowTexture"_fnvp,
-   "BeamGlowWidth"_fnvp,
-   "BeamIntensity"_fnvp,
-   "BeamTexture"_fnvp,
-   "BeamWidth"_fnvp,
-   "Behind"_fnvp,
-   "Below"_fnvp,
-   "bendconstraint"_fnvp,
-   "Bias"_fnvp,
-   "Bidirectional"_fnvp,
-   "big_glow"_fnvp,
-   "bigartheap"_fnvp,
-   "BILLBOARD"_fnvp,
-   "Binoculars"_fnvp,
-   "Bird"_fnvp,
-   "BirdScatter"_fnvp,
-   "BirdScatterSound"_fnvp,
-   "BirdSound"_fnvp,
-   "Bitmap"_fnvp,
-   "BitmapHAlign"_fnvp,
-   "BitmapRect"_fnvp,
-   "BitmapStyle"_fnvp,
-   "BitmapVAlign"_fnvp,
-   "BitmapWidthHeight"_fnvp,
-   "BlendInTime"_fnvp,
-   "BlendMode"_fnvp,
-   "BlendOutTime"_fnvp,
-   "BlendTimeIn"_fnvp,
-   "BlendTimeOut"_fnvp,
-   "BlendTimeTo"_fnvp,
-   "BlockSize"_fnvp,
-   "Blue"_fnvp,
-   "blue_blaster_bolt"_fnvp,
-   "blue_blaster_bolt_small"_fnvp,
-   "Blue_halo"_fnvp,
-   "BlueFlame"_fnvp,
-   "Blur"_fnvp,
-   "BlurEffect"_fnvp,
-   "BlurEnable"_fnvp,
-   "BlurLength"_fnvp,
-   "BlurRes"_fnvp,
-   "BlurStart"_fnvp,
-   "BlurValue"_fnvp,
-   "BobOrient"_fnvp,
-   "BobRSlope"_fnvp,
-   "BobSlope"_fnvp,
-   "BobTime"_fnvp,
-   "BobVector"_fnvp,
-   "Body"_fnvp,
-   "body_movement_fall_template"_fnvp,
-   "body_movement_metal_template"_fnvp,
-   "body_movement_template"_fnvp,
-   "body_movement_water_template"_fnvp,
-   "BodyFall"_fnvp,
-   "BodyOmegaXDampFactor"_fnvp,
-   "BodyOmegaXSpringFactor"_fnvp,
-   "BodyOmegaZDampFactor"_fnvp,
-   "BodyOmegaZSpringFactor"_fnvp,
-   "BodySpringLength"_fnvp,
-   "BodySpringLengthRadiusMultiplier"_fnvp,
-   "BodyVelocityDampFactor"_fnvp,
-   "BodyVelocitySpringFactor"_fnvp,
-   "Bolt"_fnvp,
-   "BonesPerTentacle"_fnvp,
-   "BonusAmplification"_fnvp,
-   "BonusColor"_fnvp,
-   "BoostAcceleration"_fnvp,
-   "BoostFOV"_fnvp,
-   "BoostSound"_fnvp,
-   "BoostSpeed"_fnvp,
-   "BoostTurnMultiplier"_fnvp,
-   "BoostTurnSpeed"_fnvp,
-   "bootlagger"_fnvp,
-   "Border"_fnvp,
-   "BorderDiffuseColor"_fnvp,
-   "BorderedBox"_fnvp,
-   "BorderOdf"_fnvp,
-   "Bots"_fnvp,
-   "Bottom"_fnvp,
-   "BottomColor"_fnvp,
-   "BottomDirectionalAmbientColor"_fnvp,
-   "BottomDrop"_fnvp,
-   "BottomRange"_fnvp,
-   "bound01"_fnvp,
-   "Bound02"_fnvp,
-   "Bound03"_fnvp,
-   "Boundary"_fnvp,
-   "boundary01"_fnvp,
-   "boundary02"_fnvp,
-   "boundary1"_fnvp,
-   "BoundingRadius"_fnvp,
-   "BowlingPush"_fnvp,
-   "Box"_fnvp,
-   "BoxSize"_fnvp,
-   "BranchDifferent"_fnvp,
-   "BranchFactor"_fnvp,
-   "BranchLength"_fnvp,
-   "BranchPaths"_fnvp,
-   "BranchProbability"_fnvp,
-   "BranchRegion"_fnvp,
-   "BranchSpreadFactor"_fnvp,
-   "Break"_fnvp,
-   "BreakDistance"_fnvp,
-   "BrightnessMin"_fnvp,
-   "BrightStarPercent"_fnvp,
-   "brnbeep1"_fnvp,
-   "BuffDefenseEffect"_fnvp,
-   "BuffDefenseMult"_fnvp,
-   "BuffDefenseTimer"_fnvp,
-   "BuffHealthEffect"_fnvp,
-   "BuffHealthRate"_fnvp,
-   "BuffHealthTimer"_fnvp,
-   "BuffOffenseEffect"_fnvp,
-   "BuffOffenseMult"_fnvp,
-   "BuffOffenseTimer"_fnvp,
-   "BuildAnimation"_fnvp,
-   "Building"_fnvp,
-   "BuildingAmmo"_fnvp,
-   "BuildingBuild"_fnvp,
-   "BuildingCollision"_fnvp,
-   "BuildingCollisionPrim"_fnvp,
-   "BuildingEnergy"_fnvp,
-   "BuildingHealth"_fnvp,
-   "BuildingRebuild"_fnvp,
-   "BuildingScale"_fnvp,
-   "BuildingSection"_fnvp,
-   "BuildingSound"_fnvp,
-   "BuildModelOdf"_fnvp,
-   "BuildPoint"_fnvp,
-   "BuiltCollision"_fnvp,
-   "BuiltSound"_fnvp,
-   "Bullet"_fnvp,
-   "BumpMap"_fnvp,
-   "BumpMapTextures"_fnvp,
-   "BumpTexture"_fnvp,
-   "BurstCount"_fnvp,
-   "BurstDelay"_fnvp,
-   "Bus"_fnvp,
-   "Button"_fnvp,
-   "ButtonsPressed"_fnvp,
-   "ButtonsReleased"_fnvp,
-   "ByTime"_fnvp,
-   "C"_fnvp,
-   "CableLength"_fnvp,
-   "CameraAxialVelocityScale"_fnvp,
-   "CameraBlendTime"_fnvp,
-   "CameraCrossVelocityScale"_fnvp,
-   "CameraDistance"_fnvp,
-   "CameraHeight"_fnvp,
-   "CAMERASECTION"_fnvp,
-   "Campaign"_fnvp,
-   "CampaignLayout"_fnvp,
-   "CampaignName"_fnvp,
-   "CanDeflect"_fnvp,
-   "Cannon"_fnvp,
-   "CAPITOL"_fnvp,
-   "CapturedSound"_fnvp,
-   "CaptureMusic"_fnvp,
-   "CapturePosts"_fnvp,
-   "CaptureRegion"_fnvp,
-   "CaptureTime"_fnvp,
-   "CargoNodeName"_fnvp,
-   "CargoNodeOffset"_fnvp,
-   "CarriedColorize"_fnvp,
-   "CarriedGeometryName"_fnvp,
-   "CarriedOffset"_fnvp,
-   "CastShadow"_fnvp,
-   "CastSpecular"_fnvp,
-   "Catapult"_fnvp,
-   "CenterDeadZoneRadius"_fnvp,
-   "Centered"_fnvp,
-   "ChangeModeSound"_fnvp,
-   "CharacterAmbientColor"_fnvp,
-   "Charge"_fnvp,
-   "ChargeDelayHeavy"_fnvp,
-   "ChargeDelayLight"_fnvp,
-   "ChargedSound"_fnvp,
-   "ChargeMaxTime"_fnvp,
-   "ChargeMinStrength"_fnvp,
-   "ChargeRateHeavy"_fnvp,
-   "ChargeRateLight"_fnvp,
-   "ChargeSound"_fnvp,
-   "ChargeSoundPitch"_fnvp,
-   "ChargeSoundStop"_fnvp,
-   "ChargeUpEffect"_fnvp,
-   "Chase"_fnvp,
-   "cheating"_fnvp,
-   "ChildAsteroid"_fnvp,
-   "ChildBreakDistance"_fnvp,
-   "ChildColor"_fnvp,
-   "ChildSpreadFactor"_fnvp,
-   "ChildTextureSize"_fnvp,
-   "ChildWidth"_fnvp,
-   "Choke"_fnvp,
-   "ChokeEffect"_fnvp,
-   "ChokeSound"_fnvp,
-   "CHUNK"_fnvp,
-   "CHUNK1"_fnvp,
-   "CHUNK2"_fnvp,
-   "CHUNK3"_fnvp,
-   "CHUNK4"_fnvp,
-   "CHUNK5"_fnvp,
-   "CHUNK6"_fnvp,
-   "CHUNK7"_fnvp,
-   "CHUNK8"_fnvp,
-   "CHUNK9"_fnvp,
-   "ChunkAngularDamping"_fnvp,
-   "ChunkBounciness"_fnvp,
-   "ChunkDeathSpeed"_fnvp,
-   "ChunkFrequency"_fnvp,
-   "ChunkGeometryName"_fnvp,
-   "ChunkGravity"_fnvp,
-   "ChunkInitialCollisionSound"_fnvp,
-   "ChunkKeepSoldierCollision"_fnvp,
-   "ChunkLifetime"_fnvp,
-   "ChunkLinearDamping"_fnvp,
-   "ChunkNodeName"_fnvp,
-   "ChunkOmega"_fnvp,
-   "ChunkPhysics"_fnvp,
-   "ChunkScrapeCollisionSound"_fnvp,
-   "CHUNKSECTION"_fnvp,
-   "ChunkSimpleFriction"_fnvp,
-   "ChunkSmokeEffect"_fnvp,
-   "ChunkSmokeNodeName"_fnvp,
-   "ChunkSpeed"_fnvp,
-   "ChunkStartDistance"_fnvp,
-   "ChunkStickiness"_fnvp,
-   "ChunkTerrainCollisions"_fnvp,
-   "ChunkTerrainEffect"_fnvp,
-   "ChunkTrailEffect"_fnvp,
-   "ChunkTrailNodeName"_fnvp,
-   "ChunkUpFactor"_fnvp,
-   "ChunkVelocityFactor"_fnvp,
-   "Circle"_fnvp,
-   "CircleATATFrequency"_fnvp,
-   "Circular"_fnvp,
-   "CIS"_fnvp,
-   "cis_halo"_fnvp,
-   "cis_hero_countdooku"_fnvp,
-   "cis_hero_darthmaul"_fnvp,
-   "cis_hero_grievous"_fnvp,
-   "cis_sfx_droid_explosion"_fnvp,
-   "cis_sfx_droideka_explosion"_fnvp,
-   "cis_sfx_jetpack"_fnvp,
-   "cis_sfx_sbd_missiles_red"_fnvp,
-   "CISMusic"_fnvp,
-   "ClankLeftRunSound"_fnvp,
-   "ClankLeftWalkSound"_fnvp,
-   "ClankRightRunSound"_fnvp,
-   "ClankRightWalkSound"_fnvp,
-   "Class"_fnvp,
-   "Class1"_fnvp,
-   "Class2"_fnvp,
-   "Class3"_fnvp,
-   "Class4"_fnvp,
-   "Class5"_fnvp,
-   "ClassAllATK"_fnvp,
-   "ClassAllDEF"_fnvp,
-   "ClassCISATK"_fnvp,
-   "ClassCISDEF"_fnvp,
-   "ClassHisATK"_fnvp,
-   "ClassHisDEF"_fnvp,
-   "ClassImpATK"_fnvp,
-   "ClassImpDEF"_fnvp,
-   "ClassLabel"_fnvp,
-   "ClassLocals"_fnvp,
-   "ClassLocATK"_fnvp,
-   "ClassLocDEF"_fnvp,
-   "ClassNeutral"_fnvp,
-   "ClassRepATK"_fnvp,
-   "ClassRepDEF"_fnvp,
-   "ClearLockOnFire"_fnvp,
-   "CloseSound"_fnvp,
-   "ClothingRustleSound"_fnvp,
-   "ClothODF"_fnvp,
-   "CloudCluster"_fnvp,
-   "CloudLayer"_fnvp,
-   "CockedAngle"_fnvp,
-   "Cockpit"_fnvp,
-   "Cockpit1stPersonSound"_fnvp,
-   "Cockpit3rdPersonSound"_fnvp,
-   "CockpitChatterStream"_fnvp,
-   "CockpitTension"_fnvp,
-   "CodeInitialWidth"_fnvp,
-   "Collidable"_fnvp,
-   "CollisionFoliageSound"_fnvp,
-   "CollisionHeadOffset"_fnvp,
-   "CollisionHeadScale"_fnvp,
-   "CollisionInflict"_fnvp,
-   "collisionName"_fnvp,
-   "CollisionOtherSound"_fnvp,
-   "CollisionRootScale"_fnvp,
-   "CollisionScale"_fnvp,
-   "CollisionShieldSound"_fnvp,
-   "CollisionSound"_fnvp,
-   "CollisionThreshold"_fnvp,
-   "CollisionTorsoOffset"_fnvp,
-   "CollisionTorsoScale"_fnvp,
-   "CollisionWaterSound"_fnvp,
-   "Color"_fnvp,
-   "ColorChange"_fnvp,
-   "ColorChangeRate"_fnvp,
-   "ColorFriendly"_fnvp,
-   "ColorInterp"_fnvp,
-   "ColorizeByTeam"_fnvp,
-   "ColorPulseRate"_fnvp,
-   "ColorSaturation"_fnvp,
-   "ColorVariation"_fnvp,
-   "com_icon_alliance"_fnvp,
-   "com_icon_CIS"_fnvp,
-   "com_icon_imperial"_fnvp,
-   "com_icon_republic"_fnvp,
-   "com_sfx_bif"_fnvp,
-   "com_sfx_blammo"_fnvp,
-   "com_sfx_buff_defense"_fnvp,
-   "com_sfx_buff_offense"_fnvp,
-   "com_sfx_buff_poison"_fnvp,
-   "com_sfx_buff_regen"_fnvp,
-   "com_sfx_buffed_defense"_fnvp,
-   "com_sfx_buffed_offense"_fnvp,
-   "com_sfx_buffed_poison"_fnvp,
-   "com_sfx_buffed_regen"_fnvp,
-   "com_sfx_chargeup"_fnvp,
-   "com_sfx_chunksmolder"_fnvp,
-   "com_sfx_chunktrail"_fnvp,
-   "com_sfx_chunktrail_sm"_fnvp,
-   "com_sfx_chunktrail_xs"_fnvp,
-   "com_sfx_contrail"_fnvp,
-   "com_sfx_dirtspray_lg"_fnvp,
-   "com_sfx_dirtspray_sm"_fnvp,
-   "com_sfx_dustwake"_fnvp,
-   "com_sfx_exhaust_cloudcar"_fnvp,
-   "com_sfx_exhaust_jedistarfighter"_fnvp,
-   "com_sfx_exhaust_jedistarfighter_blue"_fnvp,
-   "com_sfx_exhaust_kwing"_fnvp,
-   "com_sfx_exhaust_xwing"_fnvp,
-   "com_sfx_explosion_lg"_fnvp,
-   "com_sfx_explosion_sm"_fnvp,
-   "com_sfx_explosion_xl"_fnvp,
-   "com_sfx_explosion_xs"_fnvp,
-   "com_sfx_fireflies"_fnvp,
-   "com_sfx_forcechoked"_fnvp,
-   "com_sfx_forcepulled"_fnvp,
-   "com_sfx_forcepushed"_fnvp,
-   "com_sfx_groundcrack"_fnvp,
-   "com_sfx_hackedvehicle"_fnvp,
-   "com_sfx_inf_damage_disintergrate"_fnvp,
-   "com_sfx_inf_damage_electricity"_fnvp,
-   "com_sfx_inf_damage_fire"_fnvp,
-   "com_sfx_inf_damage_smoke"_fnvp,
-   "com_sfx_inf_disintergrate"_fnvp,
-   "com_sfx_landmine"_fnvp,
-   "com_sfx_lightning"_fnvp,
-   "com_sfx_mineblink_blue"_fnvp,
-   "com_sfx_mineblink_gold"_fnvp,
-   "com_sfx_mineblink_green"_fnvp,
-   "com_sfx_mineblink_purple"_fnvp,
-   "com_sfx_mineblink_red"_fnvp,
-   "com_sfx_muzzleflash_lg"_fnvp,
-   "com_sfx_ord_exp"_fnvp,
-   "com_sfx_ord_flame"_fnvp,
-   "com_sfx_pow"_fnvp,
-   "com_sfx_powerup_blue"_fnvp,
-   "com_sfx_powerup_green"_fnvp,
-   "com_sfx_powerup_red"_fnvp,
-   "com_sfx_protontorpedo"_fnvp,
-   "com_sfx_rainsplash"_fnvp,
-   "com_sfx_repair"_fnvp,
-   "com_sfx_sabredeflect"_fnvp,
-   "com_sfx_sabrehit"_fnvp,
-   "com_sfx_shieldimpact_sm"_fnvp,
-   "com_sfx_shieldimpact_xl"_fnvp,
-   "com_sfx_smokeplume"_fnvp,
-   "com_sfx_timebomb"_fnvp,
-   "com_sfx_vehicle_exp"_fnvp,
-   "com_sfx_vehicleflame"_fnvp,
-   "com_sfx_vehicleflame_sc"_fnvp,
-   "com_sfx_vehicleflame_speeder"_fnvp,
-   "com_sfx_vehiclesmoke"_fnvp,
-   "com_sfx_vehiclesmoke_sc"_fnvp,
-   "com_sfx_vehiclesmoke_speeder"_fnvp,
-   "com_sfx_vehiclespark"_fnvp,
-   "com_sfx_vehiclespark_sc"_fnvp,
-   "com_sfx_vehiclespark_speeder"_fnvp,
-   "com_sfx_walkerstomp"_fnvp,
-   "com_sfx_waterbulletspray"_fnvp,
-   "com_sfx_watersplash_lg"_fnvp,
-   "com_sfx_watersplash_md"_fnvp,
-   "com_sfx_watersplash_ord"_fnvp,
-   "com_sfx_watersplash_ord_lg"_fnvp,
-   "com_sfx_watersplash_ord_md"_fnvp,
-   "com_sfx_watersplash_sm"_fnvp,
-   "com_sfx_watersplash_wade"_fnvp,
-   "com_sfx_watersplash_walker"_fnvp,
-   "com_sfx_watersplash_xs"_fnvp,
-   "com_sfx_waterwake_lg"_fnvp,
-   "com_sfx_waterwake_sm"_fnvp,
-   "com_sfx_weap_arccaster"_fnvp,
-   "com_sfx_weap_beam_exp"_fnvp,
-   "com_sfx_weap_beam_exp_lg"_fnvp,
-   "com_sfx_weap_beam_exp_md"_fnvp,
-   "com_sfx_weap_beam_exp_sm"_fnvp,
-   "com_sfx_weap_beam_exp_xl"_fnvp,
-   "com_sfx_weap_bluebolt_exp_lg"_fnvp,
-   "com_sfx_weap_bluebolt_exp_md"_fnvp,
-   "com_sfx_weap_bluebolt_exp_sm"_fnvp,
-   "com_sfx_weap_bluebolt_exp_xl"_fnvp,
-   "com_sfx_weap_bolt_exp_lg"_fnvp,
-   "com_sfx_weap_bolt_exp_md"_fnvp,
-   "com_sfx_weap_bolt_exp_sm"_fnvp,
-   "com_sfx_weap_bolt_exp_xl"_fnvp,
-   "com_sfx_weap_con_exp_lg"_fnvp,
-   "com_sfx_weap_con_exp_md"_fnvp,
-   "com_sfx_weap_con_exp_sm"_fnvp,
-   "com_sfx_weap_con_exp_xl"_fnvp,
-   "com_sfx_weap_detpack_exp"_fnvp,
-   "com_sfx_weap_emp_exp_lg"_fnvp,
-   "com_sfx_weap_emp_exp_md"_fnvp,
-   "com_sfx_weap_emp_exp_sm"_fnvp,
-   "com_sfx_weap_emp_exp_xl"_fnvp,
-   "com_sfx_weap_empmortar_ord"_fnvp,
-   "com_sfx_weap_flame_exp_lg"_fnvp,
-   "com_sfx_weap_flame_exp_md"_fnvp,
-   "com_sfx_weap_flame_exp_sm"_fnvp,
-   "com_sfx_weap_flame_exp_xl"_fnvp,
-   "com_sfx_weap_flamethrower_ord"_fnvp,
-   "com_sfx_weap_greenbolt_exp_lg"_fnvp,
-   "com_sfx_weap_greenbolt_exp_md"_fnvp,
-   "com_sfx_weap_greenbolt_exp_sm"_fnvp,
-   "com_sfx_weap_greenbolt_exp_xl"_fnvp,
-   "com_sfx_weap_grenade_blue"_fnvp,
-   "com_sfx_weap_grenade_emp_exp"_fnvp,
-   "com_sfx_weap_grenade_gold"_fnvp,
-   "com_sfx_weap_grenade_green"_fnvp,
-   "com_sfx_weap_grenade_radiation_exp"_fnvp,
-   "com_sfx_weap_grenade_red"_fnvp,
-   "com_sfx_weap_grenade_schrap_exp"_fnvp,
-   "com_sfx_weap_grenade_thermal"_fnvp,
-   "com_sfx_weap_grenade_thermal_exp"_fnvp,
-   "com_sfx_weap_incinerate_ord"_fnvp,
-   "com_sfx_weap_incinerate_ord_exp"_fnvp,
-   "com_sfx_weap_mortartrail_blue"_fnvp,
-   "com_sfx_weap_mortartrail_red"_fnvp,
-   "com_sfx_weap_mortartrail_yellow"_fnvp,
-   "com_sfx_weap_orangebolt_exp_lg"_fnvp,
-   "com_sfx_weap_orangebolt_exp_md"_fnvp,
-   "com_sfx_weap_orangebolt_exp_sm"_fnvp,
-   "com_sfx_weap_orangebolt_exp_xl"_fnvp,
-   "com_sfx_weap_purplebolt_exp_lg"_fnvp,
-   "com_sfx_weap_purplebolt_exp_md"_fnvp,
-   "com_sfx_weap_purplebolt_exp_sm"_fnvp,
-   "com_sfx_weap_purplebolt_exp_xl"_fnvp,
-   "com_sfx_weap_rad_exp_lg"_fnvp,
-   "com_sfx_weap_rad_exp_md"_fnvp,
-   "com_sfx_weap_rad_exp_sm"_fnvp,
-   "com_sfx_weap_rad_exp_xl"_fnvp,
-   "com_sfx_weap_redbolt_exp_lg"_fnvp,
-   "com_sfx_weap_redbolt_exp_md"_fnvp,
-   "com_sfx_weap_redbolt_exp_sm"_fnvp,
-   "com_sfx_weap_redbolt_exp_xl"_fnvp,
-   "com_sfx_weap_remotedroid_exp"_fnvp,
-   "com_sfx_weap_remotedroidcharge2"_fnvp,
-   "com_sfx_weap_rockettrail"_fnvp,
-   "com_sfx_weap_rockettrail_blue"_fnvp,
-   "com_sfx_weap_rockettrail_gold"_fnvp,
-   "com_sfx_weap_rockettrail_green"_fnvp,
-   "com_sfx_weap_rockettrail_purple"_fnvp,
-   "com_sfx_weap_sc_exp_lg"_fnvp,
-   "com_sfx_weap_sc_exp_md"_fnvp,
-   "com_sfx_weap_sc_exp_sm"_fnvp,
-   "com_sfx_weap_sc_exp_xl"_fnvp,
-   "com_sfx_weap_seismiccharge"_fnvp,
-   "com_sfx_weap_shiplaser_exp_lg"_fnvp,
-   "com_sfx_weap_shiplaser_exp_md"_fnvp,
-   "com_sfx_weap_shiplaser_exp_sm"_fnvp,
-   "com_sfx_weap_sonic_exp_sm"_fnvp,
-   "com_sfx_weap_spyrifle_ord"_fnvp,
-   "com_sfx_weap_timebomb"_fnvp,
-   "com_sfx_weap_yellowbolt_exp_lg"_fnvp,
-   "com_sfx_zap"_fnvp,
-   "com_weap_overheat"_fnvp,
-   "ComboAnimationBank"_fnvp,
-   "ComboTime"_fnvp,
-   "commandarmedanimatedbuilding"_fnvp,
-   "CommandHover"_fnvp,
-   "CommandPost"_fnvp,
-   "commandpost_amb_template"_fnvp,
-   "CommandPost_capturelost"_fnvp,
-   "CommandWalker"_fnvp,
-   "Cone"_fnvp,
-   "ConeAngle"_fnvp,
-   "ConeFadeFactor"_fnvp,
-   "ConeFadeLength"_fnvp,
-   "ConeHeight"_fnvp,
-   "ConeInitialWidth"_fnvp,
-   "ConeLength"_fnvp,
-   "ConeWidth"_fnvp,
-   "Connect"_fnvp,
-   "Conquest"_fnvp,
-   "ConstantBlend"_fnvp,
-   "ContrailAttachOffset"_fnvp,
-   "ContrailAttachPoint"_fnvp,
-   "ContrailEffect"_fnvp,
-   "ContrailEffectMaxScale"_fnvp,
-   "ContrailEffectMaxSpeed"_fnvp,
-   "ContrailEffectMinScale"_fnvp,
-   "ContrailEffectMinSpeed"_fnvp,
-   "Controllable"_fnvp,
-   "ControlRegion"_fnvp,
-   "ControlSpeed"_fnvp,
-   "ControlZone"_fnvp,
-   "CoolDownSound"_fnvp,
-   "CoolDownSoundEndPitch"_fnvp,
-   "CoolDownSoundFadeInTime"_fnvp,
-   "CoolDownSoundFadeOutTime"_fnvp,
-   "CoolDownTime"_fnvp,
-   "cor_movies"_fnvp,
-   "cor1tran1"_fnvp,
-   "cormon01"_fnvp,
-   "cormon02"_fnvp,
-   "CorrectAimForSteering"_fnvp,
-   "Count"_fnvp,
-   "Cover"_fnvp,
-   "CoverOdf"_fnvp,
-   "crashed"_fnvp,
-   "crawl1"_fnvp,
-   "crawl2"_fnvp,
-   "crossconstraint"_fnvp,
-   "Crouch"_fnvp,
-   "CrouchAimSpread"_fnvp,
-   "CrouchMoveSpread"_fnvp,
-   "CrouchStillSpread"_fnvp,
-   "CROUCHZOOM"_fnvp,
-   "CTFDefense"_fnvp,
-   "CTFOffense"_fnvp,
-   "CurHealth"_fnvp,
-   "CurShield"_fnvp,
-   "Cursing"_fnvp,
-   "CustomAnimationBank"_fnvp,
-   "cw_music"_fnvp,
-   "CyclePlayback"_fnvp,
-   "Cylinder"_fnvp,
-   "Damage"_fnvp,
-   "DamageAttachOffset"_fnvp,
-   "DamageAttachPoint"_fnvp,
-   "DamageDeduction"_fnvp,
-   "DamageDistance"_fnvp,
-   "DamageEdgeLength"_fnvp,
-   "DamageEdgeWidth"_fnvp,
-   "DamageEffect"_fnvp,
-   "DamageEffectScale"_fnvp,
-   "DamageEffectSound"_fnvp,
-   "DamageFinalDamage"_fnvp,
-   "DamageInheritVelocity"_fnvp,
-   "DamageLength"_fnvp,
-   "DamageRadius"_fnvp,
-   "DamageRadiusInner"_fnvp,
-   "DamageRadiusOuter"_fnvp,
-   "DamageRegionSound"_fnvp,
-   "DamageStartPercent"_fnvp,
-   "DamageStopPercent"_fnvp,
-   "DamageThreshold"_fnvp,
-   "DamageTime"_fnvp,
-   "DamageTransitionDelay"_fnvp,
-   "DamageTransitionPeriod"_fnvp,
-   "DamageWidth"_fnvp,
-   "Dampening"_fnvp,
-   "DarknessMax"_fnvp,
-   "DarknessMin"_fnvp,
-   "Data"_fnvp,
-   "dea_movies"_fnvp,
-   "dea1tran1"_fnvp,
-   "deamon01"_fnvp,
-   "deamon02"_fnvp,
-   "DeathAnimation"_fnvp,
-   "DeathAnimationExplosion"_fnvp,
-   "DeathAnimationExplosionTime"_fnvp,
-   "DeathDustDelay"_fnvp,
-   "DeathDustEffect"_fnvp,
-   "DeathDustOffset"_fnvp,
-   "DeathEffect"_fnvp,
-   "DeathEffectOffset"_fnvp,
-   "DeathFadeTimeEnd"_fnvp,
-   "DeathFadeTimeStart"_fnvp,
-   "Deathmatch"_fnvp,
-   "DeathOnCollision"_fnvp,
-   "DeathShakeDelay"_fnvp,
-   "DeathShakeDuration"_fnvp,
-   "DeathShakeForce"_fnvp,
-   "DeathShakeRadius"_fnvp,
-   "DeathSound"_fnvp,
-   "DeathTime"_fnvp,
-   "DebuffDamageRate"_fnvp,
-   "DebuffDamageTimer"_fnvp,
-   "DebuffEffect"_fnvp,
-   "DebugAnims"_fnvp,
-   "DebugCombos"_fnvp,
-   "Decal"_fnvp,
-   "DecayHFRatio"_fnvp,
-   "DecayTime"_fnvp,
-   "Deceleration"_fnvp,
-   "Default"_fnvp,
-   "DefaultSize"_fnvp,
-   "Defend"_fnvp,
-   "DefendPositionVO"_fnvp,
-   "Deflect"_fnvp,
-   "DeflectAngle"_fnvp,
-   "DeflectAnimation"_fnvp,
-   "DeflectEffect"_fnvp,
-   "DeflectSound"_fnvp,
-   "Degree"_fnvp,
-   "delfriend"_fnvp,
-   "DemoMode"_fnvp,
-   "Density"_fnvp,
-   "DenyFlyerLand"_fnvp,
-   "Depth"_fnvp,
-   "Description"_fnvp,
-   "Destroy"_fnvp,
-   "DestroyedGeometryName"_fnvp,
-   "Destruct"_fnvp,
-   "DestructableBuilding"_fnvp,
-   "DestructChargeEffect"_fnvp,
-   "DestructTiltValue"_fnvp,
-   "DestructTrackOffset"_fnvp,
-   "DetailTexture"_fnvp,
-   "DetailTextureScale"_fnvp,
-   "DetatchSound"_fnvp,
-   "Detonator"_fnvp,
-   "Die"_fnvp,
-   "Difficulty"_fnvp,
-   "Diffusion"_fnvp,
-   "DirectGain"_fnvp,
-   "DirectHFGain"_fnvp,
-   "Direction"_fnvp,
-   "DisableAIAutoBalance"_fnvp,
-   "DisabledEffect"_fnvp,
-   "DisableForCloneWars"_fnvp,
-   "DisableLowRes"_fnvp,
-   "DisableOnEmpty"_fnvp,
-   "DisableTime"_fnvp,
-   "Discharge"_fnvp,
-   "DischargeSound"_fnvp,
-   "Disguise"_fnvp,
-   "DisguiseOwnerModel"_fnvp,
-   "Dispenser"_fnvp,
-   "DisplayRefire"_fnvp,
-   "DisplayTime"_fnvp,
-   "DisputeSound"_fnvp,
-   "Distance"_fnvp,
-   "DistortionScale"_fnvp,
-   "DomeColor"_fnvp,
-   "DomeInfo"_fnvp,
-   "DomeModel"_fnvp,
-   "DopplerMode"_fnvp,
-   "DoubleTap"_fnvp,
-   "Down"_fnvp,
-   "DownSizeFactor"_fnvp,
-   "Drag"_fnvp,
-   "Draw"_fnvp,
-   "DrawDistance"_fnvp,
-   "Droid"_fnvp,
-   "DroidAmmo"_fnvp,
-   "DroidekaAttachBone"_fnvp,
-   "DroidekaShield"_fnvp,
-   "DroidEnergy"_fnvp,
-   "DroidHealth"_fnvp,
-   "DroidScale"_fnvp,
-   "DropItemClass"_fnvp,
-   "DropItemProbability"_fnvp,
-   "DropoffSound"_fnvp,
-   "DroppedColorize"_fnvp,
-   "DroppedInLandingZoneGeometryName"_fnvp,
-   "DropShadowSize"_fnvp,
-   "DropSound"_fnvp,
-   "dumpanimmaps"_fnvp,
-   "DumpMemory"_fnvp,
-   "Duration"_fnvp,
-   "DustEffect"_fnvp,
-   "DustParticleSpeed"_fnvp,
-   "DustVelocity"_fnvp,
-   "DustWake"_fnvp,
-   "Easy"_fnvp,
-   "Edge"_fnvp,
-   "EditOnly"_fnvp,
-   "editor_grasspatch"_fnvp,
-   "editor_prop_bush"_fnvp,
-   "EditorGlobalDirIconSize"_fnvp,
-   "Effect"_fnvp,
-   "EffectDamage"_fnvp,
-   "EffectFalloff"_fnvp,
-   "EffectRegion"_fnvp,
-   "EffectStrength"_fnvp,
-   "EffectType"_fnvp,
-   "EjectResistance"_fnvp,
-   "email"_fnvp,
-   "Emitter"_fnvp,
-   "EmitterOrdnance"_fnvp,
-   "Empire"_fnvp,
-   "empire_halo"_fnvp,
-   "empire_halo2"_fnvp,
-   "Empty"_fnvp,
-   "EmptyText"_fnvp,
-   "Enable"_fnvp,
-   "EnableBottom"_fnvp,
-   "Enabled"_fnvp,
-   "EnableDeathExplosions"_fnvp,
-   "EnableFadeAdjustWithZoom"_fnvp,
-   "EnableFlare"_fnvp,
-   "EnableObject"_fnvp,
-   "End"_fnvp,
-   "EndLaserGlowColor"_fnvp,
-   "EndLightColor"_fnvp,
-   "EnemyColor"_fnvp,
-   "Energy"_fnvp,
-   "EnergyAutoRestore"_fnvp,
-   "EnergyBar"_fnvp,
-   "EnergyBoostDrain"_fnvp,
-   "EnergyCost"_fnvp,
-   "EnergyCostBowling"_fnvp,
-   "EnergyCostJump"_fnvp,
-   "EnergyCostJumpSprint"_fnvp,
-   "EnergyCostRoll"_fnvp,
-   "EnergyDrain"_fnvp,
-   "EnergyDrainRate"_fnvp,
-   "EnergyDrainSprint"_fnvp,
-   "EnergyGainEffect"_fnvp,
-   "EnergyMinSprint"_fnvp,
-   "EnergyOverheat"_fnvp,
-   "EnergyRestore"_fnvp,
-   "EnergyRestoreIdle"_fnvp,
-   "EnergyRestoreRate"_fnvp,
-   "EnergyTrickDrainDoubleTap"_fnvp,
-   "EnergyTrickDrainSingleTap"_fnvp,
-   "EngineSound"_fnvp,
-   "EntityLight"_fnvp,
-   "EnvTexture"_fnvp,
-   "ERDelay"_fnvp,
-   "ERGain"_fnvp,
-   "EventAlpha"_fnvp,
-   "EventBitmap"_fnvp,
-   "EventBlend"_fnvp,
-   "EventChanged"_fnvp,
-   "EventChangeMapMode"_fnvp,
-   "EventColor"_fnvp,
-   "EventDisable"_fnvp,
-   "EventEnable"_fnvp,
-   "EventFadeOut"_fnvp,
-   "EventInput"_fnvp,
-   "EventInputFactor"_fnvp,
-   "EventMesh"_fnvp,
-   "EventNameFilter"_fnvp,
-   "EventNumber"_fnvp,
-   "EventOutput"_fnvp,
-   "EventPlayerIndex"_fnvp,
-   "EventPosition"_fnvp,
-   "EventPostHide"_fnvp,
-   "EventPulseRate"_fnvp,
-   "EventRefreshMarker"_fnvp,
-   "EventRefreshPost"_fnvp,
-   "EventRefreshTarget"_fnvp,
-   "EventResetTargetCommon"_fnvp,
-   "EventResetTargetPlayer"_fnvp,
-   "EventRotation"_fnvp,
-   "EventScale"_fnvp,
-   "EventStop"_fnvp,
-   "EventText"_fnvp,
-   "EventToggleMapMode"_fnvp,
-   "EventTrigger"_fnvp,
-   "EventValue"_fnvp,
-   "ExpireEffect"_fnvp,
-   "ExpireTimeEnemy"_fnvp,
-   "ExpireTimeField"_fnvp,
-   "Explosion"_fnvp,
-   "explosion_distant_template"_fnvp,
-   "explosion_template"_fnvp,
-   "explosion_verydistant_template"_fnvp,
-   "ExplosionBreak"_fnvp,
-   "ExplosionClass"_fnvp,
-   "ExplosionCritical"_fnvp,
-   "ExplosionDeath"_fnvp,
-   "ExplosionDestruct"_fnvp,
-   "ExplosionEffect"_fnvp,
-   "ExplosionExpire"_fnvp,
-   "ExplosionImpact"_fnvp,
-   "ExplosionName"_fnvp,
-   "ExplosionOffset"_fnvp,
-   "ExplosionTrigger"_fnvp,
-   "externlua"_fnvp,
-   "ExtremeRange"_fnvp,
-   "EyePointCenter"_fnvp,
-   "EyePointOffset"_fnvp,
-   "Fade"_fnvp,
-   "FadeDist"_fnvp,
-   "FadeFactor"_fnvp,
-   "FadeHoldTime"_fnvp,
-   "FadeInTime"_fnvp,
-   "FadeLength"_fnvp,
-   "FadeLightColor"_fnvp,
-   "FadeOutTime"_fnvp,
-   "FadePeriod"_fnvp,
-   "FadeSustainTime"_fnvp,
-   "FadeTime"_fnvp,
-   "FadeViewDistance"_fnvp,
-   "fall"_fnvp,
-   "FarMultiScreenRange"_fnvp,
-   "FarSceneRange"_fnvp,
-   "FarSplitScreenRange"_fnvp,
-   "fatray"_fnvp,
-   "fel_movies"_fnvp,
-   "fel1tran1"_fnvp,
-   "felmon01"_fnvp,
-   "felmon02"_fnvp,
-   "FIGHTER"_fnvp,
-   "File"_fnvp,
-   "FileInfo"_fnvp,
-   "Filter"_fnvp,
-   "FinalExplosion"_fnvp,
-   "FinalExplosionName"_fnvp,
-   "FinalExplosionOffset"_fnvp,
-   "FinalFrame"_fnvp,
-   "FinalWidth"_fnvp,
-   "FinAnimation"_fnvp,
-   "Fire"_fnvp,
-   "FIRE2"_fnvp,
-   "FireAnim"_fnvp,
-   "FireBoth"_fnvp,
-   "FireEmptySound"_fnvp,
-   "FireLoopSound"_fnvp,
-   "FireNodeName"_fnvp,
-   "FireOutsideLimits"_fnvp,
-   "FirePoint"_fnvp,
-   "FirePointExtraOffset"_fnvp,
-   "FirePointName"_fnvp,
-   "FireSecondary"_fnvp,
-   "Firesound"_fnvp,
-   "FireSoundStop"_fnvp,
-   "FireStateTime"_fnvp,
-   "Firestop"_fnvp,
-   "FireType"_fnvp,
-   "FireVelocity"_fnvp,
-   "FirstPerson"_fnvp,
-   "FirstPersonFOV"_fnvp,
-   "FirstRadius"_fnvp,
-   "FixedFunction"_fnvp,
-   "FixedRate"_fnvp,
-   "FlagOffScreen"_fnvp,
-   "FlagOffScreenBehind"_fnvp,
-   "FlagOnScreen"_fnvp,
-   "FlagOnScreenBehind"_fnvp,
-   "FlareAngle"_fnvp,
-   "FlareIntensity"_fnvp,
-   "FlareOutSize"_fnvp,
-   "FlashColor"_fnvp,
-   "FlashLength"_fnvp,
-   "FlashLightColor"_fnvp,
-   "FlashLightDuration"_fnvp,
-   "FlashLightRadius"_fnvp,
-   "FlashRadius"_fnvp,
-   "FlashWidth"_fnvp,
-   "FlashyDecFadeOutTime"_fnvp,
-   "FlashyIncFadeOutTime"_fnvp,
-   "FlashyScale"_fnvp,
-   "FlatCount"_fnvp,
-   "FlatFaceFactor"_fnvp,
-   "FlatGrassSwing"_fnvp,
-   "FlatHeight"_fnvp,
-   "FlatInfo"_fnvp,
-   "FlatShadowHeight"_fnvp,
-   "FlatSizeMultiplier"_fnvp,
-   "FleeLikeAHero"_fnvp,
-   "FleeSound"_fnvp,
-   "Flicker"_fnvp,
-   "FlickerAmplitude"_fnvp,
-   "FlickerPeriod"_fnvp,
-   "FlickerTimeMax"_fnvp,
-   "FlickerTimeMin"_fnvp,
-   "FlickerType"_fnvp,
-   "Flip"_fnvp,
-   "FlipSound"_fnvp,
-   "FloatFormat"_fnvp,
-   "FloatsOnWater"_fnvp,
-   "fly"_fnvp,
-   "flyer"_fnvp,
-   "flyer_eng_hi-mid_template"_fnvp,
-   "flyer_eng_low_template"_fnvp,
-   "flyer_foley_template"_fnvp,
-   "flyer_shift_template"_fnvp,
-   "flyer_trick_template"_fnvp,
-   "flyer_weapon_template"_fnvp,
-   "FlyerBan"_fnvp,
-   "FlyerSection"_fnvp,
-   "FlyerSpray"_fnvp,
-   "flythrough_template"_fnvp,
-   "FoamTexture"_fnvp,
-   "FoamTile"_fnvp,
-   "FogColor"_fnvp,
-   "FogFar"_fnvp,
-   "FogNear"_fnvp,
-   "FogRamp"_fnvp,
-   "FogRange"_fnvp,
-   "FoleyFX"_fnvp,
-   "FoleyFXClass"_fnvp,
-   "FoleyFXGroup"_fnvp,
-   "FoleyFXImpact"_fnvp,
-   "FoleyFXSoldier"_fnvp,
-   "FoleyFXWalker"_fnvp,
-   "foliage_collision"_fnvp,
-   "Follow"_fnvp,
-   "font"_fnvp,
-   "FootBoneLeft"_fnvp,
-   "FootBoneRight"_fnvp,
-   "FootSlideEffect"_fnvp,
-   "Footstep0Sound"_fnvp,
-   "Footstep1Sound"_fnvp,
-   "Footstep2Sound"_fnvp,
-   "FootstepLeftRun"_fnvp,
-   "FootstepLeftStop"_fnvp,
-   "FootstepLeftWalk"_fnvp,
-   "FootstepRightRun"_fnvp,
-   "FootstepRightStop"_fnvp,
-   "FootstepRightWalk"_fnvp,
-   "FootstepSound0"_fnvp,
-   "FootstepSound1"_fnvp,
-   "FootstepSound2"_fnvp,
-   "FootstepSound3"_fnvp,
-   "FootstepSound4"_fnvp,
-   "FootstepSound5"_fnvp,
-   "FootstepStride"_fnvp,
-   "FootWaterSplashEffect"_fnvp,
-   "ForceBoot"_fnvp,
-   "ForceFireAnimation"_fnvp,
-   "ForceHiDetail"_fnvp,
-   "ForceLockAimerToParentAimer"_fnvp,
-   "ForceMode"_fnvp,
-   "Format"_fnvp,
-   "Forward"_fnvp,
-   "ForwardSpeed"_fnvp,
-   "ForwardTurnSpeed"_fnvp,
-   "fountain_halo"_fnvp,
-   "FourSegmentLockOn"_fnvp,
-   "FOVEffect1st"_fnvp,
-   "FOVEffect3rd"_fnvp,
-   "FOVEFFectMaxCamOffset3rd"_fnvp,
-   "FOVEFFectMinCamOffset3rd"_fnvp,
-   "FPModelAttachedtoCam"_fnvp,
-   "FPPosePointName"_fnvp,
-   "FPWalkScale"_fnvp,
-   "FrameLock"_fnvp,
-   "FrameRate"_fnvp,
-   "Frames"_fnvp,
-   "FrameSize"_fnvp,
-   "FreeFlyTime"_fnvp,
-   "Frequency"_fnvp,
-   "FresnelMinMax"_fnvp,
-   "Friction"_fnvp,
-   "friend"_fnvp,
-   "FriendlyColor"_fnvp,
-   "friendvoice"_fnvp,
-   "FromAnim"_fnvp,
-   "FromEdge"_fnvp,
-   "FromEnd"_fnvp,
-   "FromSoldier"_fnvp,
-   "FULL"_fnvp,
-   "FullBody"_fnvp,
-   "FXName"_fnvp,
-   "Gain"_fnvp,
-   "GainDev"_fnvp,
-   "gal_sfx_assaultship_exp"_fnvp,
-   "gal_sfx_cruiser_exp"_fnvp,
-   "gal_sfx_fedcruiser_exp"_fnvp,
-   "gal_sfx_moncalamaricruiser_exp"_fnvp,
-   "gal_sfx_stardestroyer_exp"_fnvp,
-   "GAL1"_fnvp,
-   "gam_inf_axe"_fnvp,
-   "gamefont_small"_fnvp,
-   "GameName"_fnvp,
-   "GameSlice"_fnvp,
-   "GammaBrightness"_fnvp,
-   "GammaColorBalance"_fnvp,
-   "GammaContrast"_fnvp,
-   "GammaCorrection"_fnvp,
-   "GammaHue"_fnvp,
-   "gcw_music"_fnvp,
-   "gcwinall1"_fnvp,
-   "GCwinCIS1"_fnvp,
-   "GCwinIMP1"_fnvp,
-   "GCwinREP1"_fnvp,
-   "geo_inf_acklay"_fnvp,
-   "geo_movies"_fnvp,
-   "geo_sfx_weap_blunderbluss_ord"_fnvp,
-   "geo_sfx_weap_blunderbuss_ord"_fnvp,
-   "geo_wingsfly"_fnvp,
-   "Geometry"_fnvp,
-   "GeometryAddon"_fnvp,
-   "GeometryColor"_fnvp,
-   "GeometryColorMax"_fnvp,
-   "GeometryColorMin"_fnvp,
-   "GeometryHeight"_fnvp,
-   "GeometryLowRes"_fnvp,
-   "GeometryName"_fnvp,
-   "geometryScale"_fnvp,
-   "geomon01"_fnvp,
-   "geomon02"_fnvp,
-   "global"_fnvp,
-   "GlobalLights"_fnvp,
-   "Glow"_fnvp,
-   "GlowAlphaBase"_fnvp,
-   "GlowAlphaScale"_fnvp,
-   "GlowFactor"_fnvp,
-   "GlowLength"_fnvp,
-   "GlowScaleSize"_fnvp,
-   "GlowThreshold"_fnvp,
-   "GodRay"_fnvp,
-   "GrapplingHook"_fnvp,
-   "GrapplingHookWeapon"_fnvp,
-   "grasspatch"_fnvp,
-   "Gravity"_fnvp,
-   "GravityScale"_fnvp,
-   "GravityVelocityTarget"_fnvp,
-   "Green"_fnvp,
-   "green_blaster_bolt"_fnvp,
-   "green_blaster_bolt_small"_fnvp,
-   "grenade"_fnvp,
-   "GroundedHeight"_fnvp,
-   "GroundedSound"_fnvp,
-   "GroundEffect"_fnvp,
-   "GroundEffectsPerSec"_fnvp,
-   "GroundEffectSpread"_fnvp,
-   "Group"_fnvp,
-   "GuidedMissile"_fnvp,
-   "GuidedMissileBoostExplosionSpeedThreshold"_fnvp,
-   "GuidedMissileDamage"_fnvp,
-   "GuidedMissileDamageBoost"_fnvp,
-   "GuidedMissileDeathCamMinDistance"_fnvp,
-   "GuidedMissileDeathCamPause"_fnvp,
-   "GuidedMissileDeathCamPullbackSpeed"_fnvp,
-   "hailfire_wake"_fnvp,
-   "HAlign"_fnvp,
-   "Halo"_fnvp,
-   "HaloFadeFactor"_fnvp,
-   "HaloFadeLength"_fnvp,
-   "HaloInnerRing"_fnvp,
-   "HaloMiddleRing"_fnvp,
-   "HaloOutterRing"_fnvp,
-   "HaloRadius"_fnvp,
-   "hard"_fnvp,
-   "HardEdge"_fnvp,
-   "Hardpoint"_fnvp,
-   "Haywire"_fnvp,
-   "hcenter"_fnvp,
-   "hdd"_fnvp,
-   "Head"_fnvp,
-   "HealthGainEffect"_fnvp,
-   "HealthScale"_fnvp,
-   "HealthSScale"_fnvp,
-   "HealthTexture"_fnvp,
-   "HealthType"_fnvp,
-   "HealthTypeForLockOn"_fnvp,
-   "HeardEnemySound"_fnvp,
-   "HeatPerShot"_fnvp,
-   "HeatRecoverRate"_fnvp,
-   "HeatThreshold"_fnvp,
-   "Heavy"_fnvp,
-   "Height"_fnvp,
-   "HeightScale"_fnvp,
-   "her"_fnvp,
-   "hero"_fnvp,
-   "Hero_battle_chatter_template"_fnvp,
-   "HeroDefeated"_fnvp,
-   "heroes"_fnvp,
-   "HeroesUnlocked"_fnvp,
-   "HeroRulePlayer"_fnvp,
-   "HeroRuleRespawn"_fnvp,
-   "HeroRuleRespawnValue"_fnvp,
-   "HeroRuleTeam"_fnvp,
-   "HeroRuleUnlock"_fnvp,
-   "HeroRuleUnlockValue"_fnvp,
-   "HeroSpawned"_fnvp,
-   "HFReference"_fnvp,
-   "HideHealthBar"_fnvp,
-   "HideOnEmpty"_fnvp,
-   "HideOnFire"_fnvp,
-   "HideUnbuiltModel"_fnvp,
-   "HidingSound"_fnvp,
-   "HierarchyLevel"_fnvp,
-   "HighResGeometry"_fnvp,
-   "HintFlagOffScreen"_fnvp,
-   "HintFlagOffScreenBehind"_fnvp,
-   "HintFlagOnScreen"_fnvp,
-   "HintFlagOnScreenBehind"_fnvp,
-   "HintOffScreen"_fnvp,
-   "HintOffScreenBehind"_fnvp,
-   "HintOnScreen"_fnvp,
-   "HintOnScreenBehind"_fnvp,
-   "HitEffect"_fnvp,
-   "HitLocation"_fnvp,
-   "HitSound"_fnvp,
-   "Hold"_fnvp,
-   "HoldRelease"_fnvp,
-   "HoloBeamInitialWidth"_fnvp,
-   "HoloBeamIntensity"_fnvp,
-   "HoloFadeInTime"_fnvp,
-   "HoloFlareIntensity"_fnvp,
-   "HoloFlickerAlphaMax"_fnvp,
-   "HoloFlickerAlphaMin"_fnvp,
-   "HoloFlickerRate"_fnvp,
-   "hologram"_fnvp,
-   "HoloHeight"_fnvp,
-   "HoloImageGeometry"_fnvp,
-   "HoloImageIntensity"_fnvp,
-   "HoloLightIntensity"_fnvp,
-   "HoloLightRadius"_fnvp,
-   "HoloOdf"_fnvp,
-   "HoloPopRate"_fnvp,
-   "HoloRotateRate"_fnvp,
-   "HoloSize"_fnvp,
-   "HoloTurnOnDistance"_fnvp,
-   "HoloTurnOnTime"_fnvp,
-   "HoloType"_fnvp,
-   "HoloVisibleDistance"_fnvp,
-   "HomeRegion"_fnvp,
-   "HorizonAngleMinMax"_fnvp,
-   "HorizontalSpread"_fnvp,
-   "hot_inf_wampa"_fnvp,
-   "hot_movies"_fnvp,
-   "hot_sfx_weap_pawsmash"_fnvp,
-   "hot_sfx_weap_smash"_fnvp,
-   "hot1cam1"_fnvp,
-   "hot1cam2"_fnvp,
-   "hot1tran1"_fnvp,
-   "hotmon01"_fnvp,
-   "hotmon02"_fnvp,
-   "hover"_fnvp,
-   "HoverBan"_fnvp,
-   "HrPlayer"_fnvp,
-   "HrRespawn"_fnvp,
-   "HrRespawnValue"_fnvp,
-   "HrTeam"_fnvp,
-   "HrUnlock"_fnvp,
-   "HrUnlockValue"_fnvp,
-   "hud"_fnvp,
-   "HUDIndex"_fnvp,
-   "HUDIndexDisplay"_fnvp,
-   "HUDModel"_fnvp,
-   "HUDTag"_fnvp,
-   "hudtransforms"_fnvp,
-   "Hue"_fnvp,
-   "HugeBan"_fnvp,
-   "HurtFallSound"_fnvp,
-   "HurtOwner"_fnvp,
-   "HurtSound"_fnvp,
-   "HydraulicLowerHeight"_fnvp,
-   "HydraulicLowerSound"_fnvp,
-   "HydraulicSound"_fnvp,
-   "HydraulicSoundHeight"_fnvp,
-   "I"_fnvp,
-   "i3dl2reverb"_fnvp,
-   "I3DL2ReverbPreset"_fnvp,
-   "IconTexture"_fnvp,
-   "IdleAnimation"_fnvp,
-   "IdleDelay"_fnvp,
-   "IdleRotateSpeed"_fnvp,
-   "IdleWaitTime"_fnvp,
-   "IdleWobbleFactor"_fnvp,
-   "IdleWobbleLeftFoot"_fnvp,
-   "IdleWobbleNode"_fnvp,
-   "IdleWobbleRightFoot"_fnvp,
-   "If"_fnvp,
-   "ifs.movies.corintro.line01"_fnvp,
-   "ifs.movies.corintro.line02"_fnvp,
-   "ifs.movies.corintro.line03"_fnvp,
-   "ifs.movies.corintro.line04"_fnvp,
-   "ifs.movies.corintro.line05"_fnvp,
-   "ifs.movies.corintro.line06"_fnvp,
-   "ifs.movies.corintro.line07"_fnvp,
-   "ifs.movies.corintro.line08"_fnvp,
-   "ifs.movies.corintro.line09"_fnvp,
-   "ifs.movies.coroutro.line01"_fnvp,
-   "ifs.movies.coroutro.line02"_fnvp,
-   "ifs.movies.coroutro.line03"_fnvp,
-   "ifs.movies.coroutro.line04"_fnvp,
-   "ifs.movies.coroutro.line05"_fnvp,
-   "ifs.movies.coroutro.line06"_fnvp,
-   "ifs.movies.coroutro.line07"_fnvp,
-   "ifs.movies.coroutro.line08"_fnvp,
-   "ifs.movies.deaintro.line01"_fnvp,
-   "ifs.movies.deaintro.line02"_fnvp,
-   "ifs.movies.deaintro.line03"_fnvp,
-   "ifs.movies.deaintro.line04"_fnvp,
-   "ifs.movies.deaintro.line05"_fnvp,
-   "ifs.movies.deaintro.line06"_fnvp,
-   "ifs.movies.deaintro.line07"_fnvp,
-   "ifs.movies.deaoutro.line01"_fnvp,
-   "ifs.movies.deaoutro.line02"_fnvp,
-   "ifs.movies.deaoutro.line03"_fnvp,
-   "ifs.movies.deaoutro.line04"_fnvp,
-   "ifs.movies.deaoutro.line05"_fnvp,
-   "ifs.movies.deaoutro.line06"_fnvp,
-   "ifs.movies.deaoutro.line07"_fnvp,
-   "ifs.movies.felintro.line01"_fnvp,
-   "ifs.movies.felintro.line02"_fnvp,
-   "ifs.movies.felintro.line03"_fnvp,
-   "ifs.movies.felintro.line04"_fnvp,
-   "ifs.movies.felintro.line05"_fnvp,
-   "ifs.movies.felintro.line06"_fnvp,
-   "ifs.movies.felintro.line07"_fnvp,
-   "ifs.movies.felintro.line08"_fnvp,
-   "ifs.movies.felintro.line09"_fnvp,
-   "ifs.movies.felintro.line10"_fnvp,
-   "ifs.movies.felintro.line11"_fnvp,
-   "ifs.movies.felintro.line12"_fnvp,
-   "ifs.movies.feloutro.line01"_fnvp,
-   "ifs.movies.feloutro.line02"_fnvp,
-   "ifs.movies.feloutro.line03"_fnvp,
-   "ifs.movies.feloutro.line04"_fnvp,
-   "ifs.movies.geointro.line01"_fnvp,
-   "ifs.movies.geointro.line02"_fnvp,
-   "ifs.movies.geointro.line03"_fnvp,
-   "ifs.movies.geointro.line04"_fnvp,
-   "ifs.movies.geointro.line05"_fnvp,
-   "ifs.movies.geointro.line06"_fnvp,
-   "ifs.movies.geointro.line07"_fnvp,
-   "ifs.movies.geooutro.line01"_fnvp,
-   "ifs.movies.geooutro.line02"_fnvp,
-   "ifs.movies.hotintro.line01"_fnvp,
-   "ifs.movies.hotintro.line02"_fnvp,
-   "ifs.movies.hotintro.line03"_fnvp,
-   "ifs.movies.hotintro.line04"_fnvp,
-   "ifs.movies.hotintro.line05"_fnvp,
-   "ifs.movies.hotintro.line06"_fnvp,
-   "ifs.movies.hotintro.line07"_fnvp,
-   "ifs.movies.hotintro.line08"_fnvp,
-   "ifs.movies.hotintro.line09"_fnvp,
-   "ifs.movies.hotoutro.line01"_fnvp,
-   "ifs.movies.hotoutro.line02"_fnvp,
-   "ifs.movies.hotoutro.line03"_fnvp,
-   "ifs.movies.hotoutro.line04"_fnvp,
-   "ifs.movies.hotoutro.line05"_fnvp,
-   "ifs.movies.hotoutro.line06"_fnvp,
-   "ifs.movies.hotoutro.line07"_fnvp,
-   "ifs.movies.hotoutro.line08"_fnvp,
-   "ifs.movies.hotoutro.line09"_fnvp,
-   "ifs.movies.kamintro.line01"_fnvp,
-   "ifs.movies.kamintro.line02"_fnvp,
-   "ifs.movies.kamintro.line04"_fnvp,
-   "ifs.movies.kamintro.line05"_fnvp,
-   "ifs.movies.kamintro.line06"_fnvp,
-   "ifs.movies.kamintro.line07"_fnvp,
-   "ifs.movies.kamoutro.line01"_fnvp,
-   "ifs.movies.kamoutro.line02"_fnvp,
-   "ifs.movies.kamoutro.line03"_fnvp,
-   "ifs.movies.kamoutro.line04"_fnvp,
-   "ifs.movies.kamoutro.line05"_fnvp,
-   "ifs.movies.kamoutro.line06"_fnvp,
-   "ifs.movies.kamoutro.line07"_fnvp,
-   "ifs.movies.kasintro.line01"_fnvp,
-   "ifs.movies.kasintro.line02"_fnvp,
-   "ifs.movies.kasintro.line03"_fnvp,
-   "ifs.movies.kasintro.line04"_fnvp,
-   "ifs.movies.kasintro.line05"_fnvp,
-   "ifs.movies.kasintro.line06"_fnvp,
-   "ifs.movies.kasintro.line07"_fnvp,
-   "ifs.movies.kasintro.line08"_fnvp,
-   "ifs.movies.kasintro.line09"_fnvp,
-   "ifs.movies.kasintro.line10"_fnvp,
-   "ifs.movies.kasintro.line11"_fnvp,
-   "ifs.movies.kasintro.line12"_fnvp,
-   "ifs.movies.kasintro.line13"_fnvp,
-   "ifs.movies.kasintro.line14"_fnvp,
-   "ifs.movies.kasoutro.line01"_fnvp,
-   "ifs.movies.kasoutro.line02"_fnvp,
-   "ifs.movies.kasoutro.line03"_fnvp,
-   "ifs.movies.kasoutro.line04"_fnvp,
-   "ifs.movies.kasoutro.line05"_fnvp,
-   "ifs.movies.musintro.line01"_fnvp,
-   "ifs.movies.musintro.line02"_fnvp,
-   "ifs.movies.musintro.line03"_fnvp,
-   "ifs.movies.musintro.line04"_fnvp,
-   "ifs.movies.musintro.line05"_fnvp,
-   "ifs.movies.musintro.line06"_fnvp,
-   "ifs.movies.musintro.line07"_fnvp,
-   "ifs.movies.musintro.line08"_fnvp,
-   "ifs.movies.musintro.line09"_fnvp,
-   "ifs.movies.musoutro.line01"_fnvp,
-   "ifs.movies.musoutro.line02"_fnvp,
-   "ifs.movies.musoutro.line03"_fnvp,
-   "ifs.movies.musoutro.line04"_fnvp,
-   "ifs.movies.mygintro.line01"_fnvp,
-   "ifs.movies.mygintro.line02"_fnvp,
-   "ifs.movies.mygintro.line03"_fnvp,
-   "ifs.movies.mygintro.line04"_fnvp,
-   "ifs.movies.mygintro.line05"_fnvp,
-   "ifs.movies.mygintro.line06"_fnvp,
-   "ifs.movies.mygintro.line07"_fnvp,
-   "ifs.movies.mygintro.line08"_fnvp,
-   "ifs.movies.mygintro.line09"_fnvp,
-   "ifs.movies.mygintro.line10"_fnvp,
-   "ifs.movies.mygintro.line11"_fnvp,
-   "ifs.movies.mygintro.line13"_fnvp,
-   "ifs.movies.mygintro.line14"_fnvp,
-   "ifs.movies.mygintro.line15"_fnvp,
-   "ifs.movies.mygoutro.line01"_fnvp,
-   "ifs.movies.mygoutro.line02"_fnvp,
-   "ifs.movies.mygoutro.line03"_fnvp,
-   "ifs.movies.mygoutro.line04"_fnvp,
-   "ifs.movies.mygoutro.line05"_fnvp,
-   "ifs.movies.nabintro.line01"_fnvp,
-   "ifs.movies.nabintro.line02"_fnvp,
-   "ifs.movies.nabintro.line03"_fnvp,
-   "ifs.movies.nabintro.line04"_fnvp,
-   "ifs.movies.nabintro.line05"_fnvp,
-   "ifs.movies.nabintro.line06"_fnvp,
-   "ifs.movies.nabintro.line07"_fnvp,
-   "ifs.movies.nabintro.line08"_fnvp,
-   "ifs.movies.nabintro.line09"_fnvp,
-   "ifs.movies.nabintro.line10"_fnvp,
-   "ifs.movies.nabintro.line11"_fnvp,
-   "ifs.movies.nabintro.line12"_fnvp,
-   "ifs.movies.nabintro.line13"_fnvp,
-   "ifs.movies.nabintro.line14"_fnvp,
-   "ifs.movies.nabintro.line15"_fnvp,
-   "ifs.movies.naboutro.line01"_fnvp,
-   "ifs.movies.naboutro.line02"_fnvp,
-   "ifs.movies.naboutro.line03"_fnvp,
-   "ifs.movies.naboutro.line04"_fnvp,
-   "ifs.movies.naboutro.line05"_fnvp,
-   "ifs.movies.naboutro.line06"_fnvp,
-   "ifs.movies.polintro.line01"_fnvp,
-   "ifs.movies.polintro.line02"_fnvp,
-   "ifs.movies.polintro.line03"_fnvp,
-   "ifs.movies.polintro.line04"_fnvp,
-   "ifs.movies.polintro.line05"_fnvp,
-   "ifs.movies.polintro.line06"_fnvp,
-   "ifs.movies.polintro.line07"_fnvp,
-   "ifs.movies.polintro.line08"_fnvp,
-   "ifs.movies.polintro.line09"_fnvp,
-   "ifs.movies.polintro.line10"_fnvp,
-   "ifs.movies.polintro.line11"_fnvp,
-   "ifs.movies.poloutro.line01"_fnvp,
-   "ifs.movies.poloutro.line02"_fnvp,
-   "ifs.movies.poloutro.line03"_fnvp,
-   "ifs.movies.sb1intro.line01"_fnvp,
-   "ifs.movies.sb1intro.line02"_fnvp,
-   "ifs.movies.sb1intro.line03"_fnvp,
-   "ifs.movies.sb1intro.line04"_fnvp,
-   "ifs.movies.sb1intro.line05"_fnvp,
-   "ifs.movies.sb1intro.line06"_fnvp,
-   "ifs.movies.sb1intro.line07"_fnvp,
-   "ifs.movies.sb1intro.line08"_fnvp,
-   "ifs.movies.sb1intro.line09"_fnvp,
-   "ifs.movies.sb1intro.line10"_fnvp,
-   "ifs.movies.sb1intro.line11"_fnvp,
-   "ifs.movies.sb1outro.line01"_fnvp,
-   "ifs.movies.sb1outro.line02"_fnvp,
-   "ifs.movies.sb1outro.line03"_fnvp,
-   "ifs.movies.sb1outro.line04"_fnvp,
-   "ifs.movies.sb2intro.line01"_fnvp,
-   "ifs.movies.sb2intro.line02"_fnvp,
-   "ifs.movies.sb2intro.line03"_fnvp,
-   "ifs.movies.sb2intro.line04"_fnvp,
-   "ifs.movies.sb2intro.line05"_fnvp,
-   "ifs.movies.sb2outro.line01"_fnvp,
-   "ifs.movies.sb2outro.line02"_fnvp,
-   "ifs.movies.sb2outro.line03"_fnvp,
-   "ifs.movies.sb2outro.line04"_fnvp,
-   "ifs.movies.sb3intro.line01"_fnvp,
-   "ifs.movies.sb3intro.line02"_fnvp,
-   "ifs.movies.sb3intro.line03"_fnvp,
-   "ifs.movies.sb3intro.line04"_fnvp,
-   "ifs.movies.sb3intro.line05"_fnvp,
-   "ifs.movies.sb3intro.line06"_fnvp,
-   "ifs.movies.sb3intro.line07"_fnvp,
-   "ifs.movies.sb3intro.line08"_fnvp,
-   "ifs.movies.sb3intro.line09"_fnvp,
-   "ifs.movies.sb3intro.line10"_fnvp,
-   "ifs.movies.sb3outro.line01"_fnvp,
-   "ifs.movies.sb3outro.line02"_fnvp,
-   "ifs.movies.sb3outro.line03"_fnvp,
-   "ifs.movies.sb4intro.line01"_fnvp,
-   "ifs.movies.sb4intro.line02"_fnvp,
-   "ifs.movies.sb4intro.line03"_fnvp,
-   "ifs.movies.sb4intro.line04"_fnvp,
-   "ifs.movies.sb4intro.line05"_fnvp,
-   "ifs.movies.sb4intro.line06"_fnvp,
-   "ifs.movies.sb4intro.line07"_fnvp,
-   "ifs.movies.sb4intro.line08"_fnvp,
-   "ifs.movies.sb4intro.line09"_fnvp,
-   "ifs.movies.sb4outro.line01"_fnvp,
-   "ifs.movies.sb4outro.line02"_fnvp,
-   "ifs.movies.sb4outro.line03"_fnvp,
-   "ifs.movies.sb4outro.line04"_fnvp,
-   "ifs.movies.tanintro.line01"_fnvp,
-   "ifs.movies.tanintro.line02"_fnvp,
-   "ifs.movies.tanintro.line03"_fnvp,
-   "ifs.movies.tanintro.line04"_fnvp,
-   "ifs.movies.tanintro.line05"_fnvp,
-   "ifs.movies.tanintro.line06"_fnvp,
-   "ifs.movies.tanintro.line07"_fnvp,
-   "ifs.movies.tanintro.line08"_fnvp,
-   "ifs.movies.tanintro.line09"_fnvp,
-   "ifs.movies.tanintro.line10"_fnvp,
-   "ifs.movies.tanoutro.line01"_fnvp,
-   "ifs.movies.tanoutro.line02"_fnvp,
-   "ifs.movies.tanoutro.line03"_fnvp,
-   "ifs.movies.tanoutro.line04"_fnvp,
-   "ifs.movies.tanoutro.line05"_fnvp,
-   "ifs.movies.tanoutro.line06"_fnvp,
-   "ifs.movies.training.line01"_fnvp,
-   "ifs.movies.training.line02"_fnvp,
-   "ifs.movies.training.line03"_fnvp,
-   "ifs.movies.training.line04"_fnvp,
-   "ifs.movies.training.line05"_fnvp,
-   "ifs.movies.training.line06"_fnvp,
-   "ifs.movies.training.line07"_fnvp,
-   "ifs.movies.training.line08"_fnvp,
-   "ifs.movies.training.line09"_fnvp,
-   "ifs.movies.training.line10"_fnvp,
-   "ifs.movies.training.line11"_fnvp,
-   "ifs.movies.training.line12"_fnvp,
-   "ifs.movies.training.line13"_fnvp,
-   "ifs.movies.training.line14"_fnvp,
-   "ifs.movies.training.line15"_fnvp,
-   "ifs.movies.training.line16"_fnvp,
-   "ifs.movies.training.line17"_fnvp,
-   "ifs.movies.training.line18"_fnvp,
-   "ifs.movies.training.line19"_fnvp,
-   "ifs.movies.training.line20"_fnvp,
-   "ifs.movies.utaintro.line01"_fnvp,
-   "ifs.movies.utaintro.line02"_fnvp,
-   "ifs.movies.utaintro.line03"_fnvp,
-   "ifs.movies.utaintro.line04"_fnvp,
-   "ifs.movies.utaintro.line05"_fnvp,
-   "ifs.movies.utaintro.line06"_fnvp,
-   "ifs.movies.utaintro.line07"_fnvp,
-   "ifs.movies.utaintro.line08"_fnvp,
-   "ifs.movies.utaoutro.line01"_fnvp,
-   "ifs.movies.utaoutro.line02"_fnvp,
-   "ifs.movies.utaoutro.line03"_fnvp,
-   "ifs.movies.utaoutro.line04"_fnvp,
-   "ifs.movies.yavintro.line01"_fnvp,
-   "ifs.movies.yavintro.line02"_fnvp,
-   "ifs.movies.yavintro.line03"_fnvp,
-   "ifs.movies.yavintro.line04"_fnvp,
-   "ifs.movies.yavintro.line05"_fnvp,
-   "ifs.movies.yavintro.line06"_fnvp,
-   "ifs.movies.yavintro.line07"_fnvp,
-   "ifs.movies.yavoutro.line01"_fnvp,
-   "ifs.movies.yavoutro.line02"_fnvp,
-   "ifs.movies.yavoutro.line03"_fnvp,
-   "IgnorableCollision"_fnvp,
-   "IgnorableCollsion"_fnvp,
-   "IgnoreHintNodes"_fnvp,
-   "ImmuneToMines"_fnvp,
-   "imp"_fnvp,
-   "imp_hero_darthvader"_fnvp,
-   "imp_hero_emperor"_fnvp,
-   "imp_sfx_atatexplosion"_fnvp,
-   "imp_sfx_atatfinalexplosion"_fnvp,
-   "imp_sfx_jetpack"_fnvp,
-   "imp_sfx_jetpack_darktrooper"_fnvp,
-   "imp_sfx_weap_sonicblast_ord"_fnvp,
-   "imp_sfx_weap_wristrocket_gold"_fnvp,
-   "Impact"_fnvp,
-   "impact_template"_fnvp,
-   "ImpactDecalStatic"_fnvp,
-   "ImpactDecalTerrain"_fnvp,
-   "ImpactEffect"_fnvp,
-   "ImpactEffectRigid"_fnvp,
-   "ImpactEffectShield"_fnvp,
-   "ImpactEffectShieldLarge"_fnvp,
-   "ImpactEffectShieldSmall"_fnvp,
-   "ImpactEffectSoft"_fnvp,
-   "ImpactEffectStatic"_fnvp,
-   "ImpactEffectTerrain"_fnvp,
-   "ImpactEffectWater"_fnvp,
-   "ImpMusic"_fnvp,
-   "Impulse"_fnvp,
-   "InDirectionFactor"_fnvp,
-   "InfiniteDashes"_fnvp,
-   "InFlyer"_fnvp,
-   "ingame"_fnvp,
-   "ingame_movies"_fnvp,
-   "ingame_spawnducked"_fnvp,
-   "ingame_template"_fnvp,
-   "ingamemusic"_fnvp,
-   "Inherit"_fnvp,
-   "InheritMeshInfo"_fnvp,
-   "InheritVelocityFactor"_fnvp,
-   "InHover"_fnvp,
-   "Initial"_fnvp,
-   "InitialCableLength"_fnvp,
-   "InitialEnergyDrain"_fnvp,
-   "InitialFlareOutAlpha"_fnvp,
-   "InitialSalvoDelay"_fnvp,
-   "InitialSalvoDelayProne"_fnvp,
-   "InitialSalvoDelayUnderhand"_fnvp,
-   "InitialWidth"_fnvp,
-   "InputFactor"_fnvp,
-   "InputLock"_fnvp,
-   "Install"_fnvp,
-   "InstantPlayFireAnim"_fnvp,
-   "IntegerFormat"_fnvp,
-   "Intensity"_fnvp,
-   "InterpolationSpeed"_fnvp,
-   "InTurret"_fnvp,
-   "invincible"_fnvp,
-   "InvincibleEffect"_fnvp,
-   "InvisibilityDecRate"_fnvp,
-   "InvisibilityIncRate"_fnvp,
-   "InvisibilityMax"_fnvp,
-   "InvisibilityMin"_fnvp,
-   "InvisibilityPersistTime"_fnvp,
-   "InvisibilityTrigger"_fnvp,
-   "InWalker"_fnvp,
-   "IsAcklay"_fnvp,
-   "IsCollidable"_fnvp,
-   "IsFlyer"_fnvp,
-   "IsHero"_fnvp,
-   "IsHover"_fnvp,
-   "IsLocked"_fnvp,
-   "IsNotTargetableByPlayer"_fnvp,
-   "IsPilotExposed"_fnvp,
-   "IsProne"_fnvp,
-   "IsRocket"_fnvp,
-   "IsSniper"_fnvp,
-   "IsTurret"_fnvp,
-   "IsVisible"_fnvp,
-   "IsWalker"_fnvp,
-   "IsZoomed"_fnvp,
-   "Jet"_fnvp,
-   "JetAcceleration"_fnvp,
-   "JetDuration"_fnvp,
-   "JetEffect"_fnvp,
-   "JetEnergyDrain"_fnvp,
-   "JetFuelCost"_fnvp,
-   "JetFuelInitialCost"_fnvp,
-   "JetFuelMinBorder"_fnvp,
-   "JetFuelRechargeRate"_fnvp,
-   "JetIdleEffect"_fnvp,
-   "JetJump"_fnvp,
-   "JetPush"_fnvp,
-   "JetShowHud"_fnvp,
-   "JetType"_fnvp,
-   "Jitter"_fnvp,
-   "Jump"_fnvp,
-   "JumpDeduction"_fnvp,
-   "JumpEnergyPerSec"_fnvp,
-   "JumpForce"_fnvp,
-   "JumpForwardSpeedBoost"_fnvp,
-   "JumpForwardSpeedFactor"_fnvp,
-   "JumpHeight"_fnvp,
-   "JumpMinSpeed"_fnvp,
-   "JumpMinSpeedMult"_fnvp,
-   "JumpSound"_fnvp,
-   "JumpStrafeSpeedFactor"_fnvp,
-   "JumpTimeMax"_fnvp,
-   "JumpTimeMin"_fnvp,
-   "jungle1"_fnvp,
-   "jungle2"_fnvp,
-   "jungle3"_fnvp,
-   "jungle4"_fnvp,
-   "jungle5"_fnvp,
-   "jungle6"_fnvp,
-   "kam_movies"_fnvp,
-   "kam1tran1"_fnvp,
-   "kammon01"_fnvp,
-   "kammon02"_fnvp,
-   "kas_movies"_fnvp,
-   "kas1c_h"_fnvp,
-   "kas2tran1"_fnvp,
-   "kasmon01"_fnvp,
-   "kasmon02"_fnvp,
-   "KickBuildup"_fnvp,
-   "KickSpread"_fnvp,
-   "KickStrength"_fnvp,
-   "KillRegion"_fnvp,
-   "KillSoldierSound"_fnvp,
-   "Knot"_fnvp,
-   "Label"_fnvp,
-   "lan"_fnvp,
-   "Land"_fnvp,
-   "LandedHeight"_fnvp,
-   "LandingSpeed"_fnvp,
-   "LandingTime"_fnvp,
-   "LandOnArrival"_fnvp,
-   "LandSound"_fnvp,
-   "lang"_fnvp,
-   "large_muzzle_flash"_fnvp,
-   "LaserGlowColor"_fnvp,
-   "LaserLength"_fnvp,
-   "LaserTexture"_fnvp,
-   "LaserWidth"_fnvp,
-   "latency"_fnvp,
-   "launcher"_fnvp,
-   "Layer"_fnvp,
-   "Leaf"_fnvp,
-   "LeafFall"_fnvp,
-   "LeafPatch"_fnvp,
-   "Left"_fnvp,
-   "LeftFootstepSound"_fnvp,
-   "LegBoneLeft"_fnvp,
-   "LegBoneRight"_fnvp,
-   "LegBoneTopLeft"_fnvp,
-   "LegBoneTopRight"_fnvp,
-   "LegPairCount"_fnvp,
-   "LegRayHitLength"_fnvp,
-   "Length"_fnvp,
-   "LevelDamp"_fnvp,
-   "LevelFilter"_fnvp,
-   "LevelFilterLanding"_fnvp,
-   "LevelSpring"_fnvp,
-   "LifeSpan"_fnvp,
-   "LifeTime"_fnvp,
-   "LiftDamp"_fnvp,
-   "LiftSpring"_fnvp,
-   "Light"_fnvp,
-   "Light1"_fnvp,
-   "Light2"_fnvp,
-   "LightAzimAndElev"_fnvp,
-   "LightBeam"_fnvp,
-   "LightColor"_fnvp,
-   "LightDuration"_fnvp,
-   "Lighting"_fnvp,
-   "LightName"_fnvp,
-   "LightningBolt"_fnvp,
-   "LightningEffect"_fnvp,
-   "LightningEffectScale"_fnvp,
-   "LightOdf"_fnvp,
-   "LightRadius"_fnvp,
-   "LightSaberGlowTexture"_fnvp,
-   "LightSaberLength"_fnvp,
-   "LightSaberTexture"_fnvp,
-   "LightSaberTrailColor"_fnvp,
-   "LightSaberWidth"_fnvp,
-   "LimitAi"_fnvp,
-   "Load"_fnvp,
-   "load_bar"_fnvp,
-   "load_transition"_fnvp,
-   "load_xtracking"_fnvp,
-   "load_ytracking"_fnvp,
-   "load_zoom"_fnvp,
-   "LoadingTextBlinkRate"_fnvp,
-   "LoadingTextColorPallete"_fnvp,
-   "LoadSpam"_fnvp,
-   "locals"_fnvp,
-   "LocalsColor"_fnvp,
-   "LockedOffScreen"_fnvp,
-   "LockedOffScreenBehind"_fnvp,
-   "LockedOnScreen"_fnvp,
-   "LockedOnScreenBehind"_fnvp,
-   "LockedOnSound"_fnvp,
-   "LockedSound"_fnvp,
-   "LockOffAngle"_fnvp,
-   "LockOn"_fnvp,
-   "LockOnAngle"_fnvp,
-   "LockOnMaxDist"_fnvp,
-   "LockOnMaxTrackDist"_fnvp,
-   "LockOnMinDist"_fnvp,
-   "LockOnRange"_fnvp,
-   "LockOnTime"_fnvp,
-   "LockTime"_fnvp,
-   "LODDecimation"_fnvp,
-   "LodGroup"_fnvp,
-   "LODPriorityMod"_fnvp,
-   "log"_fnvp,
-   "logfinalscore"_fnvp,
-   "Loop"_fnvp,
-   "Looping"_fnvp,
-   "loss"_fnvp,
-   "LostMusic"_fnvp,
-   "LostSound"_fnvp,
-   "LowHealthSound"_fnvp,
-   "LowHealthThreshold"_fnvp,
-   "LowResModel"_fnvp,
-   "LowResPose"_fnvp,
-   "LowResTerrain"_fnvp,
-   "MagReloadTime"_fnvp,
-   "main"_fnvp,
-   "MainMain"_fnvp,
-   "MainTexture"_fnvp,
-   "Map"_fnvp,
-   "MapRangeOverall"_fnvp,
-   "MapRangeShooting"_fnvp,
-   "MapRangeViewCone"_fnvp,
-   "MapScale"_fnvp,
-   "MapSpeedMax"_fnvp,
-   "MapSpeedMin"_fnvp,
-   "MapTargetFadeRate"_fnvp,
-   "MapTexture"_fnvp,
-   "MapViewConeAngle"_fnvp,
-   "MapViewMax"_fnvp,
-   "MapViewMin"_fnvp,
-   "MarkerLarge"_fnvp,
-   "MarkerSmall"_fnvp,
-   "MarkerSpawn"_fnvp,
-   "Mask"_fnvp,
-   "MaskTexCoords"_fnvp,
-   "MaxAcceleration"_fnvp,
-   "MaxAlpha"_fnvp,
-   "MaxAngle"_fnvp,
-   "MaxBallAngle"_fnvp,
-   "MaxBranches"_fnvp,
-   "MaxChargeStrengthHeavy"_fnvp,
-   "MaxChargeStrengthLight"_fnvp,
-   "MaxDamage"_fnvp,
-   "MaxDecals"_fnvp,
-   "MaxDelayHeavy"_fnvp,
-   "MaxDelayLight"_fnvp,
-   "MaxDiffuseColor"_fnvp,
-   "MaxDist"_fnvp,
-   "MaxDistance"_fnvp,
-   "MaxEntities"_fnvp,
-   "MaxFallingLeaves"_fnvp,
-   "MaxGodraysInWorld"_fnvp,
-   "MaxGodraysOnScreen"_fnvp,
-   "MaxHealth"_fnvp,
-   "MaxHeavy"_fnvp,
-   "MaxHeavyDecay"_fnvp,
-   "MaxInterval"_fnvp,
-   "MaxItems"_fnvp,
-   "MaxJumpDistance"_fnvp,
-   "MaxLength"_fnvp,
-   "MaxLifetime"_fnvp,
-   "MaxLight"_fnvp,
-   "MaxLightDecay"_fnvp,
-   "MaxLodDist"_fnvp,
-   "MaxOmega"_fnvp,
-   "MaxParticles"_fnvp,
-   "MaxParticleScale"_fnvp,
-   "MaxPitchSpeed"_fnvp,
-   "MaxPlaybackTime"_fnvp,
-   "MaxPos"_fnvp,
-   "MaxPressedTime"_fnvp,
-   "MaxPush"_fnvp,
-   "MaxRandomSideOffset"_fnvp,
-   "MaxRange"_fnvp,
-   "MaxRaysPerGodray"_fnvp,
-   "MaxScale"_fnvp,
-   "MaxScatterBirds"_fnvp,
-   "MaxShadowLength"_fnvp,
-   "MaxShakeAmt"_fnvp,
-   "MaxShakeLen"_fnvp,
-   "MaxShield"_fnvp,
-   "MaxSize"_fnvp,
-   "MaxSkew"_fnvp,
-   "MaxSpeed"_fnvp,
-   "maxsplit"_fnvp,
-   "MaxSpread"_fnvp,
-   "MaxSquadronSize"_fnvp,
-   "maxsquadsize"_fnvp,
-   "MaxStrafeSpeed"_fnvp,
-   "MaxStrength"_fnvp,
-   "MaxTargets"_fnvp,
-   "MaxTerrainAngle"_fnvp,
-   "MaxTimeLeftHeavy"_fnvp,
-   "MaxTimeLeftLight"_fnvp,
-   "MaxTotalWeight"_fnvp,
-   "MaxTurnSpeed"_fnvp,
-   "MaxValue"_fnvp,
-   "MaxVel"_fnvp,
-   "MaxViewDistance"_fnvp,
-   "MaxYawSpeed"_fnvp,
-   "med_muzzle_flash"_fnvp,
-   "MedalsTypeToLock"_fnvp,
-   "MedalsTypeToUnlock"_fnvp,
-   "MEDIUM"_fnvp,
-   "MediumBan"_fnvp,
-   "melee"_fnvp,
-   "MemberID"_fnvp,
-   "Mesh"_fnvp,
-   "MeshInfo"_fnvp,
-   "MidSpeed"_fnvp,
-   "MinAlpha"_fnvp,
-   "MinDamage"_fnvp,
-   "MinDelayHeavy"_fnvp,
-   "MinDelayLight"_fnvp,
-   "MinDiffuseColor"_fnvp,
-   "MinDistance"_fnvp,
-   "Mindtrick"_fnvp,
-   "mine"_fnvp,
-   "MineHealth"_fnvp,
-   "MinEnemyRadius"_fnvp,
-   "MinFootHeight"_fnvp,
-   "MinHeavy"_fnvp,
-   "MinHeavyDecay"_fnvp,
-   "MinInactiveTime"_fnvp,
-   "MinInterval"_fnvp,
-   "MinLifeTime"_fnvp,
-   "MinLight"_fnvp,
-   "MinLightDecay"_fnvp,
-   "MinLodDist"_fnvp,
-   "MinMaxDepth"_fnvp,
-   "MinOmega"_fnvp,
-   "MinParticleScale"_fnvp,
-   "MinPlaybackTime"_fnvp,
-   "MinPos"_fnvp,
-   "MinPush"_fnvp,
-   "MinRange"_fnvp,
-   "MinRaysPerGodray"_fnvp,
-   "MinScale"_fnvp,
-   "MinShakeAmt"_fnvp,
-   "MinShakeLen"_fnvp,
-   "MinSize"_fnvp,
-   "MinSpeed"_fnvp,
-   "MinSpread"_fnvp,
-   "MinStrength"_fnvp,
-   "MinTimeLeftHeavy"_fnvp,
-   "MinTimeLeftLight"_fnvp,
-   "MinValue"_fnvp,
-   "MinVel"_fnvp,
-   "MirrorInfo"_fnvp,
-   "missile"_fnvp,
-   "missile_incoming"_fnvp,
-   "missile_locked_on_me"_fnvp,
-   "missile_locking_on_me"_fnvp,
-   "MissionLog"_fnvp,
-   "Mode"_fnvp,
-   "Mode3D"_fnvp,
-   "ModeDoppler"_fnvp,
-   "Model"_fnvp,
-   "Model3D"_fnvp,
-   "ModeTexture"_fnvp,
-   "ModeTextureColor"_fnvp,
-   "Modulate"_fnvp,
-   "MomentumFilter"_fnvp,
-   "MountPos"_fnvp,
-   "MouseTurnDecay"_fnvp,
-   "Move"_fnvp,
-   "MovementScale"_fnvp,
-   "MoveTension"_fnvp,
-   "MoveTensionX"_fnvp,
-   "MoveTensionY"_fnvp,
-   "MoveTensionZ"_fnvp,
-   "MoveX"_fnvp,
-   "MoveY"_fnvp,
-   "MoveZ"_fnvp,
-   "Movie"_fnvp,
-   "MovieProperties"_fnvp,
-   "moviesubtitles"_fnvp,
-   "MovingTurnOnly"_fnvp,
-   "MultilineText"_fnvp,
-   "multiworld"_fnvp,
-   "mus_movies"_fnvp,
-   "mus_sfx_blur"_fnvp,
-   "mus_sfx_droidconcept"_fnvp,
-   "mus_sfx_lavaburst"_fnvp,
-   "mus_sfx_lavaburst_xl"_fnvp,
-   "mus_sfx_lavaspray"_fnvp,
-   "mus_sfx_lavaspray_skydome"_fnvp,
-   "mus_sfx_lightningballs"_fnvp,
-   "mus_sfx_sparks"_fnvp,
-   "mus1"_fnvp,
-   "mus1_1CTF"_fnvp,
-   "mus1_BRun"_fnvp,
-   "mus1_campaign"_fnvp,
-   "mus1_CTF"_fnvp,
-   "mus1_CTFCP"_fnvp,
-   "mus1_deathreagen"_fnvp,
-   "mus1_design"_fnvp,
-   "mus1_grate2"_fnvp,
-   "mus1_mist"_fnvp,
-   "mus1_rumble"_fnvp,
-   "mus1_SoundEmitters"_fnvp,
-   "mus1_SoundRegions"_fnvp,
-   "mus1_SoundSpaces"_fnvp,
-   "mus1_TDM"_fnvp,
-   "mus1tran1"_fnvp,
-   "music"_fnvp,
-   "MusicDelay"_fnvp,
-   "MusicSpeed"_fnvp,
-   "musmon01"_fnvp,
-   "musmon02"_fnvp,
-   "MustShowOneFrame"_fnvp,
-   "mute"_fnvp,
-   "MuteDistance"_fnvp,
-   "MuzzleFlash"_fnvp,
-   "MuzzleFlashEffect"_fnvp,
-   "MuzzleFlashModel"_fnvp,
-   "myg_movies"_fnvp,
-   "myg_sfx_fire"_fnvp,
-   "myg1"_fnvp,
-   "myg1_Buildings"_fnvp,
-   "myg1_Con-VehicleSpawns"_fnvp,
-   "myg1_CP-Assault"_fnvp,
-   "myg1_cp-conquest"_fnvp,
-   "myg1_CTF"_fnvp,
-   "myg1_design"_fnvp,
-   "myg1_flags"_fnvp,
-   "myg1_Platforms"_fnvp,
-   "myg1_Rubble"_fnvp,
-   "myg1_sfx_collector"_fnvp,
-   "myg1_sfx_collector_damage1"_fnvp,
-   "myg1_sfx_collector_damage2"_fnvp,
-   "myg1_sfx_collector_damage3"_fnvp,
-   "myg1_sfx_collector_damage4"_fnvp,
-   "myg1_sfx_collector_exp"_fnvp,
-   "myg1_sfx_generator_damage1"_fnvp,
-   "myg1_sfx_generator_damage2"_fnvp,
-   "myg1_sfx_generator_damage3"_fnvp,
-   "myg1_shields"_fnvp,
-   "myg1_SoundRegions"_fnvp,
-   "myg1_Turrets"_fnvp,
-   "myg1tran1"_fnvp,
-   "mygmon01"_fnvp,
-   "mygmon02"_fnvp,
-   "nab_fireworks"_fnvp,
-   "nab_movies"_fnvp,
-   "nab_sfx_fountain"_fnvp,
-   "nab1c_h"_fnvp,
-   "nab1tran1"_fnvp,
-   "nab2_attached_lights"_fnvp,
-   "nab2_prop_treebill"_fnvp,
-   "nab2c_h"_fnvp,
-   "nabmon01"_fnvp,
-   "nabmon02"_fnvp,
-   "naboo2"_fnvp,
-   "naboo2_1Flag"_fnvp,
-   "naboo2_campaign"_fnvp,
-   "naboo2_Collision"_fnvp,
-   "naboo2_CommonDesign"_fnvp,
-   "naboo2_Conquest"_fnvp,
-   "naboo2_CTF"_fnvp,
-   "naboo2_hunt"_fnvp,
-   "naboo2_Reflections"_fnvp,
-   "naboo2_soundemitters"_fnvp,
-   "naboo2_SoundRegions"_fnvp,
-   "naboo2_TDM"_fnvp,
-   "Name"_fnvp,
-   "NameMesh"_fnvp,
-   "Near"_fnvp,
-   "NearMultiScreenRange"_fnvp,
-   "NearSceneRange"_fnvp,
-   "NearSplitScreenRange"_fnvp,
-   "NeedAmmoVO"_fnvp,
-   "NeedBackupVO"_fnvp,
-   "NeedMedicVO"_fnvp,
-   "NeedPickupVO"_fnvp,
-   "NeedRepairVO"_fnvp,
-   "nethires"_fnvp,
-   "NetPlayers"_fnvp,
-   "NetRegion"_fnvp,
-   "NetUpdateSize"_fnvp,
-   "neu"_fnvp,
-   "neutral"_fnvp,
-   "NeutralColor"_fnvp,
-   "NeutralizeTime"_fnvp,
-   "NeverCrashWhenUnpiloted"_fnvp,
-   "NewAttack"_fnvp,
-   "Next"_fnvp,
-   "NextAimer"_fnvp,
-   "NextBarrel"_fnvp,
-   "NEXTCHARGE"_fnvp,
-   "NextDropItem"_fnvp,
-   "NextIsGrouped"_fnvp,
-   "NextLinkedTerminal"_fnvp,
-   "NoAi"_fnvp,
-   "NoAIBoard"_fnvp,
-   "NoAim"_fnvp,
-   "NoAudioStreaming"_fnvp,
-   "NoChaining"_fnvp,
-   "NoCheckcd"_fnvp,
-   "NoCombatInterrupt"_fnvp,
-   "Node"_fnvp,
-   "NoDeathExplosions"_fnvp,
-   "NoDebugHeap"_fnvp,
-   "Nodes"_fnvp,
-   "NoDrag"_fnvp,
-   "NoEnterVehicles"_fnvp,
-   "NoFirstPersonFireAnim"_fnvp,
-   "NoFrameLock"_fnvp,
-   "NoIntro"_fnvp,
-   "NoiseFreq"_fnvp,
-   "NoiseRoughness"_fnvp,
-   "NoJournal"_fnvp,
-   "NoLifeSpanDisplay"_fnvp,
-   "NoMovies"_fnvp,
-   "NoNames"_fnvp,
-   "none"_fnvp,
-   "none_reformat"_fnvp,
-   "NoPoolErrors"_fnvp,
-   "NoPortals"_fnvp,
-   "NoPregame"_fnvp,
-   "NoRandomSpring"_fnvp,
-   "NoRegisterStep"_fnvp,
-   "NoRender"_fnvp,
-   "NoReverb"_fnvp,
-   "Normal"_fnvp,
-   "NormalDirection"_fnvp,
-   "NormalMapTextures"_fnvp,
-   "North"_fnvp,
-   "NorthLarge"_fnvp,
-   "NorthSmall"_fnvp,
-   "NorthSpawn"_fnvp,
-   "NoSound"_fnvp,
-   "NoStartUpMusic"_fnvp,
-   "NoTargetLightningEffectCount"_fnvp,
-   "NoTargetLightningEffectRandomSpread"_fnvp,
-   "noteamdamage"_fnvp,
-   "NotValues"_fnvp,
-   "NoWait"_fnvp,
-   "NoWaitLate"_fnvp,
-   "NTGUI"_fnvp,
-   "NumberColor"_fnvp,
-   "NumberToTime"_fnvp,
-   "NumberVector3"_fnvp,
-   "NumBloomPasses"_fnvp,
-   "NumBobPoints"_fnvp,
-   "NumChildren"_fnvp,
-   "NumChunks"_fnvp,
-   "NumDamageEdges"_fnvp,
-   "NumDustObjectsInEffects"_fnvp,
-   "NumFlareOuts"_fnvp,
-   "NumLines"_fnvp,
-   "NumObjects"_fnvp,
-   "NumParticles"_fnvp,
-   "NumParts"_fnvp,
-   "NumRays"_fnvp,
-   "NumSegments"_fnvp,
-   "NumStars"_fnvp,
-   "NumSubFlashesMinMax"_fnvp,
-   "NumTentacles"_fnvp,
-   "NumVisible"_fnvp,
-   "Object"_fnvp,
-   "ObjectiveList"_fnvp,
-   "ObjectiveOffScreen"_fnvp,
-   "ObjectiveOffScreenBehind"_fnvp,
-   "ObjectiveOnScreen"_fnvp,
-   "ObjectiveOnScreenBehind"_fnvp,
-   "ObjectVisibility"_fnvp,
-   "ObstructionHFGain"_fnvp,
-   "ObstructionLFRatio"_fnvp,
-   "OcclusionHFGain"_fnvp,
-   "OcclusionLFRatio"_fnvp,
-   "OceanEnable"_fnvp,
-   "Odf"_fnvp,
-   "offensive"_fnvp,
-   "Offhand"_fnvp,
-   "Offhand2"_fnvp,
-   "Offhand3"_fnvp,
-   "OffhandAnimation"_fnvp,
-   "OffhandFirePointName"_fnvp,
-   "OffhandGeometryName"_fnvp,
-   "OffhandWeapon"_fnvp,
-   "Offset"_fnvp,
-   "OffsetAngle"_fnvp,
-   "OffsetPath"_fnvp,
-   "OffsetUV"_fnvp,
-   "OffTime"_fnvp,
-   "OldTerrainShader"_fnvp,
-   "OmegaXDamp"_fnvp,
-   "OmegaXSpring"_fnvp,
-   "OmegaZDamp"_fnvp,
-   "OmegaZSpring"_fnvp,
-   "Omni"_fnvp,
-   "OmniLightRadius"_fnvp,
-   "OmniRadius"_fnvp,
-   "On"_fnvp,
-   "OneWorld"_fnvp,
-   "OnSound"_fnvp,
-   "OnTime"_fnvp,
-   "OpenRatio"_fnvp,
-   "OpenSound"_fnvp,
-   "OpenTrigger"_fnvp,
-   "OptimalRange"_fnvp,
-   "Or"_fnvp,
-   "Ordnance"_fnvp,
-   "ordnance_template"_fnvp,
-   "Ordnancecollision"_fnvp,
-   "OrdnanceCollisionPrim"_fnvp,
-   "OrdnanceEffect"_fnvp,
-   "OrdnanceGeometryName"_fnvp,
-   "OrdnanceName"_fnvp,
-   "OrdnanceSound"_fnvp,
-   "OscillationEnable"_fnvp,
-   "OverheatSound"_fnvp,
-   "OverheatSoundPitch"_fnvp,
-   "OverheatStopSound"_fnvp,
-   "OverrideTexture"_fnvp,
-   "OverrideTexture2"_fnvp,
-   "pain_chatter_template"_fnvp,
-   "Pan"_fnvp,
-   "Parent"_fnvp,
-   "PARTICLE"_fnvp,
-   "ParticleDensity"_fnvp,
-   "ParticleDensityRange"_fnvp,
-   "ParticleEmitter"_fnvp,
-   "ParticleLengthMaxSpeed"_fnvp,
-   "ParticleLengthMinSpeed"_fnvp,
-   "particlemass"_fnvp,
-   "ParticleSize"_fnvp,
-   "PassengerEyePoint"_fnvp,
-   "PassengerSlots"_fnvp,
-   "PassThrough"_fnvp,
-   "password"_fnvp,
-   "PatchDivisions"_fnvp,
-   "PatchResolution"_fnvp,
-   "Path"_fnvp,
-   "PathCount"_fnvp,
-   "PathFollowerAcceleration"_fnvp,
-   "PathFollowerBranchMaxAngle"_fnvp,
-   "PathFollowerBranchPaths"_fnvp,
-   "PathFollowerBranchRange"_fnvp,
-   "PathFollowerClass"_fnvp,
-   "PathFollowerClass_CTF"_fnvp,
-   "PathFollowerFlyerVsFlyer"_fnvp,
-   "PathFollowerMinBranchDist"_fnvp,
-   "PathFollowerRollAcceleration"_fnvp,
-   "PathFollowerRollAccelerationLag"_fnvp,
-   "PathFollowerRollTolerance"_fnvp,
-   "PathFollowerSpeed"_fnvp,
-   "PathRoll"_fnvp,
-   "PathSpeedType"_fnvp,
-   "PathTime"_fnvp,
-   "PathType"_fnvp,
-   "PauseTime"_fnvp,
-   "PCaxPitchSpeed"_fnvp,
-   "PCMaxPitchSpeed"_fnvp,
-   "PCMaxStrafeSpeed"_fnvp,
-   "PCMaxTurnSpeed"_fnvp,
-   "PCMaxYawSpeed"_fnvp,
-   "PCPitchRate"_fnvp,
-   "PCPitchSpeed"_fnvp,
-   "PCPitchTurnFactor"_fnvp,
-   "PCSpinRate"_fnvp,
-   "PCTurnRate"_fnvp,
-   "PCTurnSpeed"_fnvp,
-   "PCYawTurnFactor"_fnvp,
-   "PerceivedTeam"_fnvp,
-   "Percent"_fnvp,
-   "Person"_fnvp,
-   "PersonAmmo"_fnvp,
-   "PersonEnergy"_fnvp,
-   "PersonHealth"_fnvp,
-   "PersonScale"_fnvp,
-   "PhillipsConstant"_fnvp,
-   "PhysicsActive"_fnvp,
-   "PickupSound"_fnvp,
-   "Pilot"_fnvp,
-   "Pilot9Pose"_fnvp,
-   "PilotAnimation"_fnvp,
-   "PilotDeath"_fnvp,
-   "PilotPosition"_fnvp,
-   "PilotSkillRepairScale"_fnvp,
-   "PilotType"_fnvp,
-   "Pitch"_fnvp,
-   "PitchBuildupMultiplier"_fnvp,
-   "PitchDamp"_fnvp,
-   "PitchDev"_fnvp,
-   "PitchFactor"_fnvp,
-   "PitchFilter"_fnvp,
-   "PitchFilterDecel"_fnvp,
-   "PitchLimits"_fnvp,
-   "PitchRate"_fnvp,
-   "PitchSpread"_fnvp,
-   "PitchTurnFactor"_fnvp,
-   "PlantedHash"_fnvp,
-   "Playback"_fnvp,
-   "PlayEffectOnOwner"_fnvp,
-   "PlayEffectOnOwnerAimer"_fnvp,
-   "Player"_fnvp,
-   "player_command_template"_fnvp,
-   "Player1objectives"_fnvp,
-   "Player2objectives"_fnvp,
-   "Player3objectives"_fnvp,
-   "Player4objectives"_fnvp,
-   "playercount"_fnvp,
-   "PlayerDirectionLarge"_fnvp,
-   "PlayerDirectionSmall"_fnvp,
-   "PlayerDirectionSpawn"_fnvp,
-   "playerflyerpathing"_fnvp,
-   "PlayerFOVLarge"_fnvp,
-   "PlayerFOVSmall"_fnvp,
-   "PlayerFOVSpawn"_fnvp,
-   "PlayerHealthBelow25"_fnvp,
-   "PlayerLimit"_fnvp,
-   "PlayerText"_fnvp,
-   "PlayExplosion"_fnvp,
-   "PlayInterval"_fnvp,
-   "PlayIntervalDev"_fnvp,
-   "PlayProbability"_fnvp,
-   "Point"_fnvp,
-   "PointsToUnlock"_fnvp,
-   "pol_movies"_fnvp,
-   "pol1"_fnvp,
-   "pol1_1flag"_fnvp,
-   "pol1_buildings01"_fnvp,
-   "pol1_Campaign"_fnvp,
-   "pol1_Common_Design"_fnvp,
-   "pol1_Conquest"_fnvp,
-   "pol1_ctf"_fnvp,
-   "pol1_Damage01"_fnvp,
-   "pol1_death"_fnvp,
-   "pol1_pol1_rumble"_fnvp,
-   "pol1_Roids01"_fnvp,
-   "pol1_SoundEmitters"_fnvp,
-   "pol1_SoundRegions"_fnvp,
-   "pol1_SoundSpaces"_fnvp,
-   "pol1_TDM"_fnvp,
-   "pol1_Temp"_fnvp,
-   "pol1tran1"_fnvp,
-   "polmon01"_fnvp,
-   "polmon02"_fnvp,
-   "PoolErrors"_fnvp,
-   "Portal"_fnvp,
-   "Position"_fnvp,
-   "PositionLarge"_fnvp,
-   "PositionRelative"_fnvp,
-   "PositionRelativeLarge"_fnvp,
-   "PositionRelativeSmall"_fnvp,
-   "PositionRelativeSpawn"_fnvp,
-   "PositionScale"_fnvp,
-   "PositionSmall"_fnvp,
-   "PositionSpawn"_fnvp,
-   "PositionX"_fnvp,
-   "PositionY"_fnvp,
-   "PositionZ"_fnvp,
-   "PostFlashColor"_fnvp,
-   "PostFlashRadius"_fnvp,
-   "PostFlashRate"_fnvp,
-   "PostLarge"_fnvp,
-   "PostNumbers"_fnvp,
-   "PostSelectLarge"_fnvp,
-   "PostSelectSmall"_fnvp,
-   "PostSelectSpawn"_fnvp,
-   "PostSmall"_fnvp,
-   "PostSpawn"_fnvp,
-   "PostTextLarge"_fnvp,
-   "PostTextSmall"_fnvp,
-   "PostTextSpawn"_fnvp,
-   "Posture"_fnvp,
-   "PowerupDelay"_fnvp,
-   "PowerUpItem"_fnvp,
-   "PowerupSound"_fnvp,
-   "PowerUpStation"_fnvp,
-   "ppass"_fnvp,
-   "PPitchRate"_fnvp,
-   "pregametime"_fnvp,
-   "PreparingForDamageSound"_fnvp,
-   "Press"_fnvp,
-   "PrevLinkedTerminal"_fnvp,
-   "PrimaryStance"_fnvp,
-   "PrimaryWeapon"_fnvp,
-   "PrimaryWeaponIndex"_fnvp,
-   "priority"_fnvp,
-   "ProceduralBarBitmap"_fnvp,
-   "profile"_fnvp,
-   "ProgressBarLEDColor"_fnvp,
-   "ProgressBarLEDHeight"_fnvp,
-   "ProgressBarLEDMinIntensity"_fnvp,
-   "ProgressBarLEDSpacing"_fnvp,
-   "ProgressBarLEDTexture"_fnvp,
-   "ProgressBarLEDWidth"_fnvp,
-   "ProgressBarNumLEDs"_fnvp,
-   "ProgressBarTotalTime"_fnvp,
-   "ProjectedTexture"_fnvp,
-   "Prone"_fnvp,
-   "ProneAimSpread"_fnvp,
-   "ProneMoveSpread"_fnvp,
-   "ProneSound"_fnvp,
-   "ProneStillSpread"_fnvp,
-   "ProneZoom"_fnvp,
-   "prop"_fnvp,
-   "prop_corridorsmoke"_fnvp,
-   "prop_fan"_fnvp,
-   "prop_steamgrate"_fnvp,
-   "prop_steampipe"_fnvp,
-   "prop_torturedroid"_fnvp,
-   "PropagateAlpha"_fnvp,
-   "PropClusterDensity"_fnvp,
-   "PropClusterEnable"_fnvp,
-   "PropClusterFadeAdj"_fnvp,
-   "Properties"_fnvp,
-   "Property"_fnvp,
-   "props_template"_fnvp,
-   "ProximityMaxDist"_fnvp,
-   "ProximityMinDist"_fnvp,
-   "PS2BlendMode"_fnvp,
-   "PS2Overbright"_fnvp,
-   "PuffInfo"_fnvp,
-   "Pull"_fnvp,
-   "Pulse"_fnvp,
-   "Push"_fnvp,
-   "PushDeadOnly"_fnvp,
-   "PushDeduction"_fnvp,
-   "PushRadius"_fnvp,
-   "PushRadiusInner"_fnvp,
-   "PushRadiusOuter"_fnvp,
-   "QuadScreen"_fnvp,
-   "quakecam"_fnvp,
-   "R"_fnvp,
-   "Radius"_fnvp,
-   "RadiusDamageSizeScale"_fnvp,
-   "RadiusFadeMax"_fnvp,
-   "RadiusFadeMin"_fnvp,
-   "RadiusForMaxRays"_fnvp,
-   "RainInfo"_fnvp,
-   "RandomBackdrop"_fnvp,
-   "Randomize"_fnvp,
-   "RandomSeed"_fnvp,
-   "Range"_fnvp,
-   "Ray"_fnvp,
-   "RayRadius"_fnvp,
-   "RayTriggerMinSpeed"_fnvp,
-   "RayTriggerWidth"_fnvp,
-   "Reach"_fnvp,
-   "ReallyFar"_fnvp,
-   "ReallyNear"_fnvp,
-   "Rebound"_fnvp,
-   "RecoilDecayHeavy"_fnvp,
-   "RecoilDecayLight"_fnvp,
-   "RecoilDelayHeavy"_fnvp,
-   "RecoilDelayLight"_fnvp,
-   "RecoilLengthHeavy"_fnvp,
-   "RecoilLengthLight"_fnvp,
-   "RecoilStrengthHeavy"_fnvp,
-   "RecoilStrengthLight"_fnvp,
-   "record"_fnvp,
-   "recorddir"_fnvp,
-   "RecoverFromTumble"_fnvp,
-   "Rect"_fnvp,
-   "Red"_fnvp,
-   "red_blaster_bolt"_fnvp,
-   "red_blaster_bolt_small"_fnvp,
-   "ReferenceSpeed"_fnvp,
-   "RefillFromItem"_fnvp,
-   "Reflect"_fnvp,
-   "Reflected"_fnvp,
-   "ReflectionColor"_fnvp,
-   "ReflectionFogColor"_fnvp,
-   "RefractionColor"_fnvp,
-   "Region"_fnvp,
-   "Reinforcements"_fnvp,
-   "Relative"_fnvp,
-   "RelativeSize"_fnvp,
-   "RelativeWidthHeight"_fnvp,
-   "Release"_fnvp,
-   "Reload"_fnvp,
-   "ReloadSound"_fnvp,
-   "ReloadTime"_fnvp,
-   "Remote"_fnvp,
-   "RemoteGameObject"_fnvp,
-   "REMOTETERMINAL"_fnvp,
-   "RemoveFromMapWhenDead"_fnvp,
-   "RemoveSample"_fnvp,
-   "rep"_fnvp,
-   "rep_halo"_fnvp,
-   "rep_hero_aalya"_fnvp,
-   "rep_hero_ep3obiwan"_fnvp,
-   "rep_hero_kiyadi"_fnvp,
-   "rep_hero_macewindu"_fnvp,
-   "rep_hero_yoda"_fnvp,
-   "rep_sfx_jetpack"_fnvp,
-   "Repair"_fnvp,
-   "Repeat"_fnvp,
-   "RepMusic"_fnvp,
-   "republic"_fnvp,
-   "ReserveOneForPlayer"_fnvp,
-   "ResetTeam"_fnvp,
-   "Resolution"_fnvp,
-   "RespawnTime"_fnvp,
-   "Restart"_fnvp,
-   "RestartAnimation"_fnvp,
-   "RestDir"_fnvp,
-   "ReticuleInAimingOnly"_fnvp,
-   "ReticuleTexture"_fnvp,
-   "ReturnDuration"_fnvp,
-   "ReverbDelay"_fnvp,
-   "ReverbGain"_fnvp,
-   "ReverseBackwardSteering"_fnvp,
-   "ReverseSpeed"_fnvp,
-   "RhenVar2"_fnvp,
-   "RhenVar2_SoundRegions"_fnvp,
-   "rhenvar2_soundspaces"_fnvp,
-   "rhn_proprocks"_fnvp,
-   "rhn_proprocks_02"_fnvp,
-   "right"_fnvp,
-   "RightFootstepSound"_fnvp,
-   "roll"_fnvp,
-   "RollIn"_fnvp,
-   "RollInDistance"_fnvp,
-   "RollOff"_fnvp,
-   "RollRate"_fnvp,
-   "RollRateAccel"_fnvp,
-   "RollSound"_fnvp,
-   "RollSpeedFactor"_fnvp,
-   "RollTime"_fnvp,
-   "RoomGain"_fnvp,
-   "RoomHFGain"_fnvp,
-   "RoomRollOff"_fnvp,
-   "RoomRollOffFactor"_fnvp,
-   "root"_fnvp,
-   "RootIsSlot"_fnvp,
-   "Rotation"_fnvp,
-   "RotationRange"_fnvp,
-   "RotationRate"_fnvp,
-   "RotationSpeed"_fnvp,
-   "RotationVelocity"_fnvp,
-   "Rotator"_fnvp,
-   "RoundDelay"_fnvp,
-   "RoundsPerClip"_fnvp,
-   "RoundsPerSalvo"_fnvp,
-   "RumbleEffect"_fnvp,
-   "RunSpeed"_fnvp,
-   "safemode"_fnvp,
-   "SalvoCount"_fnvp,
-   "SalvoDelay"_fnvp,
-   "SalvoTime"_fnvp,
-   "Sample"_fnvp,
-   "SampleList"_fnvp,
-   "Saturation"_fnvp,
-   "sb1mon01"_fnvp,
-   "sb1mon02"_fnvp,
-   "sb1tran1"_fnvp,
-   "sb2mon01"_fnvp,
-   "sb2mon02"_fnvp,
-   "sb2tran1"_fnvp,
-   "sb3mon01"_fnvp,
-   "sb3mon02"_fnvp,
-   "sb3tran1"_fnvp,
-   "sb4mon01"_fnvp,
-   "sb4mon02"_fnvp,
-   "sb4tran1"_fnvp,
-   "Scalable"_fnvp,
-   "Scale"_fnvp,
-   "ScaleAll"_fnvp,
-   "ScaleSize"_fnvp,
-   "ScaleTexture"_fnvp,
-   "ScaleTime"_fnvp,
-   "ScaleUniform"_fnvp,
-   "ScanningRange"_fnvp,
-   "ScatterDistance"_fnvp,
-   "SCDriverGetInSound"_fnvp,
-   "SCDriverGetOutSound"_fnvp,
-   "SCFieldFollowSound"_fnvp,
-   "SCFieldHoldSound"_fnvp,
-   "SCFieldMoveOutSound"_fnvp,
-   "SCGunnerAllClearSound"_fnvp,
-   "SCGunnerGetInSound"_fnvp,
-   "SCGunnerGetOutSound"_fnvp,
-   "SCGunnerSteadySound"_fnvp,
-   "ScopeDisplayAmbient"_fnvp,
-   "ScopeDisplayZoomIn"_fnvp,
-   "ScopeDisplayZoomOut"_fnvp,
-   "ScopeTexture"_fnvp,
-   "ScoreForMedalsType"_fnvp,
-   "Scout"_fnvp,
-   "SCPassengerGetInSound"_fnvp,
-   "SCPassengerGetOutSound"_fnvp,
-   "SCPassengerMoveOutSound"_fnvp,
-   "SCPassengerStopSound"_fnvp,
-   "screaming"_fnvp,
-   "screen_template"_fnvp,
-   "screenshot"_fnvp,
-   "SCResponseNosirSound"_fnvp,
-   "SCResponseYessirSound"_fnvp,
-   "ScrollRate"_fnvp,
-   "ScrollSpeed"_fnvp,
-   "SecondaryOrdnance"_fnvp,
-   "SecondaryOrdnanceName"_fnvp,
-   "SecondaryOrdnancePeriod"_fnvp,
-   "SecondaryStance"_fnvp,
-   "SecondaryWeapon"_fnvp,
-   "Seconds"_fnvp,
-   "Sector"_fnvp,
-   "Sector1"_fnvp,
-   "Sector2"_fnvp,
-   "Seed"_fnvp,
-   "Segment"_fnvp,
-   "SegmentList"_fnvp,
-   "selected"_fnvp,
-   "self"_fnvp,
-   "SelfDestructSoundPitch"_fnvp,
-   "SelfText"_fnvp,
-   "session"_fnvp,
-   "SetAltitude"_fnvp,
-   "Shadow"_fnvp,
-   "ShadowCaster"_fnvp,
-   "ShadowColor"_fnvp,
-   "Shake"_fnvp,
-   "ShakeLength"_fnvp,
-   "ShakeRadius"_fnvp,
-   "ShakeRadiusInner"_fnvp,
-   "ShakeRadiusOuter"_fnvp,
-   "ShakeScale"_fnvp,
-   "shell"_fnvp,
-   "shell_keyboard_backspace"_fnvp,
-   "shell_keyboard_key"_fnvp,
-   "shell_menu_accept"_fnvp,
-   "shell_menu_cancel"_fnvp,
-   "shell_menu_enter"_fnvp,
-   "shell_menu_error"_fnvp,
-   "shell_menu_exit"_fnvp,
-   "shell_movies"_fnvp,
-   "shell_music"_fnvp,
-   "shell_select_change"_fnvp,
-   "shell_subtitles"_fnvp,
-   "shellfx"_fnvp,
-   "shellmovies"_fnvp,
-   "shellmusic"_fnvp,
-   "shield"_fnvp,
-   "ShieldEffect"_fnvp,
-   "ShieldOffset"_fnvp,
-   "ShieldOffSound"_fnvp,
-   "ShieldRadius"_fnvp,
-   "ShieldScale"_fnvp,
-   "ShieldSound"_fnvp,
-   "ShockFadeInTime"_fnvp,
-   "ShockFadeOutGain"_fnvp,
-   "ShockFadeOutTime"_fnvp,
-   "ShockSound"_fnvp,
-   "ShotDelay"_fnvp,
-   "ShotElevate"_fnvp,
-   "ShotPatternCount"_fnvp,
-   "ShotPatternPitchYaw"_fnvp,
-   "ShotPerSalvo"_fnvp,
-   "ShotsPerSalvo"_fnvp,
-   "ShowAllServers"_fnvp,
-   "ShowAllSessions"_fnvp,
-   "showintro"_fnvp,
-   "showlegal"_fnvp,
-   "sideselect"_fnvp,
-   "SIMPLE"_fnvp,
-   "SingleDirection"_fnvp,
-   "Size"_fnvp,
-   "SkeletonLowRes"_fnvp,
-   "SkeletonName"_fnvp,
-   "SkeletonRootScale"_fnvp,
-   "SkeletonRootScaleLowRes"_fnvp,
-   "skill"_fnvp,
-   "SkinnyFactor"_fnvp,
-   "SkyDomeDarkenFactor"_fnvp,
-   "SkyInfo"_fnvp,
-   "SkyObject"_fnvp,
-   "small_muzzle_flash"_fnvp,
-   "SmallBan"_fnvp,
-   "SmashParkedFlyers"_fnvp,
-   "smoke_billow"_fnvp,
-   "SmolderBone"_fnvp,
-   "SmolderDamageRate"_fnvp,
-   "SmolderEffect"_fnvp,
-   "SmolderEffectTimer"_fnvp,
-   "SmolderVanishDeath"_fnvp,
-   "SndHeroDefeated"_fnvp,
-   "SndHeroKiller"_fnvp,
-   "SndHeroSelectable"_fnvp,
-   "SndHeroSpawned"_fnvp,
-   "SniperScope"_fnvp,
-   "Softness"_fnvp,
-   "SoftnessParam"_fnvp,
-   "soldier"_fnvp,
-   "SoldierAmmo"_fnvp,
-   "SoldierAnimation"_fnvp,
-   "SoldierAnnoucement"_fnvp,
-   "SoldierAttachBone"_fnvp,
-   "SoldierBan"_fnvp,
-   "SoldierCollision"_fnvp,
-   "SoldierCollisionPrim"_fnvp,
-   "SoldierEnergy"_fnvp,
-   "SoldierHealth"_fnvp,
-   "SoldierMusic"_fnvp,
-   "Sound"_fnvp,
-   "SoundAmbienceStatic"_fnvp,
-   "SoundAmbienceStreaming"_fnvp,
-   "SoundCrack"_fnvp,
-   "soundfx"_fnvp,
-   "soundlayered"_fnvp,
-   "SoundName"_fnvp,
-   "SoundOffset"_fnvp,
-   "soundparameterized"_fnvp,
-   "SoundPitchDev"_fnvp,
-   "SoundProperties"_fnvp,
-   "SoundProperty"_fnvp,
-   "SoundStream"_fnvp,
-   "SoundStreamProperties"_fnvp,
-   "SoundSubCrack"_fnvp,
-   "soundwarning"_fnvp,
-   "SoundWhenMoving"_fnvp,
-   "spa_cor"_fnvp,
-   "spa_dag"_fnvp,
-   "spa_end"_fnvp,
-   "spa_fel"_fnvp,
-   "spa_geo"_fnvp,
-   "spa_hot"_fnvp,
-   "spa_kam"_fnvp,
-   "spa_kas"_fnvp,
-   "spa_mus"_fnvp,
-   "spa_myg"_fnvp,
-   "spa_nab"_fnvp,
-   "spa_pol"_fnvp,
-   "spa_sfx_blender"_fnvp,
-   "spa_sfx_blender_destruct1"_fnvp,
-   "spa_sfx_blender_destruct2"_fnvp,
-   "spa_sfx_blender_destruct3"_fnvp,
-   "spa_sfx_blender_destruct4"_fnvp,
-   "spa_sfx_blender_destruct5"_fnvp,
-   "spa_sfx_blender_destruct6"_fnvp,
-   "spa_sfx_frigate_exp_1"_fnvp,
-   "spa_sfx_frigate_exp_2"_fnvp,
-   "spa_sfx_frigate_exp_3"_fnvp,
-   "spa_sfx_frigate_exp_4"_fnvp,
-   "spa_sfx_frigate_exp_5"_fnvp,
-   "spa_sfx_lightningballs"_fnvp,
-   "spa_sfx_skydomeexplosions"_fnvp,
-   "spa_sfx_turret_exp"_fnvp,
-   "spa_spa"_fnvp,
-   "spa_steamgrate"_fnvp,
-   "spa_tat"_fnvp,
-   "spa_uta"_fnvp,
-   "spa_yav"_fnvp,
-   "spa1"_fnvp,
-   "spa1_Assault Paths"_fnvp,
-   "spa1_asteroids"_fnvp,
-   "spa1_bomber paths"_fnvp,
-   "spa1_campaign_flyers"_fnvp,
-   "spa1_campaign_turrets"_fnvp,
-   "spa1_capitalships"_fnvp,
-   "spa1_CTF"_fnvp,
-   "spa1_ctf_paths"_fnvp,
-   "spa1_Flight Paths"_fnvp,
-   "spa1_movies"_fnvp,
-   "spa1_mp_flyers"_fnvp,
-   "spa1_mp_turrets"_fnvp,
-   "spa1_rumbleregions"_fnvp,
-   "spa1_sfx_all_rebelcruiserengine_exp"_fnvp,
-   "spa1_sfx_asteroid_shatter"_fnvp,
-   "spa1_sfx_engine_exp_destruct2"_fnvp,
-   "spa1_sfx_junkengine_exp"_fnvp,
-   "spa1_sfx_lasertrail"_fnvp,
-   "spa1_sfx_shipflames_lg"_fnvp,
-   "spa1_sfx_weap_laser_exp_lg"_fnvp,
-   "spa1_Shadows"_fnvp,
-   "spa1_soundregions"_fnvp,
-   "spa1_soundspaces"_fnvp,
-   "spa1_soundtriggerregions"_fnvp,
-   "spa1_swingassault"_fnvp,
-   "spa1_transports"_fnvp,
-   "spa1_turrets"_fnvp,
-   "spa2"_fnvp,
-   "spa2_Campaign"_fnvp,
-   "spa2_capitalships"_fnvp,
-   "spa2_cispaths"_fnvp,
-   "spa2_design"_fnvp,
-   "spa2_fighters"_fnvp,
-   "spa2_flightschool"_fnvp,
-   "spa2_movies"_fnvp,
-   "spa2_reppaths"_fnvp,
-   "spa2_rumbles"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct1_2_exp"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct1a"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct1b"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct1c"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct1d"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct2a"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct2b"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct2c"_fnvp,
-   "spa2_sfx_cis_fedcruiser_descruct2d"_fnvp,
-   "spa2_sfx_prop_antenna_descruct_exp"_fnvp,
-   "spa2_sfx_prop_antenna_descruct1a"_fnvp,
-   "spa2_sfx_prop_antenna_descruct1b"_fnvp,
-   "spa2_sfx_prop_antenna_descruct1c"_fnvp,
-   "spa2_sfx_prop_antenna_descruct1d"_fnvp,
-   "spa2_Shadows"_fnvp,
-   "spa2_soundregions"_fnvp,
-   "spa2_soundspace"_fnvp,
-   "spa2_turrets"_fnvp,
-   "SPA3"_fnvp,
-   "spa3_2_flag_ctf"_fnvp,
-   "spa3_Assaultpaths"_fnvp,
-   "spa3_c_gameplay"_fnvp,
-   "spa3_C_objects"_fnvp,
-   "spa3_c_ships"_fnvp,
-   "spa3_c_turrets"_fnvp,
-   "spa3_cisfrigate"_fnvp,
-   "spa3_flightpaths"_fnvp,
-   "spa3_hangarwars"_fnvp,
-   "spa3_movies"_fnvp,
-   "spa3_obj_turrets"_fnvp,
-   "spa3_rumbles"_fnvp,
-   "spa3_shadows"_fnvp,
-   "spa3_SoundEmitters"_fnvp,
-   "spa3_soundregions"_fnvp,
-   "spa3_soundspaces"_fnvp,
-   "spa3_swing turrets"_fnvp,
-   "spa3_swing_camp"_fnvp,
-   "spa3_swing_obj"_fnvp,
-   "spa4"_fnvp,
-   "spa4_asteroids"_fnvp,
-   "spa4_c_cis-ships"_fnvp,
-   "spa4_c_gameplay"_fnvp,
-   "spa4_c_ships"_fnvp,
-   "spa4_extra"_fnvp,
-   "spa4_flightpaths"_fnvp,
-   "spa4_movies"_fnvp,
-   "spa4_rumbles"_fnvp,
-   "spa4_shadows"_fnvp,
-   "spa4_soundregions"_fnvp,
-   "spa4_soundspaces"_fnvp,
-   "spa5"_fnvp,
-   "spa5_C_Gameplay"_fnvp,
-   "spa5_c_ships"_fnvp,
-   "spa5_flightpaths"_fnvp,
-   "spa5_turrets"_fnvp,
-   "SPA6"_fnvp,
-   "spa6_1flag_flags"_fnvp,
-   "spa6_1flag_paths"_fnvp,
-   "spa6_capitalships"_fnvp,
-   "spa6_cmn_hangar"_fnvp,
-   "spa6_cmn_paths"_fnvp,
-   "spa6_ctf_flags"_fnvp,
-   "spa6_ctf_spawn"_fnvp,
-   "spa6_frigates"_fnvp,
-   "spa6_obj_hangar"_fnvp,
-   "spa6_obj_paths"_fnvp,
-   "spa6_obj_spawn"_fnvp,
-   "spa6_shadows"_fnvp,
-   "spa6_soundregions"_fnvp,
-   "spa6_soundspaces"_fnvp,
-   "spa7"_fnvp,
-   "spa7_1flag_flags"_fnvp,
-   "spa7_1flag_paths"_fnvp,
-   "spa7_asteroids"_fnvp,
-   "spa7_capitalships"_fnvp,
-   "spa7_cmn_hangar"_fnvp,
-   "spa7_cmn_paths"_fnvp,
-   "spa7_ctf_flags"_fnvp,
-   "spa7_ctf_spawn"_fnvp,
-   "spa7_frigates"_fnvp,
-   "spa7_obj_hangar"_fnvp,
-   "spa7_obj_paths"_fnvp,
-   "spa7_obj_spawn"_fnvp,
-   "spa7_Shadows"_fnvp,
-   "spa7_SoundRegions"_fnvp,
-   "spa7_SoundSpace"_fnvp,
-   "spa8"_fnvp,
-   "spa8_1flag_flags"_fnvp,
-   "spa8_1flag_paths"_fnvp,
-   "spa8_ass_hangar"_fnvp,
-   "spa8_ass_paths"_fnvp,
-   "spa8_ass_spawn"_fnvp,
-   "spa8_capitalships"_fnvp,
-   "spa8_cmn_hangar"_fnvp,
-   "spa8_cmn_paths"_fnvp,
-   "spa8_ctf_flags"_fnvp,
-   "spa8_ctf_spawn"_fnvp,
-   "spa8_frigates"_fnvp,
-   "spa8_Shadows"_fnvp,
-   "spa8_SoundRegions"_fnvp,
-   "spa8_soundspace"_fnvp,
-   "spa9"_fnvp,
-   "spa9_1flag_flags"_fnvp,
-   "spa9_1flag_paths"_fnvp,
-   "spa9_ass_hangar"_fnvp,
-   "spa9_ass_paths"_fnvp,
-   "spa9_ass_spawn"_fnvp,
-   "spa9_asteroids"_fnvp,
-   "spa9_capitalships"_fnvp,
-   "spa9_cmn_hangar"_fnvp,
-   "spa9_cmn_paths"_fnvp,
-   "spa9_ctf_flags"_fnvp,
-   "spa9_ctf_spawn"_fnvp,
-   "spa9_eli_spawn"_fnvp,
-   "spa9_Fighters"_fnvp,
-   "spa9_Frigates"_fnvp,
-   "spa9_shadows"_fnvp,
-   "spa9_soundregions"_fnvp,
-   "spa9_SoundSpace"_fnvp,
-   "Space"_fnvp,
-   "spaceassaultscorelimit"_fnvp,
-   "Spark"_fnvp,
-   "SparkLength"_fnvp,
-   "spawn"_fnvp,
-   "SpawnCount"_fnvp,
-   "SpawnDelay"_fnvp,
-   "SpawnDisplayBack"_fnvp,
-   "SpawnDisplaySpawnPointAccept"_fnvp,
-   "SpawnDisplaySpawnPointChange"_fnvp,
-   "SpawnDisplayUnitAccept"_fnvp,
-   "SpawnDisplayUnitChange"_fnvp,
-   "SpawnDistance"_fnvp,
-   "Spawner"_fnvp,
-   "SpawnPath"_fnvp,
-   "SpawnPointCount"_fnvp,
-   "SpawnPointLocation"_fnvp,
-   "SpawnPointNames"_fnvp,
-   "SpawnRegion"_fnvp,
-   "SpawnSound"_fnvp,
-   "SpawnTime"_fnvp,
-   "Special"_fnvp,
-   "SpeckleAmbientColor"_fnvp,
-   "SpeckleCoordShift"_fnvp,
-   "SpeckleScrollSpeed"_fnvp,
-   "SpeckleSpecularColor"_fnvp,
-   "SpeckleTextures"_fnvp,
-   "SpeckleTile"_fnvp,
-   "SpecularCaster"_fnvp,
-   "SpecularColor"_fnvp,
-   "SpecularMaskScrollSpeed"_fnvp,
-   "SpecularMaskTextures"_fnvp,
-   "SpecularMaskTile"_fnvp,
-   "Speed"_fnvp,
-   "SpeedForInvisibilityMax"_fnvp,
-   "SpeedForInvisibilityMin"_fnvp,
-   "SpeedParticleMaxLength"_fnvp,
-   "SpeedParticleMinLength"_fnvp,
-   "Sphere"_fnvp,
-   "SpikeColor"_fnvp,
-   "SpikeSize"_fnvp,
-   "SpinRate"_fnvp,
-   "SplatInfo"_fnvp,
-   "SplineType"_fnvp,
-   "split"_fnvp,
-   "split2"_fnvp,
-   "split4"_fnvp,
-   "SPLITCROUCH"_fnvp,
-   "SPLITCROUCHZOOM"_fnvp,
-   "SplitMode"_fnvp,
-   "SplitOptions"_fnvp,
-   "SPLITPRONE"_fnvp,
-   "SPLITPRONEZOOM"_fnvp,
-   "splitscreen"_fnvp,
-   "SPLITSPRINT"_fnvp,
-   "SPLITSTAND"_fnvp,
-   "SPLITSTANDZOOM"_fnvp,
-   "Spot"_fnvp,
-   "SpotInnerConeAngle"_fnvp,
-   "SpotOuterConeAngle"_fnvp,
-   "SpottedVO"_fnvp,
-   "Spread"_fnvp,
-   "SpreadFactor"_fnvp,
-   "SpreadLimit"_fnvp,
-   "SpreadPerShot"_fnvp,
-   "SpreadRadius"_fnvp,
-   "SpreadRecover"_fnvp,
-   "SpreadRecoverRate"_fnvp,
-   "SpreadThreshold"_fnvp,
-   "sprint"_fnvp,
-   "SprintAccelerateTime"_fnvp,
-   "SprintTimeForBowling"_fnvp,
-   "SpritesInfo"_fnvp,
-   "SquadronDistance"_fnvp,
-   "SquadronFormation"_fnvp,
-   "SquadronMaxAngle"_fnvp,
-   "SquadronMemberID"_fnvp,
-   "Squat"_fnvp,
-   "SquatSound"_fnvp,
-   "stand"_fnvp,
-   "stand_attack1a"_fnvp,
-   "stand_attack1a_end"_fnvp,
-   "stand_attack1b"_fnvp,
-   "stand_attack1b_end"_fnvp,
-   "stand_attack1c"_fnvp,
-   "StandAimSpread"_fnvp,
-   "StandMoveSpread"_fnvp,
-   "StandSound"_fnvp,
-   "StandStillSpread"_fnvp,
-   "STANDZOOM"_fnvp,
-   "star"_fnvp,
-   "starblue"_fnvp,
-   "stars"_fnvp,
-   "StarsInfo"_fnvp,
-   "StartDelay"_fnvp,
-   "StarTexture"_fnvp,
-   "StartMovementSound"_fnvp,
-   "StartMoveX"_fnvp,
-   "StartMoveY"_fnvp,
-   "StartMoveZ"_fnvp,
-   "StartRotation"_fnvp,
-   "StartTimerOnContact"_fnvp,
-   "StartX"_fnvp,
-   "StartY"_fnvp,
-   "StartZ"_fnvp,
-   "State"_fnvp,
-   "STATIC"_fnvp,
-   "StatusTexture"_fnvp,
-   "SteerAtStrafeLimit"_fnvp,
-   "SteerAtYawLimit"_fnvp,
-   "SteerTowardAimFactor"_fnvp,
-   "SteerTowardAimRate"_fnvp,
-   "StickAll"_fnvp,
-   "StickAnimal"_fnvp,
-   "StickBuilding"_fnvp,
-   "StickBuildingDead"_fnvp,
-   "StickBuildingUnbuilt"_fnvp,
-   "StickDroid"_fnvp,
-   "StickPerson"_fnvp,
-   "StickTerrain"_fnvp,
-   "StickVehicle"_fnvp,
-   "sticky"_fnvp,
-   "Stiffness"_fnvp,
-   "StompDecal"_fnvp,
-   "StompDecalSize"_fnvp,
-   "StompDetectionType"_fnvp,
-   "StompEffect"_fnvp,
-   "StompRumbleHeavy"_fnvp,
-   "StompRumbleHeavyDuration"_fnvp,
-   "StompRumbleLight"_fnvp,
-   "StompRumbleLightDuration"_fnvp,
-   "StompThreshold"_fnvp,
-   "StopMovementSound"_fnvp,
-   "StoppedTurnSpeed"_fnvp,
-   "StrafeFactor"_fnvp,
-   "StrafeRollAngle"_fnvp,
-   "StrafeSpeed"_fnvp,
-   "Strategic_Filter1"_fnvp,
-   "Strategic_Filter2"_fnvp,
-   "Strategic_Filter3"_fnvp,
-   "Strategic_Filter4"_fnvp,
-   "Strategic_Filter5"_fnvp,
-   "Strategic_Filter6"_fnvp,
-   "Streak"_fnvp,
-   "StreakLength"_fnvp,
-   "Stream"_fnvp,
-   "stretchconstraint"_fnvp,
-   "StrikeOrdnance"_fnvp,
-   "StrikeOrdnanceName"_fnvp,
-   "StringAngle"_fnvp,
-   "StringGrids"_fnvp,
-   "Strobe"_fnvp,
-   "StrobeFade"_fnvp,
-   "StrobeRandom"_fnvp,
-   "Stun"_fnvp,
-   "StunAnimation"_fnvp,
-   "StunTime"_fnvp,
-   "Subtitle"_fnvp,
-   "SubtitleList"_fnvp,
-   "SunColor"_fnvp,
-   "SunDirection"_fnvp,
-   "SunFlare"_fnvp,
-   "SunInfo"_fnvp,
-   "SunlightFadeFactor"_fnvp,
-   "Support"_fnvp,
-   "SuppressRadius"_fnvp,
-   "SuspensionLeftArmNodeName"_fnvp,
-   "SuspensionMaxOffset"_fnvp,
-   "SuspensionMidOffset"_fnvp,
-   "SuspensionNodeName"_fnvp,
-   "SuspensionRightArmNodeName"_fnvp,
-   "SwingAmount"_fnvp,
-   "SwingSpeed"_fnvp,
-   "SwingTime"_fnvp,
-   "SWIPE_BT"_fnvp,
-   "SWIPE_LR"_fnvp,
-   "SWIPE_RAND"_fnvp,
-   "SWIPE_RL"_fnvp,
-   "SWIPE_TB"_fnvp,
-   "SwitchClassRadius"_fnvp,
-   "SwitchImmediately"_fnvp,
-   "Synchronize"_fnvp,
-   "SyncIfOvertime"_fnvp,
-   "SyncType"_fnvp,
-   "tactical_template"_fnvp,
-   "TailPosition"_fnvp,
-   "TakeoffHeight"_fnvp,
-   "TakeoffSound"_fnvp,
-   "TakeoffSpeed"_fnvp,
-   "TakeoffTime"_fnvp,
-   "tan_movies"_fnvp,
-   "tan_sfx_console_damage1"_fnvp,
-   "tan_sfx_console_damage2"_fnvp,
-   "tan_sfx_console_damage3"_fnvp,
-   "tan1"_fnvp,
-   "tan1_1flag"_fnvp,
-   "tan1_conquest"_fnvp,
-   "tan1_CTF"_fnvp,
-   "tan1_Design01"_fnvp,
-   "tan1_NewCompProps"_fnvp,
-   "tan1_NewObjective"_fnvp,
-   "tan1_Props"_fnvp,
-   "tan1_reflections"_fnvp,
-   "tan1_Rumble"_fnvp,
-   "tan1_sfx_turbine"_fnvp,
-   "tan1_sfx_turbine_damage1"_fnvp,
-   "tan1_sfx_turbine_damage2"_fnvp,
-   "tan1_sfx_turbine_damage3"_fnvp,
-   "tan1_shadows"_fnvp,
-   "tan1_SoundEmitters"_fnvp,
-   "tan1_SoundRegions"_fnvp,
-   "tan1_SoundSpaces"_fnvp,
-   "tan1tran1"_fnvp,
-   "tanmon01"_fnvp,
-   "tanmon02"_fnvp,
-   "Tap"_fnvp,
-   "TapHold"_fnvp,
-   "TapPress"_fnvp,
-   "Target"_fnvp,
-   "TargetableCollision"_fnvp,
-   "TargetableCollisionPrim"_fnvp,
-   "TargetAll"_fnvp,
-   "TargetAnimal"_fnvp,
-   "TargetBuilding"_fnvp,
-   "TargetBuildingDead"_fnvp,
-   "TargetBuildingUnbuilt"_fnvp,
-   "TargetDroid"_fnvp,
-   "TargetEnemy"_fnvp,
-   "TargetFireColor"_fnvp,
-   "TargetFriendly"_fnvp,
-   "TargetHealthBelow25"_fnvp,
-   "TargetLarge"_fnvp,
-   "TargetLock"_fnvp,
-   "TargetLockMaxDistance"_fnvp,
-   "TargetLockMaxDistanceLose"_fnvp,
-   "TargetMine"_fnvp,
-   "TargetNeutral"_fnvp,
-   "TargetPerson"_fnvp,
-   "TargetPointOffset"_fnvp,
-   "TargetPointOffsetCrouch"_fnvp,
-   "TargetPointOffsetStand"_fnvp,
-   "TargetSmall"_fnvp,
-   "TargetSpawn"_fnvp,
-   "TargetVehicle"_fnvp,
-   "tat2"_fnvp,
-   "tat2_1flag"_fnvp,
-   "tat2_Collision"_fnvp,
-   "tat2_con"_fnvp,
-   "tat2_ctf"_fnvp,
-   "tat2_Design"_fnvp,
-   "tat2_hunt"_fnvp,
-   "tat2_soundregions"_fnvp,
-   "tat2_tdm"_fnvp,
-   "tat2_turrets"_fnvp,
-   "tat3"_fnvp,
-   "tat3_1flag"_fnvp,
-   "tat3_con"_fnvp,
-   "tat3_ctf"_fnvp,
-   "tat3_Design"_fnvp,
-   "tat3_hunt"_fnvp,
-   "tat3_Shadows"_fnvp,
-   "tat3_SoundEmitters"_fnvp,
-   "tat3_soundregions"_fnvp,
-   "tat3_SoundSpaces"_fnvp,
-   "tat3_white_light01"_fnvp,
-   "Team"_fnvp,
-   "team_bonus_advanced_blasters"_fnvp,
-   "team_bonus_autoturrets"_fnvp,
-   "team_bonus_bacta_tanks"_fnvp,
-   "team_bonus_combat_shielding"_fnvp,
-   "team_bonus_energy_boost"_fnvp,
-   "team_bonus_garrison"_fnvp,
-   "team_bonus_garrison_used_by"_fnvp,
-   "team_bonus_leader"_fnvp,
-   "team_bonus_sabotage"_fnvp,
-   "team_bonus_sensor_array"_fnvp,
-   "team_bonus_supplies"_fnvp,
-   "TeamModel"_fnvp,
-   "TeamModelRotationSpeed"_fnvp,
-   "TEMP_AnimationSpeed"_fnvp,
-   "TEMP_Type"_fnvp,
-   "TentacleCollType"_fnvp,
-   "terrain_foley"_fnvp,
-   "TerrainBumpSpecularTexture"_fnvp,
-   "TerrainBumpTexture"_fnvp,
-   "TerrainCollision"_fnvp,
-   "TerrainCollisionPrim"_fnvp,
-   "TerrainColorDarkening"_fnvp,
-   "TerrainLeft"_fnvp,
-   "TerrainRight"_fnvp,
-   "Tessellation"_fnvp,
-   "test1"_fnvp,
-   "test1_Layer000"_fnvp,
-   "TexCoords"_fnvp,
-   "Text"_fnvp,
-   "TextAlignment"_fnvp,
-   "TextBox"_fnvp,
-   "TextBreak"_fnvp,
-   "TextCharacterSpacing"_fnvp,
-   "TextClip"_fnvp,
-   "TextFont"_fnvp,
-   "TextHAlignment"_fnvp,
-   "TextScale"_fnvp,
-   "TextStyle"_fnvp,
-   "TextTabSpacing"_fnvp,
-   "Texture"_fnvp,
-   "TextureJitterSpeed"_fnvp,
-   "TextureScale"_fnvp,
-   "TextureSize"_fnvp,
-   "TextureSpeed"_fnvp,
-   "TextureVelocity"_fnvp,
-   "TextVAlignment"_fnvp,
-   "ThirdPersonFOV"_fnvp,
-   "threats"_fnvp,
-   "Threshold"_fnvp,
-   "throttle"_fnvp,
-   "ThrowAnimation"_fnvp,
-   "Thrust"_fnvp,
-   "ThrustAngle"_fnvp,
-   "ThrustAngleToStop"_fnvp,
-   "ThrustAngleToStrafe"_fnvp,
-   "ThrustAngleToTurn"_fnvp,
-   "ThrustAttachOffset"_fnvp,
-   "ThrustAttachPoint"_fnvp,
-   "ThrustEffect"_fnvp,
-   "ThrustEffectMaxScale"_fnvp,
-   "ThrustEffectMinScale"_fnvp,
-   "ThrustEffectScaleStart"_fnvp,
-   "ThrustFactor"_fnvp,
-   "ThrustPitchAngle"_fnvp,
-   "TickSound"_fnvp,
-   "TickSoundPitch"_fnvp,
-   "Tile"_fnvp,
-   "TileSize"_fnvp,
-   "TileUV"_fnvp,
-   "TiltValue"_fnvp,
-   "Time"_fnvp,
-   "TimeAtMaxCharge"_fnvp,
-   "TimeBetweenFlashesMinMax"_fnvp,
-   "TimeBetweenSubFlashesMinMax"_fnvp,
-   "TimeEnd"_fnvp,
-   "TimeInPosture"_fnvp,
-   "TimePerFrame"_fnvp,
-   "TimeRequiredToEject"_fnvp,
-   "TimeStart"_fnvp,
-   "TimeTilReboard"_fnvp,
-   "TimeToChange"_fnvp,
-   "TipsBoxTexture"_fnvp,
-   "TipsColor"_fnvp,
-   "TipsPrefix"_fnvp,
-   "TipsTime"_fnvp,
-   "Toggle"_fnvp,
-   "toggledisplay"_fnvp,
-   "Top"_fnvp,
-   "TopColor"_fnvp,
-   "TopDirectionalAmbientColor"_fnvp,
-   "TopRange"_fnvp,
-   "torchflame"_fnvp,
-   "Torso"_fnvp,
-   "TotalFrames"_fnvp,
-   "towcable"_fnvp,
-   "TowCableCollision"_fnvp,
-   "towcableweapon"_fnvp,
-   "tps"_fnvp,
-   "TrackCenter"_fnvp,
-   "TrackDeathOnAttach"_fnvp,
-   "TrackingSound"_fnvp,
-   "TrackOffset"_fnvp,
-   "TrackUseRoot"_fnvp,
-   "Traction"_fnvp,
-   "TrailEffect"_fnvp,
-   "training"_fnvp,
-   "training1"_fnvp,
-   "TrakCenter"_fnvp,
-   "Transformer"_fnvp,
-   "TransformNameMesh"_fnvp,
-   "TransformNumberColor"_fnvp,
-   "TransformNumberVector3"_fnvp,
-   "Transition"_fnvp,
-   "transition_template"_fnvp,
-   "TransitionTime"_fnvp,
-   "TransmitRange"_fnvp,
-   "transparent"_fnvp,
-   "TransparentType"_fnvp,
-   "Transport"_fnvp,
-   "trap"_fnvp,
-   "TreeLine"_fnvp,
-   "TrickFlipCameraDetach"_fnvp,
-   "TrickFlipSpeed"_fnvp,
-   "TrickRollSpeed"_fnvp,
-   "TrickSideRollCameraDetach"_fnvp,
-   "TrickSideRollStrafeSpeed"_fnvp,
-   "TrickSound"_fnvp,
-   "TrickTimeMid"_fnvp,
-   "TrickTimeRange"_fnvp,
-   "TriggerAll"_fnvp,
-   "TriggerAnimation"_fnvp,
-   "TriggerCollision"_fnvp,
-   "TriggerContact"_fnvp,
-   "TriggerNode"_fnvp,
-   "TriggerOffset"_fnvp,
-   "TriggerRadius"_fnvp,
-   "TriggerSingle"_fnvp,
-   "TriggerSound"_fnvp,
-   "TriggerTeam"_fnvp,
-   "Trooper"_fnvp,
-   "ttachEffect"_fnvp,
-   "tumble"_fnvp,
-   "TurnBuildupMultiplier"_fnvp,
-   "TurnFactor"_fnvp,
-   "TurnFilter"_fnvp,
-   "TurnFilterDecel"_fnvp,
-   "TurningOffSound"_fnvp,
-   "TurnOffLightsaber"_fnvp,
-   "TurnOffSound"_fnvp,
-   "TurnOffTime"_fnvp,
-   "TurnOnDuration"_fnvp,
-   "TurnOnSound"_fnvp,
-   "TurnOnTime"_fnvp,
-   "TurnRate"_fnvp,
-   "TurnThreshold"_fnvp,
-   "Turret"_fnvp,
-   "turret_template"_fnvp,
-   "TURRET1"_fnvp,
-   "TURRET2"_fnvp,
-   "TURRET3"_fnvp,
-   "TURRET4"_fnvp,
-   "TURRET5"_fnvp,
-   "TURRET6"_fnvp,
-   "TURRET7"_fnvp,
-   "TURRET8"_fnvp,
-   "TurretActivateSound"_fnvp,
-   "TurretAmbientSound"_fnvp,
-   "TurretDeactivateSound"_fnvp,
-   "TurretMoveSound"_fnvp,
-   "TurretMoveSoundStartEndPitch"_fnvp,
-   "TurretMoveSoundStartEndTime"_fnvp,
-   "TurretNodeName"_fnvp,
-   "TurretPath"_fnvp,
-   "TurretPitchoundPitch"_fnvp,
-   "TurretPitchSound"_fnvp,
-   "TurretPitchSoundPitch"_fnvp,
-   "TURRETSECTION"_fnvp,
-   "TurretStartSound"_fnvp,
-   "TurretStopSound"_fnvp,
-   "TurretYawSound"_fnvp,
-   "TurretYawSoundPitch"_fnvp,
-   "TwinkleFactor"_fnvp,
-   "TwinkleFrequency"_fnvp,
-   "Type"_fnvp,
-   "TypeCount"_fnvp,
-   "ui_cancel"_fnvp,
-   "ui_keyboardtype"_fnvp,
-   "ui_load_lp"_fnvp,
-   "ui_menuBack"_fnvp,
-   "ui_menuMove"_fnvp,
-   "ui_menuSelectionToggle"_fnvp,
-   "ui_planetzoom"_fnvp,
-   "UnbuiltGeometryName"_fnvp,
-   "UnbuiltHoloOdf"_fnvp,
-   "UnderwaterColor"_fnvp,
-   "unitName"_fnvp,
-   "UnitType"_fnvp,
-   "unlimitedammo"_fnvp,
-   "UnrollTime"_fnvp,
-   "Until"_fnvp,
-   "Up"_fnvp,
-   "UprightLowResModel"_fnvp,
-   "UprightWaterDamageHeight"_fnvp,
-   "UseChangeColor"_fnvp,
-   "UseCollision"_fnvp,
-   "UseDirectionalDeaths"_fnvp,
-   "UseDirectionalJumps"_fnvp,
-   "UseHSV"_fnvp,
-   "UseTexture"_fnvp,
-   "UseVCollForFlyers"_fnvp,
-   "uta_bldg_tower_damage1"_fnvp,
-   "uta_bldg_tower_damage2"_fnvp,
-   "uta_bldg_tower_damage3"_fnvp,
-   "uta_bldg_tower_damage4"_fnvp,
-   "uta_bldg_tower_damage5"_fnvp,
-   "uta_bldg_tower_damage6"_fnvp,
-   "uta_movies"_fnvp,
-   "uta1"_fnvp,
-   "uta1_1flag"_fnvp,
-   "uta1_bldg_lizardpen"_fnvp,
-   "uta1_Campaign"_fnvp,
-   "uta1_Conquest"_fnvp,
-   "uta1_CTF2flag"_fnvp,
-   "uta1_Droids"_fnvp,
-   "uta1_Light_RG"_fnvp,
-   "uta1_Pens"_fnvp,
-   "uta1_post_spot"_fnvp,
-   "uta1_props"_fnvp,
-   "uta1_Rumbles"_fnvp,
-   "uta1_sfx_bldg_tower_exp"_fnvp,
-   "uta1_SoundRegions"_fnvp,
-   "uta1_SoundSpaces"_fnvp,
-   "uta1_steamgrate"_fnvp,
-   "uta1_TDM"_fnvp,
-   "uta1_Vehicles"_fnvp,
-   "uta1tran1"_fnvp,
-   "utamon01"_fnvp,
-   "utamon02"_fnvp,
-   "VAlign"_fnvp,
-   "Value"_fnvp,
-   "Value_ATK_Alliance"_fnvp,
-   "Value_ATK_CIS"_fnvp,
-   "Value_ATK_Empire"_fnvp,
-   "Value_ATK_Locals"_fnvp,
-   "Value_ATK_Republic"_fnvp,
-   "Value_DEF_Alliance"_fnvp,
-   "Value_DEF_CIS"_fnvp,
-   "Value_DEF_Empire"_fnvp,
-   "Value_DEF_Locals"_fnvp,
-   "Value_DEF_Republic"_fnvp,
-   "ValueBleed"_fnvp,
-   "ValueBleed_Alliance"_fnvp,
-   "ValueBleed_CIS"_fnvp,
-   "ValueBleed_Empire"_fnvp,
-   "ValueBleed_Locals"_fnvp,
-   "ValueBleed_Neutral"_fnvp,
-   "ValueBleed_Republic"_fnvp,
-   "VarianceX"_fnvp,
-   "VarianceY"_fnvp,
-   "VarianceZ"_fnvp,
-   "vBarrelNodeName"_fnvp,
-   "vcenter"_fnvp,
-   "veh_weapon_template"_fnvp,
-   "Vehicle"_fnvp,
-   "vehicle_eng_hi-mid_template"_fnvp,
-   "vehicle_eng_low_template"_fnvp,
-   "vehicle_foley_template"_fnvp,
-   "vehicle_template"_fnvp,
-   "VehicleAmbientColor"_fnvp,
-   "VehicleAmmo"_fnvp,
-   "vehiclecollision"_fnvp,
-   "vehiclecollisiononly"_fnvp,
-   "VehicleCollisionPrim"_fnvp,
-   "VehicleCollisionSound"_fnvp,
-   "VehicleEnergy"_fnvp,
-   "VehicleHealth"_fnvp,
-   "vehiclepad"_fnvp,
-   "VehiclePosition"_fnvp,
-   "VehicleScale"_fnvp,
-   "VehicleSeating"_fnvp,
-   "vehicleself"_fnvp,
-   "vehiclespawn"_fnvp,
-   "VehicleType"_fnvp,
-   "Velocity"_fnvp,
-   "VelocityChangeRate"_fnvp,
-   "VelocityDamp"_fnvp,
-   "VelocityFromStrafe"_fnvp,
-   "VelocityFromThrust"_fnvp,
-   "VelocityRange"_fnvp,
-   "VelocityScale"_fnvp,
-   "VelocitySpring"_fnvp,
-   "VelocityX"_fnvp,
-   "VelocityXZ"_fnvp,
-   "VelocityXZAngle"_fnvp,
-   "VelocityY"_fnvp,
-   "VelocityYAbs"_fnvp,
-   "VelocityZ"_fnvp,
-   "Version"_fnvp,
-   "VerticalSpread"_fnvp,
-   "ViewAngleFactor"_fnvp,
-   "Viewport"_fnvp,
-   "Viewport0Position"_fnvp,
-   "Viewport0UseSafezone"_fnvp,
-   "Viewport1Position"_fnvp,
-   "Viewport1UseSafezone"_fnvp,
-   "Viewport2Position"_fnvp,
-   "Viewport2UseSafezone"_fnvp,
-   "Viewport3Position"_fnvp,
-   "Viewport3UseSafezone"_fnvp,
-   "Viewports"_fnvp,
-   "vil"_fnvp,
-   "villain"_fnvp,
-   "villains"_fnvp,
-   "Vine"_fnvp,
-   "VineLength"_fnvp,
-   "VineSpread"_fnvp,
-   "Virtual"_fnvp,
-   "VisibilityRange"_fnvp,
-   "VisibleRadius"_fnvp,
-   "VO_All_AllCapture"_fnvp,
-   "VO_All_AllInDispute"_fnvp,
-   "VO_All_AllInfo"_fnvp,
-   "VO_All_AllLost"_fnvp,
-   "VO_All_AllSaved"_fnvp,
-   "VO_All_ImpCapture"_fnvp,
-   "VO_All_ImpInDispute"_fnvp,
-   "VO_All_ImpInfo"_fnvp,
-   "VO_All_ImpLost"_fnvp,
-   "VO_All_ImpSaved"_fnvp,
-   "VO_CIS_CISCapture"_fnvp,
-   "VO_CIS_CISInDispute"_fnvp,
-   "VO_CIS_CISInfo"_fnvp,
-   "VO_CIS_CISLost"_fnvp,
-   "VO_CIS_CISSaved"_fnvp,
-   "VO_CIS_RepCapture"_fnvp,
-   "VO_CIS_RepInDispute"_fnvp,
-   "VO_CIS_RepInfo"_fnvp,
-   "VO_CIS_RepLost"_fnvp,
-   "VO_CIS_RepSaved"_fnvp,
-   "VO_Imp_AllCapture"_fnvp,
-   "VO_Imp_AllInDispute"_fnvp,
-   "VO_Imp_AllInfo"_fnvp,
-   "VO_Imp_AllLost"_fnvp,
-   "VO_Imp_AllSaved"_fnvp,
-   "VO_Imp_ImpCapture"_fnvp,
-   "VO_Imp_ImpInDispute"_fnvp,
-   "VO_Imp_ImpInfo"_fnvp,
-   "VO_Imp_ImpLost"_fnvp,
-   "VO_Imp_ImpSaved"_fnvp,
-   "VO_Rep_CISCapture"_fnvp,
-   "VO_Rep_CISInDispute"_fnvp,
-   "VO_Rep_CISInfo"_fnvp,
-   "VO_Rep_CISLost"_fnvp,
-   "VO_Rep_CISSaved"_fnvp,
-   "VO_Rep_RepCapture"_fnvp,
-   "VO_Rep_RepInDispute"_fnvp,
-   "VO_Rep_RepInfo"_fnvp,
-   "VO_Rep_RepLost"_fnvp,
-   "VO_Rep_RepSaved"_fnvp,
-   "vo_template"_fnvp,
-   "Voice"_fnvp,
-   "VoiceChat"_fnvp,
-   "voicemode"_fnvp,
-   "voiceover"_fnvp,
-   "VORadius"_fnvp,
-   "Vortex"_fnvp,
-   "VOSound"_fnvp,
-   "VOUnitType"_fnvp,
-   "WaitMax"_fnvp,
-   "WaitMin"_fnvp,
-   "WakeEffect"_fnvp,
-   "WakeWaterSplashEffect"_fnvp,
-   "walker"_fnvp,
-   "walkerdroid"_fnvp,
-   "WalkerLegPair"_fnvp,
-   "WalkerOrientRoll"_fnvp,
-   "WALKERSECTION"_fnvp,
-   "walkerstomp"_fnvp,
-   "WalkerWidth"_fnvp,
-   "WarmUpSound"_fnvp,
-   "WarmUpSoundFadeInTime"_fnvp,
-   "WarmUpSoundFadeOutTime"_fnvp,
-   "WarmUpSoundStartPitch"_fnvp,
-   "WarmUpTime"_fnvp,
-   "water"_fnvp,
-   "water_foley"_fnvp,
-   "WaterDamageAmount"_fnvp,
-   "WaterDamageInterval"_fnvp,
-   "WaterEffect"_fnvp,
-   "waterfall_bottom_center"_fnvp,
-   "waterfall_bottom_side"_fnvp,
-   "WaterInfo"_fnvp,
-   "WaterRingColor"_fnvp,
-   "WaterSplashColor"_fnvp,
-   "WaterSplashEffect"_fnvp,
-   "WaterWadingSound"_fnvp,
-   "WaterWakeColor"_fnvp,
-   "WaverRate"_fnvp,
-   "WaverTurn"_fnvp,
-   "Weapon"_fnvp,
-   "weapon_template"_fnvp,
-   "WeaponAmmo"_fnvp,
-   "WeaponAmmo1"_fnvp,
-   "WeaponAmmo2"_fnvp,
-   "WeaponAmmo3"_fnvp,
-   "WeaponAmmo4"_fnvp,
-   "WeaponChange"_fnvp,
-   "WeaponChangeSound"_fnvp,
-   "WeaponChannel"_fnvp,
-   "WeaponChannel1"_fnvp,
-   "WeaponChannel2"_fnvp,
-   "WeaponChannel3"_fnvp,
-   "WeaponChannel4"_fnvp,
-   "WeaponName"_fnvp,
-   "WeaponName1"_fnvp,
-   "WeaponName2"_fnvp,
-   "WeaponName3"_fnvp,
-   "WeaponName4"_fnvp,
-   "WeaponSection"_fnvp,
-   "WeaponShareAmmo"_fnvp,
-   "WeaponShareAmmo1"_fnvp,
-   "WeaponShareAmmo2"_fnvp,
-   "WeaponShareAmmo3"_fnvp,
-   "WeaponShareAmmo4"_fnvp,
-   "WeaponShareHeat"_fnvp,
-   "WeaponShareHeat1"_fnvp,
-   "WeaponShareHeat2"_fnvp,
-   "WeaponShareHeat3"_fnvp,
-   "WeaponShareHeat4"_fnvp,
-   "WeaponUnableSelect"_fnvp,
-   "WheelOmegaToU"_fnvp,
-   "WheelOmegaToV"_fnvp,
-   "WheelSection"_fnvp,
-   "WheelTexture"_fnvp,
-   "WheelVelocToU"_fnvp,
-   "WheelVelocToV"_fnvp,
-   "Widescreen"_fnvp,
-   "Width"_fnvp,
-   "WiggleAmount"_fnvp,
-   "WiggleSpeed"_fnvp,
-   "win"_fnvp,
-   "winddirection"_fnvp,
-   "WindDownSound"_fnvp,
-   "WindSound"_fnvp,
-   "WindSpeed"_fnvp,
-   "WindUpSound"_fnvp,
-   "WingModel"_fnvp,
-   "wookie_movement_metal_template"_fnvp,
-   "wookie_movement_template"_fnvp,
-   "word"_fnvp,
-   "word_reformat"_fnvp,
-   "WorldAligned"_fnvp,
-   "WorldBrightness"_fnvp,
-   "WorldContrast"_fnvp,
-   "WorldFogRange"_fnvp,
-   "WorldHeight"_fnvp,
-   "WorldRange"_fnvp,
-   "WorldSaturation"_fnvp,
-   "WrapInput"_fnvp,
-   "yav_movies"_fnvp,
-   "yav_prop_bush"_fnvp,
-   "yav_prop_bush2"_fnvp,
-   "yav_prop_grass"_fnvp,
-   "yav_prop_shrub1"_fnvp,
-   "yav_prop_treebillboard"_fnvp,
-   "yav1tran1"_fnvp,
-   "yavin1"_fnvp,
-   "yavin1_Campaign"_fnvp,
-   "yavin1_CommonDesign"_fnvp,
-   "yavin1_Conquest"_fnvp,
-   "yavin1_ctf"_fnvp,
-   "yavin1_CTF_centerflag"_fnvp,
-   "yavin1_soundemitters"_fnvp,
-   "yavin1_soundregionenv"_fnvp,
-   "yavin1_SoundRegions"_fnvp,
-   "yavin1_SoundSpaces"_fnvp,
-   "yavin1_tdm"_fnvp,
-   "yavin1_tree"_fnvp,
-   "yavmon01"_fnvp,
-   "yavmon02"_fnvp,
-   "YawLimits"_fnvp,
-   "YawSpread"_fnvp,
-   "YawTurnFactor"_fnvp,
-   "YOffset"_fnvp,
-   "ZeroGravity"_fnvp,
-   "ZoomFirstPerson"_fnvp,
-   "ZoomMax"_fnvp,
-   "ZoomMin"_fnvp,
-   "ZoomRate"_fnvp,
-   "ZoomTurnDivisorMax"_fnvp,
-   "ZoomTurnDivisorMin"_fnvp,
-   "ZOrder"_fnvp,
+//! \brief Recently looked up strings, kept per thread. Entries are grouped into small
+//! sets by their hash, within a set they're ordered from most to least recently used and
+//! the least recently used is replaced.
+struct Swbf_fnv_hashes::Lookup_memo {
+   struct Entry {
+      //! The memo id of the Swbf_fnv_hashes the string was found in, 0 for empty entries.
+      std::uint64_t owner = 0;
+      std::uint32_t hash = 0;
+      std::string_view string;
+      //! Set for unknown hashes, so lookups of them are still counted.
+      std::atomic_uint64_t* unknown_lookups = nullptr;
+   };
+
+   static constexpr std::size_t set_count = 128;
+   static constexpr std::size_t way_count = 4;
+
+   auto find(const std::uint64_t owner, const std::uint32_t hash) noexcept -> Entry*
+   {
+      auto& set = get_set(hash);
+
+      for (auto way = set.begin(); way != set.end(); ++way) {
+         if (way->owner == owner && way->hash == hash) {
+            std::rotate(set.begin(), way, way + 1);
+
+            return &set.front();
+         }
+      }
+
+      return nullptr;
+   }
+
+   void insert(const Entry& entry) noexcept
+   {
+      auto& set = get_set(entry.hash);
+
+      std::rotate(set.begin(), set.end() - 1, set.end());
+
+      set.front() = entry;
+   }
+
+private:
+   auto get_set(const std::uint32_t hash) noexcept -> std::array<Entry, way_count>&
+   {
+      return _sets[(hash ^ (hash >> 16)) & (set_count - 1)];
+   }
+
+   std::array<std::array<Entry, way_count>, set_count> _sets{};
+};
+
+//! \brief The strings returned for hashes with no known string, shared by a set of
+//! hashes and all overlays of it so views of them stay valid while any of them exist.
+struct Swbf_fnv_hashes::Unknown_hashes {
+   tbb::concurrent_unordered_map<std::uint32_t, Unknown_hash> hashes;
+
+   auto get(const std::uint32_t hash) -> Unknown_hash&
+   {
+      if (const auto result = hashes.find(hash); result != hashes.end()) {
+         return result->second;
+      }
+
+      return hashes.emplace(hash, hash).first->second;
+   }
 };
 
+Swbf_fnv_hashes::Swbf_fnv_hashes() : _unknown_hashes{std::make_shared<Unknown_hashes>()}
+{
+}
+
+Swbf_fnv_hashes::Swbf_fnv_hashes(std::shared_ptr<const Swbf_fnv_hashes> base) noexcept
+   : _base{std::move(base)}, _unknown_hashes{_base->_unknown_hashes}
+{
+}
+
+auto Swbf_fnv_hashes::lookup(const std::uint32_t hash) const -> std::string_view
+{
+   return lookup(hash, thread_memo());
+}
+
+void Swbf_fnv_hashes::lookup(gsl::span<const std::uint32_t> hashes,
+                             gsl::span<std::string_view> strings) const
+{
+   Expects(hashes.size() == strings.size());
+
+   auto& memo = thread_memo();
+
+   for (std::ptrdiff_t i = 0; i < hashes.size(); ++i) {
+      strings[i] = lookup(hashes[i], memo);
+   }
 }
 
-auto Swbf_fnv_hashes::lookup(const std::uint32_t hash) const noexcept -> std::string
+auto Swbf_fnv_hashes::lookup(const std::uint32_t hash, Lookup_memo& memo) const
+   -> std::string_view
 {
-   if (const auto result = swbf_hashes.find(hash); result != std::cend(swbf_hashes)) {
-      return std::string{result->second};
+   if (auto* const entry = memo.find(_memo_id, hash); entry) {
+      if (entry->unknown_lookups) {
+         entry->unknown_lookups->fetch_add(1, std::memory_order_relaxed);
+      }
+
+      return entry->string;
    }
 
-   if (const auto result = _extra_hashes.find(hash); result != std::cend(_extra_hashes)) {
-      return result->second;
+   Lookup_memo::Entry entry{
+      .owner = _memo_id, .hash = hash, .string = {}, .unknown_lookups = nullptr};
+
+   if (const auto builtin = find_builtin(hash); builtin) {
+      entry.string = *builtin;
+   }
+   else if (const auto added = find_added(hash); added) {
+      entry.string = *added;
+   }
+   else {
+      auto& unknown = _unknown_hashes->get(hash);
+
+      unknown.lookups.fetch_add(1, std::memory_order_relaxed);
+
+      entry.string = unknown.string;
+      entry.unknown_lookups = &unknown.lookups;
+   }
+
+   memo.insert(entry);
+
+   return entry.string;
+}
+
+auto Swbf_fnv_hashes::find(const std::uint32_t hash) const noexcept
+   -> std::optional<std::string_view>
+{
+   if (const auto builtin = find_builtin(hash); builtin) return builtin;
+
+   return find_added(hash);
+}
+
+auto Swbf_fnv_hashes::thread_memo() noexcept -> Lookup_memo&
+{
+   thread_local Lookup_memo memo;
+
+   return memo;
+}
+
+auto Swbf_fnv_hashes::new_memo_id() noexcept -> std::uint64_t
+{
+   return memo_ids.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+auto Swbf_fnv_hashes::find_added(const std::uint32_t hash) const noexcept
+   -> std::optional<std::string_view>
+{
+   if (_base) {
+      if (const auto result = _base->find_added(hash); result) return result;
    }
 
-   auto hexstring = to_hexstring(hash);
+   for (const auto& dictionary : _dictionaries) {
+      if (const auto result = dictionary.find(hash); result) return result;
+   }
 
-   synced_cout::print("Warning: Unknown hash looked up.\n"s, "   value: "s, hexstring,
-                      '\n');
+   if (const auto result = _extra_hashes.find(hash); result != std::cend(_extra_hashes)) {
+      return result->second;
+   }
 
-   return hexstring;
+   return std::nullopt;
 }
 
 void Swbf_fnv_hashes::add(std::string string) noexcept
@@ -3898,20 +4095,62 @@ void Swbf_fnv_hashes::add(std::string string) noexcept
    const auto hash = fnv_1a_hash(string);
 
    _extra_hashes.emplace(hash, std::move(string));
+
+   // Memos may hold this hash as unknown.
+   _memo_id = new_memo_id();
+}
+
+void Swbf_fnv_hashes::add_dictionary(Hash_dictionary dictionary) noexcept
+{
+   _dictionaries.push_back(std::move(dictionary));
+
+   _memo_id = new_memo_id();
 }
 
 void read_swbf_fnv_hash_dictionary(Swbf_fnv_hashes& swbf_fnv_hashes,
                                    const std::filesystem::path& path)
 {
-   std::ifstream input{path};
+   logger::info("Reading dictionary: "s, path, '\n');
+
+   swbf_fnv_hashes.add_dictionary(Hash_dictionary::load(path));
+}
+
+void Swbf_fnv_hashes::log_unknown_hashes() const
+{
+   if (!logger::enabled(logger::Level::warning)) return;
 
-   if (!input.is_open()) {
-      throw std::runtime_error{"Failed to open file"s};
+   std::vector<std::pair<std::string_view, std::uint64_t>> hashes;
+   hashes.reserve(_unknown_hashes->hashes.size());
+
+   for (const auto& [hash, unknown] : _unknown_hashes->hashes) {
+      hashes.emplace_back(unknown.string, unknown.lookups.load());
    }
 
-   synced_cout::print("Reading dictionary: "s, path, '\n');
+   if (hashes.empty()) return;
+
+   std::sort(hashes.begin(), hashes.end(), [](const auto& l, const auto& r) {
+      return std::tie(r.second, l.first) < std::tie(l.second, r.first);
+   });
+
+   std::string message = "Unknown hashes looked up ("s;
+   number_format::append(message, hashes.size());
+   message += " distinct)\n"sv;
 
-   for (std::string line; std::getline(input, line);) {
-      swbf_fnv_hashes.add(std::move(line));
+   for (std::size_t i = 0; i < hashes.size(); ++i) {
+      if (i == max_logged_unknown_hashes) {
+         message += "   ... and "sv;
+         number_format::append(message, hashes.size() - i);
+         message += " more\n"sv;
+
+         break;
+      }
+
+      message += "   "sv;
+      message += hashes[i].first;
+      message += " seen "sv;
+      number_format::append(message, hashes[i].second);
+      message += hashes[i].second == 1 ? " time\n"sv : " times\n"sv;
    }
+
+   logger::warning(message);
 }
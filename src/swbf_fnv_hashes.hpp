@@ -1,9 +1,17 @@
 #pragma once
 
+#include "hash_dictionary.hpp"
+
+#include <gsl/gsl>
+
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 constexpr std::uint32_t fnv_1a_hash(const std::string_view str)
 {
@@ -27,9 +35,18 @@ constexpr std::uint32_t operator""_fnv(const char* str, const std::size_t length
    return fnv_1a_hash({str, length});
 }
 
+//! \brief The strings hashes are looked up in.
+//!
+//! Hashes can be layered, an overlay created over a shared base finds the base's strings
+//! without copying them. This lets every input file share one loaded dictionary while
+//! still being able to add strings of its own.
 class Swbf_fnv_hashes {
 public:
-   Swbf_fnv_hashes() = default;
+   Swbf_fnv_hashes();
+
+   //! \brief Creates an overlay on a set of hashes. Strings in the base are found before
+   //! strings in the overlay, and unknown hashes are shared with the base.
+   explicit Swbf_fnv_hashes(std::shared_ptr<const Swbf_fnv_hashes> base) noexcept;
 
    Swbf_fnv_hashes(const Swbf_fnv_hashes&) = delete;
    auto operator=(const Swbf_fnv_hashes&) -> Swbf_fnv_hashes& = delete;
@@ -37,12 +54,58 @@ public:
    Swbf_fnv_hashes(Swbf_fnv_hashes&&) = default;
    auto operator=(Swbf_fnv_hashes&& other) -> Swbf_fnv_hashes& = default;
 
-   auto lookup(const std::uint32_t hash) const noexcept -> std::string;
+   //! \brief Looks up the string for a hash, or a hexadecimal string of the hash if it is
+   //! unknown. The string lives as long as the Swbf_fnv_hashes.
+   //!
+   //! Recent lookups are remembered by the calling thread, so the property names that
+   //! repeat through a file are only searched for once.
+   //!
+   //! \exception std::bad_alloc Thrown when an unknown hash is seen for the first time
+   //! and its string can't be allocated.
+   auto lookup(const std::uint32_t hash) const -> std::string_view;
+
+   //! \brief Looks up the strings for a batch of hashes, such as every property of a
+   //! chunk.
+   //!
+   //! \param hashes The hashes to look up.
+   //! \param strings Receives the string of each hash, must be the same size as hashes.
+   void lookup(gsl::span<const std::uint32_t> hashes,
+               gsl::span<std::string_view> strings) const;
+
+   //! \brief Finds the string for a hash. Unlike lookup a hash with no string isn't
+   //! recorded as an unknown hash, for callers that only test names.
+   auto find(const std::uint32_t hash) const noexcept -> std::optional<std::string_view>;
 
    void add(std::string string) noexcept;
 
+   //! \brief Adds a dictionary of strings. Strings in dictionaries are found before
+   //! strings added with add.
+   void add_dictionary(Hash_dictionary dictionary) noexcept;
+
+   //! \brief Logs every unknown hash looked up through these hashes, their base or any
+   //! other overlay of it, and how often, if there were any.
+   void log_unknown_hashes() const;
+
 private:
+   struct Lookup_memo;
+   struct Unknown_hashes;
+
+   auto lookup(const std::uint32_t hash, Lookup_memo& memo) const -> std::string_view;
+
+   static auto thread_memo() noexcept -> Lookup_memo&;
+
+   static auto new_memo_id() noexcept -> std::uint64_t;
+
+   //! \brief Finds a string added to these hashes or their base.
+   auto find_added(const std::uint32_t hash) const noexcept
+      -> std::optional<std::string_view>;
+
+   std::shared_ptr<const Swbf_fnv_hashes> _base;
+   std::vector<Hash_dictionary> _dictionaries;
    std::unordered_map<std::uint32_t, std::string> _extra_hashes;
+   std::shared_ptr<Unknown_hashes> _unknown_hashes;
+   //! \brief Identifies these hashes' strings in memos, replaced when strings are added.
+   std::uint64_t _memo_id = new_memo_id();
 };
 
 void read_swbf_fnv_hash_dictionary(Swbf_fnv_hashes& swbf_fnv_hashes,
@@ -0,0 +1,168 @@
+#include "tar_sink.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace {
+
+constexpr std::size_t block_size = 512;
+constexpr std::size_t archive_buffer_size = 1024 * 1024;
+
+constexpr std::size_t name_length = 100;
+constexpr std::uint64_t max_octal_size = 077777777777;
+
+constexpr char regular_file_type = '0';
+constexpr char directory_type = '5';
+constexpr char pax_header_type = 'x';
+
+using Header = std::array<char, block_size>;
+
+//! \brief Writes a NUL terminated, zero padded octal number into a header field.
+void write_octal(Header& header, std::size_t offset, std::size_t length,
+                 std::uint64_t value) noexcept
+{
+   fmt::format_to_n(header.data() + offset, length - 1, "{:0{}o}", value, length - 1);
+}
+
+void write_string(Header& header, std::size_t offset, std::size_t length,
+                  std::string_view value) noexcept
+{
+   std::copy_n(value.data(), std::min(value.size(), length), header.data() + offset);
+}
+
+//! \brief Formats a pax record, "<length> <key>=<value>\n" where length counts itself.
+auto pax_record(std::string_view key, std::string_view value) -> std::string
+{
+   const auto base_length = key.size() + value.size() + 3;
+   auto length = base_length + 1;
+
+   while (fmt::formatted_size("{}"sv, length) + base_length != length) ++length;
+
+   return fmt::format("{} {}={}\n"sv, length, key, value);
+}
+
+}
+
+Tar_sink::Tar_sink(const fs::path& archive_path, fs::path root)
+   : _archive_path{archive_path},
+     _root{std::move(root)},
+     _modified_time{static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(
+           std::chrono::system_clock::now().time_since_epoch())
+           .count())},
+     _buffer{std::make_unique<char[]>(archive_buffer_size)}
+{
+   _archive.rdbuf()->pubsetbuf(_buffer.get(), archive_buffer_size);
+   _archive.open(archive_path, std::ios::binary);
+
+   if (!_archive) {
+      throw std::runtime_error{fmt::format("Unable to create archive {}"sv,
+                                           archive_path.string())};
+   }
+}
+
+Tar_sink::~Tar_sink()
+{
+   // The end of an archive is marked by two empty blocks.
+   const Header empty{};
+
+   _archive.write(empty.data(), empty.size());
+   _archive.write(empty.data(), empty.size());
+}
+
+void Tar_sink::create_directory(const fs::path& path)
+{
+   auto name = entry_name(path);
+
+   if (name.empty() || name == "."sv) return;
+
+   if (name.back() != '/') name += '/';
+
+   append_entry(name, directory_type, ""sv);
+}
+
+void Tar_sink::write_file(fs::path path, std::string contents)
+{
+   append_entry(entry_name(path), regular_file_type, contents);
+}
+
+void Tar_sink::write_file(const fs::path& path, std::string_view contents)
+{
+   append_entry(entry_name(path), regular_file_type, contents);
+}
+
+auto Tar_sink::entry_name(const fs::path& path) const -> std::string
+{
+   return path.lexically_normal().lexically_relative(_root).generic_string();
+}
+
+void Tar_sink::append_entry(std::string_view name, char type, std::string_view contents)
+{
+   std::string pax_records;
+
+   if (name.size() > name_length) pax_records += pax_record("path"sv, name);
+
+   if (contents.size() > max_octal_size) {
+      pax_records += pax_record("size"sv, fmt::format("{}"sv, contents.size()));
+   }
+
+   std::lock_guard lock{_mutex};
+
+   if (!pax_records.empty()) {
+      append_header("././@PaxHeader"sv, pax_header_type, pax_records.size());
+      _archive.write(pax_records.data(), pax_records.size());
+      append_padding(pax_records.size());
+   }
+
+   append_header(name, type, contents.size());
+   _archive.write(contents.data(), contents.size());
+   append_padding(contents.size());
+
+   if (!_archive) {
+      throw std::runtime_error{fmt::format("Unable to write to archive {}"sv,
+                                           _archive_path.string())};
+   }
+}
+
+void Tar_sink::append_header(std::string_view name, char type, std::uint64_t size)
+{
+   Header header{};
+
+   write_string(header, 0, name_length, name);
+   write_octal(header, 100, 8, type == directory_type ? 0755 : 0644);
+   write_octal(header, 108, 8, 0);
+   write_octal(header, 116, 8, 0);
+   write_octal(header, 124, 12, std::min(size, max_octal_size));
+   write_octal(header, 136, 12, _modified_time);
+   header[156] = type;
+   write_string(header, 257, 6, "ustar\0"sv);
+   write_string(header, 263, 2, "00"sv);
+
+   // The checksum is calculated with its own field filled with spaces.
+   std::fill_n(header.data() + 148, 8, ' ');
+
+   std::uint32_t checksum = 0;
+
+   for (const char c : header) checksum += static_cast<unsigned char>(c);
+
+   write_octal(header, 148, 7, checksum);
+   header[154] = '\0';
+
+   _archive.write(header.data(), header.size());
+}
+
+void Tar_sink::append_padding(std::uint64_t size)
+{
+   const Header empty{};
+
+   if (const auto remainder = size % block_size; remainder != 0) {
+      _archive.write(empty.data(), block_size - remainder);
+   }
+}
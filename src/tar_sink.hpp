@@ -0,0 +1,54 @@
+#pragma once
+
+#include "output_sink.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+//! \brief Writes saved files into a single POSIX tar archive instead of a directory tree.
+//!
+//! Entries are appended to the archive as they're saved, one at a time, so the archive
+//! is written front to back in one file no matter how many threads are saving. Names
+//! that don't fit a ustar header are stored in a pax extended header. The end of archive
+//! marker is written when the sink is destroyed.
+class Tar_sink final : public Output_sink {
+public:
+   //! \param archive_path The path of the archive to create.
+   //! \param root The directory entry names are made relative to.
+   //!
+   //! \exception std::runtime_error Thrown when the archive could not be created.
+   Tar_sink(const std::filesystem::path& archive_path, std::filesystem::path root);
+
+   Tar_sink(const Tar_sink&) = delete;
+   Tar_sink& operator=(const Tar_sink&) = delete;
+
+   ~Tar_sink();
+
+   void create_directory(const std::filesystem::path& path) override;
+
+   void write_file(std::filesystem::path path, std::string contents) override;
+
+   void write_file(const std::filesystem::path& path, std::string_view contents) override;
+
+private:
+   auto entry_name(const std::filesystem::path& path) const -> std::string;
+
+   void append_entry(std::string_view name, char type, std::string_view contents);
+
+   void append_header(std::string_view name, char type, std::uint64_t size);
+
+   void append_padding(std::uint64_t size);
+
+   const std::filesystem::path _archive_path;
+   const std::filesystem::path _root;
+   const std::uint64_t _modified_time;
+
+   std::mutex _mutex;
+   std::unique_ptr<char[]> _buffer;
+   std::ofstream _archive;
+};
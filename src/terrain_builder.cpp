@@ -207,7 +207,7 @@ void Terrain_builder::save(Game_version version, std::string_view name,
    // patch infomap
    buffer += view_object_span_as_string(gsl::make_span(_patch_infomap));
 
-   file_saver.save_file(buffer, "world"sv, name, ".ter"sv);
+   file_saver.save_file(std::move(buffer), "world"sv, name, ".ter"sv);
 }
 
 std::size_t Terrain_builder::lookup_point_index(Point point) const noexcept
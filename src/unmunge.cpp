@@ -0,0 +1,56 @@
+#include "unmunge.hpp"
+#include "app_options.hpp"
+#include "chunk_handlers.hpp"
+#include "create_swbf_hashes.hpp"
+#include "file_saver.hpp"
+#include "layer_index.hpp"
+#include "magic_number.hpp"
+#include "number_format.hpp"
+#include "ucfb_reader.hpp"
+
+#include <memory>
+#include <stdexcept>
+
+using namespace std::literals;
+
+namespace unmunge {
+
+auto extract(gsl::span<const std::byte> bytes, std::string_view name,
+             const std::vector<std::string>& arguments) -> std::vector<Saved_file>
+{
+   auto app_arguments = arguments;
+
+   if (!name.empty()) {
+      app_arguments.emplace_back("-file"sv);
+      app_arguments.emplace_back(name);
+   }
+
+   const App_options app_options{app_arguments};
+
+   if (app_options.exact_floats()) number_format::enable_exact_floats();
+
+   const Ucfb_reader root{bytes};
+
+   if (root.magic_number() != "ucfb"_mn) {
+      throw std::runtime_error{"Root chunk is not ucfb as expected."};
+   }
+
+   const auto sink = std::make_shared<Memory_sink>();
+
+   {
+      File_saver file_saver{{}, app_options.verbose(), sink};
+      const Swbf_fnv_hashes swbf_hashes{create_swbf_hashes(app_options)};
+      Layer_index layer_index;
+
+      handle_ucfb(root, app_options, file_saver, swbf_hashes, layer_index);
+
+      layer_index.save(file_saver);
+
+      // The unknown hashes are freed along with swbf_hashes.
+      swbf_hashes.log_unknown_hashes();
+   }
+
+   return sink->take_files();
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "memory_sink.hpp"
+
+#include <gsl/gsl>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//! \brief Running the unmunger from another program, without reading or writing files.
+namespace unmunge {
+
+//! \brief Extracts a munged file held in memory. Unknown hashes looked up while
+//! extracting are logged as a warning before returning.
+//!
+//! \param bytes The contents of the munged file, such as a .lvl.
+//! \param name The name of the file without its extension, used to look up hashes
+//!             derived from it such as the level's localization keys. Can be empty.
+//! \param arguments Options as they would be given on the command line, for instance
+//!                  {"-platform", "xbox", "-imgfmt", "dds"}. Options choosing input or
+//!                  output files and the tool mode are ignored, as are -dedup and
+//!                  -cache since there are no files on disk to link or reuse.
+//!                  -exactfloats turns on exact float output for the whole process,
+//!                  including later calls that don't pass it.
+//!
+//! \return The extracted files, sorted by path. The paths are what they would be
+//!         relative to the output directory when extracting to disk.
+//!
+//! \exception std::runtime_error Thrown when bytes don't hold a ucfb file.
+auto extract(gsl::span<const std::byte> bytes, std::string_view name = {},
+             const std::vector<std::string>& arguments = {}) -> std::vector<Saved_file>;
+
+}
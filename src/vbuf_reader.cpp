@@ -1,9 +1,9 @@
 
 #include "vbuf_reader.hpp"
 #include "bit_flags.hpp"
+#include "logger.hpp"
 #include "magic_number.hpp"
 #include "string_helpers.hpp"
-#include "synced_cout.hpp"
 #include "ucfb_reader.hpp"
 
 #include <array>
@@ -395,10 +395,10 @@ auto read_vbuf(const std::vector<Ucfb_reader_strict<"VBUF"_mn>>& vbufs,
    const auto info = vbuf.read_trivial<Vbuf_info>();
 
    if ((info.flags & vbuf_unknown_flags_mask) != Vbuf_flags::none) {
-      synced_cout::print("VBUF with unknown flags encountered."s, "\n   size : "s,
-                         vbuf.size(), "\n   entry count: "s, info.count, "\n   stride: "s,
-                         info.stride, "\n   entry flags: "s,
-                         to_hexstring(static_cast<std::uint32_t>(info.flags)), '\n');
+      logger::warning("VBUF with unknown flags encountered."s, "\n   size : "s,
+                      vbuf.size(), "\n   entry count: "s, info.count, "\n   stride: "s,
+                      info.stride, "\n   entry flags: "s,
+                      to_hexstring(static_cast<std::uint32_t>(info.flags)), '\n');
 
       throw std::runtime_error{"vbuf with unknown flags"};
    }
@@ -420,7 +420,7 @@ auto read_vbuf(const std::vector<Ucfb_reader_strict<"VBUF"_mn>>& vbufs,
       }
    }
    catch (std::exception&) {
-      synced_cout::print(
+      logger::warning(
          "Failed to completely read VBUF. Model may be incomplete or invalid.");
    }
 
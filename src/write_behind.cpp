@@ -0,0 +1,195 @@
+#include "write_behind.hpp"
+#include "file_batch_writer.hpp"
+#include "instrumentation.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace std::literals;
+
+namespace write_behind {
+
+namespace {
+
+void unlink_existing_file(const fs::path& path) noexcept
+{
+   std::error_code error;
+
+   fs::remove(path, error);
+}
+
+std::mutex queue_mutex;
+std::condition_variable queue_not_empty;
+std::condition_variable queue_has_space;
+std::condition_variable queue_drained;
+std::condition_variable queue_wrote_files;
+
+std::deque<Pending_file> queue;
+
+//! Paths of files that have been queued but not yet written, with how many times each
+//! is queued.
+std::unordered_map<fs::path::string_type, std::size_t> in_flight_paths;
+
+//! Bytes and files that have been queued but not yet written, including those being
+//! written right now.
+std::size_t in_flight_bytes = 0;
+std::size_t in_flight_files = 0;
+std::size_t max_in_flight_bytes = 0;
+
+bool writers_stopping = false;
+std::atomic_bool writers_running = false;
+std::vector<std::thread> writer_threads;
+
+void run_writer()
+{
+   File_batch_writer batch_writer;
+   std::vector<Pending_file> batch;
+   batch.reserve(File_batch_writer::max_batch_size);
+
+   std::unique_lock lock{queue_mutex};
+
+   for (;;) {
+      queue_not_empty.wait(lock, [] { return writers_stopping || !queue.empty(); });
+
+      if (queue.empty()) return;
+
+      std::size_t batch_bytes = 0;
+
+      while (!queue.empty() && batch.size() < File_batch_writer::max_batch_size) {
+         batch_bytes += queue.front().contents.size();
+         batch.push_back(std::move(queue.front()));
+         queue.pop_front();
+      }
+
+      lock.unlock();
+
+      {
+         const instrumentation::Scope scope{"write_files"sv};
+
+         for (const auto& file : batch) {
+            if (file.unlink_existing) unlink_existing_file(file.path);
+         }
+
+         batch_writer.write(batch);
+      }
+
+      lock.lock();
+
+      for (const auto& file : batch) {
+         const auto path = in_flight_paths.find(file.path.native());
+
+         if (--path->second == 0) in_flight_paths.erase(path);
+      }
+
+      in_flight_bytes -= batch_bytes;
+      in_flight_files -= batch.size();
+
+      batch.clear();
+
+      queue_has_space.notify_all();
+      queue_wrote_files.notify_all();
+
+      if (in_flight_files == 0) queue_drained.notify_all();
+   }
+}
+}
+
+Writer::Writer(std::size_t thread_count, std::size_t max_in_flight)
+{
+   std::lock_guard lock{queue_mutex};
+
+   writers_stopping = false;
+   max_in_flight_bytes = max_in_flight;
+
+   for (std::size_t i = 0; i < std::max<std::size_t>(thread_count, 1); ++i) {
+      writer_threads.emplace_back(run_writer);
+   }
+
+   writers_running = true;
+}
+
+Writer::~Writer()
+{
+   {
+      std::lock_guard lock{queue_mutex};
+
+      writers_running = false;
+      writers_stopping = true;
+   }
+
+   queue_not_empty.notify_all();
+
+   // Writers only exit once the queue is empty.
+   for (auto& thread : writer_threads) thread.join();
+
+   writer_threads.clear();
+}
+
+bool enabled() noexcept
+{
+   return writers_running.load(std::memory_order_relaxed);
+}
+
+void write(fs::path path, std::string contents, bool unlink_existing)
+{
+   std::unique_lock lock{queue_mutex};
+
+   if (!writers_running) {
+      lock.unlock();
+
+      return write_now(path, contents, unlink_existing);
+   }
+
+   const auto size = contents.size();
+
+   queue_has_space.wait(lock, [size] {
+      return in_flight_files == 0 || (in_flight_bytes + size) <= max_in_flight_bytes;
+   });
+
+   in_flight_bytes += size;
+   in_flight_files += 1;
+   in_flight_paths[path.native()] += 1;
+
+   queue.push_back({std::move(path), std::move(contents), unlink_existing});
+
+   lock.unlock();
+
+   queue_not_empty.notify_one();
+}
+
+void write_now(const fs::path& path, std::string_view contents,
+               bool unlink_existing) noexcept
+{
+   const instrumentation::Scope scope{"write_file"sv};
+
+   if (unlink_existing) unlink_existing_file(path);
+
+   if (!write_file(path, contents)) {
+      logger::error("Failed to write file "s, path.string(), '\n');
+   }
+}
+
+void wait_until_written(const fs::path& path) noexcept
+{
+   std::unique_lock lock{queue_mutex};
+
+   queue_wrote_files.wait(lock, [&] { return !in_flight_paths.contains(path.native()); });
+}
+
+void flush() noexcept
+{
+   std::unique_lock lock{queue_mutex};
+
+   queue_drained.wait(lock, [] { return in_flight_files == 0; });
+}
+
+}
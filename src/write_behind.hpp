@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+//! \brief Writing of output files off the threads that produce them.
+//!
+//! While a Writer exists File_saver::save_file hands the contents of files to a small
+//! pool of I/O threads instead of writing them itself, so the threads running chunk
+//! handlers stay busy with work that needs the CPU. The amount of memory held by queued
+//! files is bounded, once it is reached saving a file blocks until some have been
+//! written. Each I/O thread takes files from the queue in batches and writes them with a
+//! File_batch_writer. Without a Writer files are written immediately.
+namespace write_behind {
+
+//! \brief Owns the I/O threads that write out queued files. On destruction the queue is
+//! drained.
+class Writer {
+public:
+   //! \param thread_count The number of I/O threads to start, at least one is started.
+   //! \param max_in_flight_bytes The most memory queued files may hold. A single file
+   //!                            larger than this is still queued when the queue is
+   //!                            empty.
+   Writer(std::size_t thread_count, std::size_t max_in_flight_bytes);
+
+   Writer(const Writer&) = delete;
+   Writer& operator=(const Writer&) = delete;
+
+   ~Writer();
+};
+
+bool enabled() noexcept;
+
+//! \brief Queues a file to be written. Blocks while the queue is full.
+//!
+//! \param unlink_existing Whether an existing file at path is removed before writing,
+//!                        instead of written through. Done on the I/O thread.
+void write(std::filesystem::path path, std::string contents,
+           bool unlink_existing = false);
+
+//! \brief Writes a file on the calling thread.
+void write_now(const std::filesystem::path& path, std::string_view contents,
+               bool unlink_existing = false) noexcept;
+
+//! \brief Waits for any queued writes to a path to finish.
+void wait_until_written(const std::filesystem::path& path) noexcept;
+
+//! \brief Waits for every file queued so far to be written.
+void flush() noexcept;
+
+}